@@ -0,0 +1,98 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <api.hpp>
+#include <ast.hpp>
+
+#include "bench.hpp"
+
+
+
+namespace bench {
+
+  /* The number of nodes built by a run of the builder benchmarks */
+  static const triton::uint64 NODES = 300000;
+
+  /* The depth of the tree hashed by the hash benchmark */
+  static const triton::uint32 DEPTH = 1000;
+
+  /* The number of hashes of a run of the hash benchmark */
+  static const triton::uint32 HASHES = 200;
+
+
+  /* Builds `NODES` nodes. If `distinct` is false, the same nodes are built over and over */
+  static void build(bool distinct) {
+    for (triton::uint64 index = 0; index < NODES / 3; index++) {
+      triton::uint64 value = distinct ? index : 0;
+      triton::ast::bvadd(triton::ast::bv(value, 64), triton::ast::bv(value + 1, 64));
+    }
+  }
+
+
+  /* Runs a benchmark on a fresh context, `dictionaries` enables the AST dictionaries. Returns the bytes allocated per operation. */
+  static double measure(const Options& options, Result& result, bool dictionaries, void (*body)(void)) {
+    triton::uint64 bytes = 0;
+
+    for (triton::uint32 run = 0; run < options.runs; run++) {
+      triton::API ctx;
+      triton::API::Scope scope(ctx);
+
+      ctx.setArchitecture(triton::arch::ARCH_X86_64);
+      ctx.enableSymbolicOptimization(triton::engines::symbolic::AST_DICTIONARIES, dictionaries);
+
+      triton::uint64 bytesBefore = allocatedBytes();
+      auto start = std::chrono::high_resolution_clock::now();
+      body();
+      result.seconds.push_back(elapsed(start));
+      bytes += allocatedBytes() - bytesBefore;
+    }
+
+    return static_cast<double>(bytes) / (options.runs * result.count);
+  }
+
+
+  void ast(const Options& options, std::vector<Result>& results) {
+    Result result;
+
+    result.suite = "ast";
+    result.unit  = "nodes";
+    result.count = (NODES / 3) * 3;
+
+    /* Building without the dictionaries */
+    result.name = "builder";
+    result.metrics["bytes_per_node"] = measure(options, result, false, []() { build(true); });
+    results.push_back(result);
+
+    /* Building distinct nodes, every lookup misses */
+    result.name = "dictionary_miss";
+    result.seconds.clear();
+    result.metrics["bytes_per_node"] = measure(options, result, true, []() { build(true); });
+    results.push_back(result);
+
+    /* Building the same nodes, every lookup hits */
+    result.name = "dictionary_hit";
+    result.seconds.clear();
+    result.metrics["bytes_per_node"] = measure(options, result, true, []() { build(false); });
+    results.push_back(result);
+
+    /* Hashing a deep tree */
+    result.name  = "hash";
+    result.unit  = "hashes";
+    result.count = HASHES;
+    result.seconds.clear();
+    result.metrics.clear();
+    measure(options, result, false, []() {
+      triton::ast::AbstractNode* node = triton::ast::bv(1, 64);
+      for (triton::uint32 depth = 0; depth < DEPTH; depth++)
+        node = triton::ast::bvxor(triton::ast::bvadd(node, triton::ast::bv(depth, 64)), triton::ast::bv(depth + 1, 64));
+      for (triton::uint32 index = 0; index < HASHES; index++)
+        node->hash(DEPTH * 2);
+    });
+    result.metrics["depth"] = DEPTH * 2;
+    results.push_back(result);
+  }
+
+};
@@ -0,0 +1,184 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+/*
+** The benchmark suite. Every benchmark runs the same fixed workload `runs`
+** times on a fresh context and reports the time of each run, so results can
+** be compared across releases. The report is written as JSON.
+**
+** Usage: triton_bench [--samples <src/samples>] [--runs <n>] [--suite <processing|solver|ast>] [--output <file>]
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#include <version.hpp>
+
+#include "bench.hpp"
+
+
+
+/* The number of bytes allocated through operator new */
+static triton::uint64 allocated = 0;
+
+
+void* operator new(std::size_t size) {
+  void* ptr = std::malloc(size ? size : 1);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  allocated += size;
+  return ptr;
+}
+
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  void* ptr = std::malloc(size ? size : 1);
+  if (ptr != nullptr)
+    allocated += size;
+  return ptr;
+}
+
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+
+namespace bench {
+
+  triton::uint64 allocatedBytes(void) {
+    return allocated;
+  }
+
+
+  double elapsed(std::chrono::high_resolution_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  }
+
+};
+
+
+/* Returns a JSON string */
+static std::string quote(const std::string& str) {
+  std::ostringstream out;
+
+  out << "\"";
+  for (char c : str) {
+    if (c == '"' || c == '\\')
+      out << "\\" << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+    else
+      out << c;
+  }
+  out << "\"";
+
+  return out.str();
+}
+
+
+/* Returns the median of the runs */
+static double median(std::vector<double> seconds) {
+  if (seconds.empty())
+    return 0;
+  std::sort(seconds.begin(), seconds.end());
+  if (seconds.size() % 2)
+    return seconds[seconds.size() / 2];
+  return (seconds[seconds.size() / 2 - 1] + seconds[seconds.size() / 2]) / 2;
+}
+
+
+/* Writes the report */
+static void report(std::ostream& out, const bench::Options& options, const std::vector<bench::Result>& results) {
+  out << std::setprecision(9);
+  out << "{" << std::endl;
+  out << "  \"version\": " << quote(std::to_string(triton::MAJOR) + "." + std::to_string(triton::MINOR) + "." + std::to_string(triton::BUILD)) << "," << std::endl;
+  out << "  \"runs\": " << options.runs << "," << std::endl;
+  out << "  \"results\": [" << std::endl;
+
+  for (auto it = results.begin(); it != results.end(); it++) {
+    double med = median(it->seconds);
+
+    out << "    {";
+    out << "\"suite\": " << quote(it->suite) << ", ";
+    out << "\"name\": " << quote(it->name) << ", ";
+    out << "\"unit\": " << quote(it->unit) << ", ";
+    out << "\"count\": " << it->count << ", ";
+    out << "\"median_s\": " << med << ", ";
+    out << "\"min_s\": " << (it->seconds.empty() ? 0 : *std::min_element(it->seconds.begin(), it->seconds.end())) << ", ";
+    out << "\"per_second\": " << (med > 0 ? it->count / med : 0);
+    for (auto metric = it->metrics.begin(); metric != it->metrics.end(); metric++)
+      out << ", " << quote(metric->first) << ": " << metric->second;
+    out << "}" << (it + 1 != results.end() ? "," : "") << std::endl;
+  }
+
+  out << "  ]" << std::endl;
+  out << "}" << std::endl;
+}
+
+
+int main(int ac, const char **av) {
+  std::vector<bench::Result> results;
+  bench::Options options;
+  std::string output;
+  std::string suite;
+
+  options.samples = "src/samples";
+  options.runs    = 5;
+
+  for (int i = 1; i < ac; i++) {
+    if (!std::strcmp(av[i], "--samples") && i + 1 < ac)
+      options.samples = av[++i];
+    else if (!std::strcmp(av[i], "--runs") && i + 1 < ac)
+      options.runs = std::max(1, std::atoi(av[++i]));
+    else if (!std::strcmp(av[i], "--suite") && i + 1 < ac)
+      suite = av[++i];
+    else if (!std::strcmp(av[i], "--output") && i + 1 < ac)
+      output = av[++i];
+    else {
+      std::cerr << "Usage: " << av[0] << " [--samples <src/samples>] [--runs <n>] [--suite <processing|solver|ast>] [--output <file>]" << std::endl;
+      return 1;
+    }
+  }
+
+  try {
+    if (suite.empty() || suite == "processing")
+      bench::processing(options, results);
+    if (suite.empty() || suite == "solver")
+      bench::solver(options, results);
+    if (suite.empty() || suite == "ast")
+      bench::ast(options, results);
+  }
+  catch (const std::exception& e) {
+    std::cerr << "[error] " << e.what() << std::endl;
+    return 1;
+  }
+
+  if (output.empty()) {
+    report(std::cout, options, results);
+    return 0;
+  }
+
+  std::ofstream file(output);
+  if (!file) {
+    std::cerr << "[error] Cannot write " << output << std::endl;
+    return 1;
+  }
+  report(file, options, results);
+
+  return 0;
+}
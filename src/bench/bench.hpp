@@ -0,0 +1,71 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_BENCH_HPP
+#define TRITON_BENCH_HPP
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <tritonTypes.hpp>
+
+
+
+//! The benchmark suite namespace
+namespace bench {
+
+  //! The result of one benchmark.
+  struct Result {
+    //! The suite of the benchmark (processing, solver, ast).
+    std::string suite;
+
+    //! The name of the benchmark.
+    std::string name;
+
+    //! What the operations are (instructions, queries, nodes...).
+    std::string unit;
+
+    //! The number of operations of one run.
+    triton::uint64 count;
+
+    //! The elapsed time of each run in seconds.
+    std::vector<double> seconds;
+
+    //! The additional metrics as <name, value>.
+    std::map<std::string, double> metrics;
+  };
+
+
+  //! The options of the suite.
+  struct Options {
+    //! The path of the src/samples directory.
+    std::string samples;
+
+    //! The number of runs of each benchmark.
+    triton::uint32 runs;
+  };
+
+
+  //! Returns the number of bytes allocated since the start of the process.
+  triton::uint64 allocatedBytes(void);
+
+  //! Returns the elapsed time in seconds since start.
+  double elapsed(std::chrono::high_resolution_clock::time_point start);
+
+  //! Runs the processing benchmarks (symbolic, taint-only, concrete, and symbolic without taint with and without the semantics templates) on the samples.
+  void processing(const Options& options, std::vector<Result>& results);
+
+  //! Runs the solver benchmarks on the samples/smt queries.
+  void solver(const Options& options, std::vector<Result>& results);
+
+  //! Runs the AST builder and dictionary microbenchmarks.
+  void ast(const Options& options, std::vector<Result>& results);
+
+};
+
+#endif /* TRITON_BENCH_HPP */
@@ -0,0 +1,197 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <api.hpp>
+#include <elf.hpp>
+#include <elfEnums.hpp>
+#include <exceptions.hpp>
+#include <x86Specifications.hpp>
+
+#include "bench.hpp"
+
+
+
+namespace bench {
+
+  /* The samples swept, relative to the samples directory */
+  static const char* SAMPLES[] = {
+    "32bits/crackme_xor",
+    "code_coverage/test_atoi",
+    "crackmes/crackme_hash",
+    "crackmes/crackme_regex_fsm",
+    "crackmes/crackme_regex_fsm_obfuscated",
+    "crackmes/crackme_sample",
+    "crackmes/crackme_xor",
+    "ir_test_suite/ir",
+    "others/strlen",
+    "vulns/testSuite",
+    nullptr
+  };
+
+
+  /* The minimal number of instructions processed by a run */
+  static const triton::uint64 MIN_INSTRUCTIONS = 50000;
+
+
+  /* The processing modes */
+  enum mode_e {
+    MODE_SYMBOLIC = 0,
+    MODE_TAINT,
+    MODE_CONCRETE,
+    MODE_UNTAINTED,
+    MODE_TEMPLATES,
+  };
+
+
+  /* An instruction of the sweep */
+  struct Opcode {
+    triton::uint64 address;
+    const triton::uint8* opcodes;
+    triton::uint32 size;
+  };
+
+
+  /* Returns the name of a mode */
+  static inline const char* modeName(mode_e mode) {
+    switch (mode) {
+      case MODE_SYMBOLIC:  return "symbolic";
+      case MODE_TAINT:     return "taint";
+      case MODE_UNTAINTED: return "symbolic_untainted";
+      case MODE_TEMPLATES: return "symbolic_templates";
+      default:             return "concrete";
+    }
+  }
+
+
+  /* Sets up a context for a mode */
+  static inline void setup(triton::API& ctx, triton::arch::architectures_e arch, mode_e mode) {
+    ctx.setArchitecture(arch);
+    ctx.enableSymbolicEngine(mode != MODE_TAINT && mode != MODE_CONCRETE);
+    ctx.enableTaintEngine(mode == MODE_SYMBOLIC || mode == MODE_TAINT);
+    ctx.enableFastForward(mode == MODE_CONCRETE);
+
+    /* The templates need the taint engine off, the untainted mode is their baseline */
+    ctx.enableSymbolicOptimization(triton::engines::symbolic::SEMANTICS_TEMPLATES, mode == MODE_TEMPLATES);
+
+    triton::uint32 sp = (arch == triton::arch::ARCH_X86) ? triton::arch::x86::ID_REG_ESP : triton::arch::x86::ID_REG_RSP;
+    ctx.setConcreteRegisterValue(triton::arch::Register(sp, 0x7fff0000));
+
+    /* Taints the stack pointer so the taint engine has something to spread */
+    if (mode == MODE_TAINT)
+      ctx.taintRegister(triton::arch::Register(sp));
+  }
+
+
+  /* Disassembles linearly the .text section, skipping a byte on undecodable opcodes */
+  static std::vector<Opcode> sweep(const triton::format::elf::Elf& binary, triton::arch::architectures_e arch) {
+    std::vector<Opcode> opcodes;
+    triton::API ctx;
+    triton::API::Scope scope(ctx);
+
+    ctx.setArchitecture(arch);
+
+    for (const auto& section : binary.getSectionHeaders()) {
+      if (section.getName() != ".text")
+        continue;
+
+      if (section.getOffset() + section.getSize() > binary.getSize())
+        break;
+
+      triton::uint64 offset = 0;
+      while (offset < section.getSize()) {
+        Opcode op;
+        triton::arch::Instruction inst;
+
+        op.address = section.getAddr() + offset;
+        op.opcodes = binary.getRaw() + section.getOffset() + offset;
+        op.size    = static_cast<triton::uint32>(std::min<triton::uint64>(section.getSize() - offset, 16));
+
+        try {
+          inst.setOpcodes(op.opcodes, op.size);
+          inst.setAddress(op.address);
+          ctx.disassembly(inst);
+          op.size = inst.getSize();
+          opcodes.push_back(op);
+          offset += op.size;
+        }
+        catch (const triton::exceptions::Exception&) {
+          offset++;
+        }
+      }
+    }
+
+    return opcodes;
+  }
+
+
+  void processing(const Options& options, std::vector<Result>& results) {
+    for (triton::uint32 index = 0; SAMPLES[index]; index++) {
+      triton::format::elf::Elf binary(options.samples + "/" + SAMPLES[index]);
+
+      triton::arch::architectures_e arch = triton::arch::ARCH_X86_64;
+      if (binary.getHeader().getEIClass() == triton::format::elf::ELFCLASS32)
+        arch = triton::arch::ARCH_X86;
+
+      std::vector<Opcode> opcodes = sweep(binary, arch);
+      if (opcodes.empty())
+        continue;
+
+      /* Repeats the sweep so every run has the same and large enough workload */
+      triton::uint64 passes = (MIN_INSTRUCTIONS + opcodes.size() - 1) / opcodes.size();
+
+      for (mode_e mode : {MODE_SYMBOLIC, MODE_TAINT, MODE_CONCRETE, MODE_UNTAINTED, MODE_TEMPLATES}) {
+        Result result;
+        triton::uint64 nodes = 0;
+        triton::uint64 bytes = 0;
+        triton::uint64 hits  = 0;
+
+        result.suite = "processing";
+        result.name  = std::string(SAMPLES[index]) + "/" + modeName(mode);
+        result.unit  = "instructions";
+        result.count = passes * opcodes.size();
+
+        for (triton::uint32 run = 0; run < options.runs; run++) {
+          triton::API ctx;
+          triton::API::Scope scope(ctx);
+
+          setup(ctx, arch, mode);
+
+          triton::usize nodesBefore = ctx.getAstDictionariesStats()["allocatedNodes"];
+          triton::uint64 bytesBefore = allocatedBytes();
+          auto start = std::chrono::high_resolution_clock::now();
+
+          for (triton::uint64 pass = 0; pass < passes; pass++) {
+            for (const auto& op : opcodes) {
+              triton::arch::Instruction inst;
+              inst.setOpcodes(op.opcodes, op.size);
+              inst.setAddress(op.address);
+              try {
+                ctx.processing(inst);
+              }
+              catch (const triton::exceptions::Exception&) {
+                /* Unsupported semantics are part of the workload */
+              }
+            }
+          }
+
+          result.seconds.push_back(elapsed(start));
+          bytes += allocatedBytes() - bytesBefore;
+          nodes += ctx.getAstDictionariesStats()["allocatedNodes"] - nodesBefore;
+          hits  += ctx.getSemanticsTemplatesStats()["hits"];
+        }
+
+        result.metrics["nodes_per_instruction"] = static_cast<double>(nodes) / (options.runs * result.count);
+        result.metrics["bytes_per_instruction"] = static_cast<double>(bytes) / (options.runs * result.count);
+        if (mode == MODE_TEMPLATES)
+          result.metrics["template_hit_ratio"] = static_cast<double>(hits) / (options.runs * result.count);
+        results.push_back(result);
+      }
+    }
+  }
+
+};
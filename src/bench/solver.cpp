@@ -0,0 +1,89 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <z3++.h>
+
+#include "bench.hpp"
+
+
+
+namespace bench {
+
+  /* The queries, relative to the samples directory */
+  static const char* QUERIES[] = {
+    "smt/af.smt2",
+    "smt/cmp.smt2",
+    "smt/firstCharTest.smt2",
+    "smt/jbe.smt2",
+    "smt/jle.smt2",
+    "smt/jnbe.smt2",
+    "smt/jnle.smt2",
+    "smt/of.smt2",
+    "smt/pf.smt2",
+    "smt/sf.smt2",
+    nullptr
+  };
+
+
+  /* The number of times a query is solved by a run */
+  static const triton::uint32 REPEAT = 20;
+
+
+  /* Returns the declarations and assertions of a query, without its commands */
+  static std::string load(const std::string& path) {
+    std::ifstream file(path);
+    std::ostringstream formula;
+    std::string line;
+
+    if (!file)
+      throw std::runtime_error("Cannot read " + path);
+
+    while (std::getline(file, line)) {
+      if (line.find("(check-sat") != std::string::npos || line.find("(get-model") != std::string::npos)
+        continue;
+      formula << line << std::endl;
+    }
+
+    return formula.str();
+  }
+
+
+  void solver(const Options& options, std::vector<Result>& results) {
+    for (triton::uint32 index = 0; QUERIES[index]; index++) {
+      std::string formula = load(options.samples + "/" + QUERIES[index]);
+      triton::uint32 sat = 0;
+      Result result;
+
+      result.suite = "solver";
+      result.name  = QUERIES[index];
+      result.unit  = "queries";
+      result.count = REPEAT;
+
+      for (triton::uint32 run = 0; run < options.runs; run++) {
+        z3::context ctx;
+
+        /* Like the solver engine, each query is parsed and solved from scratch */
+        auto start = std::chrono::high_resolution_clock::now();
+        for (triton::uint32 query = 0; query < REPEAT; query++) {
+          z3::solver solver(ctx);
+          Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.c_str(), 0, 0, 0, 0, 0, 0);
+          solver.add(z3::expr(ctx, ast));
+          if (solver.check() == z3::sat)
+            sat++;
+        }
+        result.seconds.push_back(elapsed(start));
+      }
+
+      result.metrics["sat"] = (sat == options.runs * REPEAT) ? 1 : 0;
+      results.push_back(result);
+    }
+  }
+
+};
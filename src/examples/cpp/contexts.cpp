@@ -0,0 +1,58 @@
+/*
+** Two independent contexts in the same process. Each context owns its CPU,
+** engines and AST dictionaries, and an API::Scope makes it current for the
+** builders while it is used.
+*/
+
+#include <iostream>
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+int main(int ac, const char **av) {
+  API ctx32, ctx64;
+
+  /* A 32-bit analysis */
+  {
+    API::Scope scope(ctx32);
+    Instruction inst;
+
+    ctx32.setArchitecture(ARCH_X86);
+    ctx32.convertRegisterToSymbolicVariable(Register(x86::ID_REG_EAX));
+
+    inst.setOpcodes((unsigned char *)"\x83\xc0\x01", 3); /* add eax, 1 */
+    inst.setAddress(0x8048000);
+    ctx32.processing(inst);
+
+    std::cout << "[x86]    " << inst << std::endl;
+    for (unsigned int i = 0; i != inst.symbolicExpressions.size(); i++)
+      std::cout << "\t" << inst.symbolicExpressions[i] << std::endl;
+  }
+
+  /* A 64-bit analysis, unaffected by the first one */
+  {
+    API::Scope scope(ctx64);
+    Instruction inst;
+
+    ctx64.setArchitecture(ARCH_X86_64);
+    ctx64.taintRegister(Register(x86::ID_REG_RBX));
+
+    inst.setOpcodes((unsigned char *)"\x48\x89\xd8", 3); /* mov rax, rbx */
+    inst.setAddress(0x400000);
+    ctx64.processing(inst);
+
+    std::cout << "[x86-64] " << inst << std::endl;
+    for (unsigned int i = 0; i != inst.symbolicExpressions.size(); i++)
+      std::cout << "\t" << inst.symbolicExpressions[i] << std::endl;
+    std::cout << "\trax tainted: " << ctx64.isRegisterTainted(Register(x86::ID_REG_RAX)) << std::endl;
+  }
+
+  /* The contexts are still alive and independent */
+  std::cout << "x86 variables: " << ctx32.getSymbolicVariables().size() << std::endl;
+  std::cout << "x86-64 variables: " << ctx64.getSymbolicVariables().size() << std::endl;
+
+  return 0;
+}
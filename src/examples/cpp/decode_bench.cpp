@@ -0,0 +1,71 @@
+#include <chrono>
+#include <iostream>
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x48\x8b\x05\xb8\x13\x00\x00", 7}, /* mov        rax, QWORD PTR [rip+0x13b8] */
+  {0x400007, (unsigned char *)"\x48\x8d\x34\xc3",             4}, /* lea        rsi, [rbx+rax*8]            */
+  {0x40000b, (unsigned char *)"\x67\x48\x8D\x74\xC3\x0A",     6}, /* lea        rsi, [ebx+eax*8+0xa]        */
+  {0x400011, (unsigned char *)"\x66\x0F\xD7\xD1",             4}, /* pmovmskb   edx, xmm1                   */
+  {0x400015, (unsigned char *)"\x89\xd0",                     2}, /* mov        eax, edx                    */
+  {0x400017, (unsigned char *)"\x80\xf4\x99",                 3}, /* xor        ah, 0x99                    */
+  {0x40001a, (unsigned char *)"\x48\x31\xc0",                 3}, /* xor        rax, rax                    */
+  {0x40001d, (unsigned char *)"\xf0\x80\x30\x99",             4}, /* lock xor   byte ptr [rax], 0x99        */
+  {0x400021, (unsigned char *)"\xf3\xa4",                     2}, /* rep movsb                              */
+  {0x400023, (unsigned char *)"\x0F\x87\x00\x00\x00\x00",     6}, /* ja         11                          */
+  {0x0,      nullptr,                                         0}
+};
+
+
+/* Returns the elapsed time in nanoseconds since start */
+static double elapsed(std::chrono::high_resolution_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+
+int main(int ac, const char **av) {
+  const unsigned int iterations = 100000;
+  unsigned int decoded = 0;
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  /* Decode-to-Instruction latency, without the disassembly cache */
+  auto start = std::chrono::high_resolution_clock::now();
+  for (unsigned int n = 0; n < iterations; n++) {
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst;
+      inst.setOpcodes(trace[i].inst, trace[i].size);
+      inst.setAddress(trace[i].addr);
+      api.clearDisassemblyCache();
+      api.disassembly(inst);
+      decoded++;
+    }
+  }
+  std::cout << "decode:   " << elapsed(start) / decoded << " ns/instruction" << std::endl;
+
+  /* Register construction latency */
+  decoded = 0;
+  start = std::chrono::high_resolution_clock::now();
+  for (unsigned int n = 0; n < iterations; n++) {
+    for (uint32 regId = x86::ID_REG_INVALID + 1; regId < x86::ID_REG_LAST_ITEM; regId++) {
+      Register reg(regId);
+      decoded += reg.getSize();
+    }
+  }
+  std::cout << "register: " << elapsed(start) / (iterations * (x86::ID_REG_LAST_ITEM - 1)) << " ns/register" << std::endl;
+
+  return (decoded == 0);
+}
+
@@ -0,0 +1,60 @@
+/*
+** A parallel exploration of a small check on two input bytes. Each worker
+** owns its context, and the workers share the seeds, the coverage and the
+** solver cache.
+*/
+
+#include <iostream>
+#include <triton/api.hpp>
+#include <triton/explorer.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::exploration;
+
+
+/*
+**   0x400000: mov al, byte ptr [0x1000]
+**   0x400007: cmp al, 0x41
+**   0x400009: jne 0x40001d
+**   0x40000b: mov al, byte ptr [0x1001]
+**   0x400012: cmp al, 0x42
+**   0x400014: jne 0x40001d
+**   0x400016: mov eax, 1
+**   0x40001b: jmp 0x40001f
+**   0x40001d: xor eax, eax
+*/
+static const unsigned char code[] =
+  "\x8a\x04\x25\x00\x10\x00\x00\x3c\x41\x75\x12"
+  "\x8a\x04\x25\x01\x10\x00\x00\x3c\x42\x75\x07"
+  "\xb8\x01\x00\x00\x00\xeb\x02\x31\xc0";
+
+
+int main(int ac, const char **av) {
+  std::vector<uint64> inputs = {0x1000, 0x1001};
+
+  Explorer explorer([](API& ctx) {
+    ctx.setArchitecture(ARCH_X86_64);
+    ctx.setConcreteMemoryAreaValue(0x400000, code, sizeof(code) - 1);
+  }, inputs, 0x400000);
+
+  explorer.addStopAddress(0x40001f);
+  explorer.setWorkers(4);
+  explorer.setReportCallback([](const ExplorerStats& stats) {
+    std::cout << "[" << stats.elapsed << "s] runs: " << stats.runs
+              << ", branches: " << stats.branches
+              << ", branches/s: " << stats.coveragePerSecond
+              << ", queries: " << stats.queries
+              << ", cache hits: " << stats.cacheHits << std::endl;
+  }, std::chrono::milliseconds(100));
+
+  explorer.explore();
+
+  for (const auto& branch : explorer.getCoverage())
+    std::cout << std::hex << "0x" << branch.first << " -> 0x" << branch.second << std::dec << std::endl;
+
+  for (const auto& seed : explorer.getSeeds())
+    std::cout << "seed: " << std::hex << (int)seed[0] << " " << (int)seed[1] << std::dec << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/*
+** The generational search of the crackme used by the Python example
+** code_coverage_crackme_xor.py. The search loop runs natively: each
+** seed is expanded by negating its symbolized branches, and the children
+** which cover new branches are expanded first.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <triton/api.hpp>
+#include <triton/generationalSearch.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::exploration;
+
+
+/* int check(char *ptr), located at 0x40056d */
+static const unsigned char code[] =
+  "\x55"                              /* push    rbp */
+  "\x48\x89\xe5"                      /* mov     rbp,rsp */
+  "\x48\x89\x7d\xe8"                  /* mov     QWORD PTR [rbp-0x18],rdi */
+  "\xc7\x45\xfc\x00\x00\x00\x00"      /* mov     DWORD PTR [rbp-0x4],0x0 */
+  "\xeb\x3f"                          /* jmp     4005bd <check+0x50> */
+  "\x8b\x45\xfc"                      /* mov     eax,DWORD PTR [rbp-0x4] */
+  "\x48\x63\xd0"                      /* movsxd  rdx,eax */
+  "\x48\x8b\x45\xe8"                  /* mov     rax,QWORD PTR [rbp-0x18] */
+  "\x48\x01\xd0"                      /* add     rax,rdx */
+  "\x0f\xb6\x00"                      /* movzx   eax,BYTE PTR [rax] */
+  "\x0f\xbe\xc0"                      /* movsx   eax,al */
+  "\x83\xe8\x01"                      /* sub     eax,0x1 */
+  "\x83\xf0\x55"                      /* xor     eax,0x55 */
+  "\x89\xc1"                          /* mov     ecx,eax */
+  "\x48\x8b\x15\xa0\x0a\x20\x00"      /* mov     rdx,QWORD PTR [rip+0x200aa0] */
+  "\x8b\x45\xfc"                      /* mov     eax,DWORD PTR [rbp-0x4] */
+  "\x48\x98"                          /* cdqe */
+  "\x48\x01\xd0"                      /* add     rax,rdx */
+  "\x0f\xb6\x00"                      /* movzx   eax,BYTE PTR [rax] */
+  "\x0f\xbe\xc0"                      /* movsx   eax,al */
+  "\x39\xc1"                          /* cmp     ecx,eax */
+  "\x74\x07"                          /* je      4005b9 <check+0x4c> */
+  "\xb8\x01\x00\x00\x00"              /* mov     eax,0x1 */
+  "\xeb\x0f"                          /* jmp     4005c8 <check+0x5b> */
+  "\x83\x45\xfc\x01"                  /* add     DWORD PTR [rbp-0x4],0x1 */
+  "\x83\x7d\xfc\x04"                  /* cmp     DWORD PTR [rbp-0x4],0x4 */
+  "\x7e\xbb"                          /* jle     40057e <check+0x11> */
+  "\xb8\x00\x00\x00\x00"              /* mov     eax,0x0 */
+  "\x5d"                              /* pop     rbp */
+  "\xc3";                             /* ret */
+
+
+static void setup(API& ctx) {
+  ctx.setArchitecture(ARCH_X86_64);
+  ctx.setConcreteMemoryAreaValue(0x40056d, code, sizeof(code) - 1);
+
+  /* The serial pointer and the serial */
+  ctx.setConcreteMemoryAreaValue(0x601040, {0x00, 0x00, 0x90});
+  ctx.setConcreteMemoryAreaValue(0x900000, {0x31, 0x3e, 0x3d, 0x26, 0x31});
+
+  /* The argument and the stack */
+  ctx.setConcreteRegisterValue(Register(x86::ID_REG_RDI, 0x1000));
+  ctx.setConcreteRegisterValue(Register(x86::ID_REG_RSP, 0x7fffffff));
+  ctx.setConcreteRegisterValue(Register(x86::ID_REG_RBP, 0x7fffffff));
+}
+
+
+int main(int ac, const char **av) {
+  std::vector<uint64> inputs = {0x1000, 0x1001, 0x1002, 0x1003, 0x1004};
+  std::stringstream state;
+
+  GenerationalSearch search(api, setup, inputs, 0x40056d);
+  search.addStopAddress(0x4005c9);
+
+  /* Runs a few seeds, saves the state and resumes with a new search */
+  search.explore(4);
+  search.saveState(state);
+
+  GenerationalSearch resumed(api, setup, inputs, 0x40056d);
+  resumed.addStopAddress(0x4005c9);
+  resumed.loadState(state);
+  resumed.explore();
+
+  std::cout << "runs: " << resumed.getRuns() << ", queries: " << resumed.getQueries() << std::endl;
+  for (const auto& seed : resumed.getSeeds()) {
+    std::cout << "seed: ";
+    for (auto byte : seed)
+      std::cout << (byte >= 0x20 && byte < 0x7f ? static_cast<char>(byte) : '.');
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
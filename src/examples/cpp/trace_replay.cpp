@@ -0,0 +1,68 @@
+/*
+** Writes a small binary trace, as a tracer would do on the traced machine,
+** then replays it natively on a context. Each record holds the address,
+** the opcodes and the register and memory values seen before the
+** instruction.
+*/
+
+#include <iostream>
+#include <triton/api.hpp>
+#include <triton/replayEngine.hpp>
+#include <triton/traceWriter.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::replay;
+using namespace triton::format::trace;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x48\x8b\x05\xb8\x13\x00\x00", 7}, /* mov rax, QWORD PTR [rip+0x13b8] */
+  {0x400007, (unsigned char *)"\x48\x8d\x34\xc3",             4}, /* lea rsi, [rbx+rax*8]            */
+  {0x40000b, (unsigned char *)"\x48\x31\xc8",                 3}, /* xor rax, rcx                    */
+  {0x0,      nullptr,                                         0}
+};
+
+
+int main(int ac, const char **av) {
+  /* The capture side */
+  {
+    API::Scope scope(api);
+    TraceWriter writer("trace.bin", ARCH_X86_64);
+
+    api.setArchitecture(ARCH_X86_64);
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst;
+      inst.setOpcodes(trace[i].inst, trace[i].size);
+      inst.setAddress(trace[i].addr);
+      inst.updateContext(Register(x86::ID_REG_RBX, 0x1000));
+      inst.updateContext(Register(x86::ID_REG_RCX, 0x4142434445464748));
+      if (i == 0)
+        inst.updateContext(MemoryAccess(0x4013bf, QWORD_SIZE, 0xdeadbeef));
+      writer.write(inst);
+    }
+
+    std::cout << "instructions written: " << writer.getCount() << std::endl;
+  }
+
+  /* The analysis side, on a fresh context */
+  API ctx;
+  ReplayEngine replay(ctx);
+
+  replay.setCallback([](API& ctx, Instruction& inst) {
+    std::cout << inst << std::endl;
+    for (unsigned int i = 0; i != inst.symbolicExpressions.size(); i++)
+      std::cout << "\t" << inst.symbolicExpressions[i] << std::endl;
+  });
+
+  std::cout << "instructions replayed: " << replay.replay("trace.bin") << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+** Indexes a trace with checkpoints, then replays its segments in parallel.
+** Each segment computes a taint summary on its own context, and the
+** summaries are composed once all segments are done.
+*/
+
+#include <iostream>
+#include <vector>
+#include <triton/api.hpp>
+#include <triton/segmentReplayer.hpp>
+#include <triton/traceIndex.hpp>
+#include <triton/traceWriter.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::replay;
+using namespace triton::format::trace;
+
+
+/*
+**   0x400000: mov rax, qword ptr [rsi]
+**   0x400003: xor rax, rcx
+**   0x400006: mov qword ptr [rdi], rax
+**   0x400009: add rsi, 8
+**   0x40000d: add rdi, 8
+*/
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op loop[] = {
+  {0x400000, (unsigned char *)"\x48\x8b\x06",     3},
+  {0x400003, (unsigned char *)"\x48\x31\xc8",     3},
+  {0x400006, (unsigned char *)"\x48\x89\x07",     3},
+  {0x400009, (unsigned char *)"\x48\x83\xc6\x08", 4},
+  {0x40000d, (unsigned char *)"\x48\x83\xc7\x08", 4},
+  {0x0,      nullptr,                             0}
+};
+
+
+int main(int ac, const char **av) {
+  /* A trace of 100000 iterations, the source buffer is read from the trace */
+  {
+    API::Scope scope(api);
+    TraceWriter writer("segments.bin", ARCH_X86_64);
+
+    api.setArchitecture(ARCH_X86_64);
+    for (unsigned int i = 0; i < 100000; i++) {
+      for (unsigned int j = 0; loop[j].inst; j++) {
+        Instruction inst;
+        inst.setOpcodes(loop[j].inst, loop[j].size);
+        inst.setAddress(loop[j].addr);
+        if (i == 0 && j == 0) {
+          inst.updateContext(Register(x86::ID_REG_RSI, 0x10000000));
+          inst.updateContext(Register(x86::ID_REG_RDI, 0x20000000));
+          inst.updateContext(Register(x86::ID_REG_RCX, 0x5555555555555555));
+        }
+        if (j == 0)
+          inst.updateContext(MemoryAccess(0x10000000 + i * 8, QWORD_SIZE, i));
+        writer.write(inst);
+      }
+    }
+  }
+
+  /* A checkpoint every 50000 instructions */
+  API ctx;
+  TraceIndex index;
+  index.build(ctx, "segments.bin", 50000);
+  index.save("segments.idx");
+  std::cout << "checkpoints: " << index.getCheckpoints().size() << std::endl;
+
+  /* Per-segment summaries: the number of bytes tainted by rcx */
+  SegmentReplayer replayer("segments.bin", index);
+  std::vector<usize> summaries(index.getCheckpoints().size());
+
+  replayer.setBeginCallback([](API& ctx, const TraceSegment& segment) {
+    ctx.taintRegister(Register(x86::ID_REG_RCX));
+  });
+
+  replayer.setEndCallback([&summaries](API& ctx, const TraceSegment& segment) {
+    for (const auto& area : ctx.getTaintedMemoryAreas())
+      summaries[segment.index] += area.second;
+  });
+
+  replayer.run();
+
+  usize total = 0;
+  for (const auto& segment : replayer.getSegments()) {
+    std::cout << "segment " << segment.index << " [" << segment.first << ":" << segment.first + segment.count << "[: "
+              << summaries[segment.index] << " tainted bytes" << std::endl;
+    total += summaries[segment.index];
+  }
+  std::cout << "total: " << total << " tainted bytes" << std::endl;
+
+  return 0;
+}
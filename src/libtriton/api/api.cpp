@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <fstream>
 #include <list>
 #include <map>
 #include <new>
@@ -176,14 +177,63 @@ $ make
 
 Note that only the version `71313` of Pin is supported.
 
+<hr>
+\subsection bench_install_sec Benchmark suite
+
+The `bench` target builds and runs the benchmark suite over the bundled samples: instructions per second of the symbolic,
+taint-only and concrete processing with the AST nodes and bytes allocated per instruction, of the symbolic processing without
+taint with and without the `SEMANTICS_TEMPLATES` optimization, the solver latency on the
+`src/samples/smt` queries and the AST builder and dictionaries microbenchmarks. The results are written as JSON into
+`build/bench.json`, each benchmark reporting the median and minimal time of several runs of a fixed workload.
+
+~~~~~~~~~~~~~{.sh}
+$ cd build
+$ make bench
+$ ./triton_bench --suite solver --runs 10
+~~~~~~~~~~~~~
+
+<hr>
+\subsection profiling_install_sec Profiling counters
+
+The `-DPROFILING=on` flag compiles the hot-path hooks of the triton::engines::profiling::Profiler into the library. Each context then
+counts the calls and cycles of each stage of the processing (decoding, semantics, simplification callbacks, AST recording, taint
+spreading and post IR garbage collection), the instructions, AST nodes and symbolic expressions of each opcode, and may record the
+stages as a Chrome trace-event JSON timeline. Without this flag, the hooks are compiled out and all counters stay at zero.
+
+~~~~~~~~~~~~~{.sh}
+$ cmake -DPROFILING=on ..
+$ make
+~~~~~~~~~~~~~
+
 */
 
 
 
 namespace triton {
 
-  /* External access to the API */
-  triton::API api = triton::API();
+  /* The default context */
+  triton::API api;
+
+  /* The current context of each thread, nullptr for the default one */
+  static thread_local triton::API* currentApi = nullptr;
+
+
+  API::Scope::Scope(const API& api) {
+    this->previous = currentApi;
+    currentApi     = const_cast<API*>(&api);
+  }
+
+
+  API::Scope::~Scope() {
+    currentApi = this->previous;
+  }
+
+
+  API& API::getCurrent(void) {
+    if (currentApi == nullptr)
+      return triton::api;
+    return *currentApi;
+  }
 
 
   API::API() {
@@ -194,6 +244,7 @@ namespace triton {
     this->irBuilder           = nullptr;
     this->solver              = nullptr;
     this->symbolic            = nullptr;
+    this->snapshot            = nullptr;
     this->taint               = nullptr;
     this->z3Interface         = nullptr;
   }
@@ -231,6 +282,7 @@ namespace triton {
 
 
   void API::setArchitecture(triton::uint32 arch) {
+    Scope scope(*this);
     /* Setup and init the targeted architecture */
     this->arch.setArchitecture(arch);
 
@@ -242,123 +294,182 @@ namespace triton {
 
 
   void API::clearArchitecture(void) {
+    Scope scope(*this);
     this->checkArchitecture();
+    if (this->snapshot)
+      this->snapshot->removeAllSnapshots();
     this->arch.clearArchitecture();
   }
 
 
   bool API::isCpuFlag(triton::uint32 regId) const {
+    Scope scope(*this);
     return this->arch.isFlag(regId);
   }
 
 
   bool API::isCpuRegister(triton::uint32 regId) const {
+    Scope scope(*this);
     return this->arch.isRegister(regId);
   }
 
 
   bool API::isCpuRegisterValid(triton::uint32 regId) const {
+    Scope scope(*this);
     return this->arch.isRegisterValid(regId);
   }
 
 
   triton::uint32 API::cpuRegisterSize(void) const {
+    Scope scope(*this);
     return this->arch.registerSize();
   }
 
 
   triton::uint32 API::cpuRegisterBitSize(void) const {
+    Scope scope(*this);
     return this->arch.registerBitSize();
   }
 
 
   triton::uint32 API::cpuNumberOfRegisters(void) const {
+    Scope scope(*this);
     return this->arch.numberOfRegisters();
   }
 
 
-  triton::arch::RegisterSpecification API::getRegisterSpecification(triton::uint32 regId) const {
+  const triton::arch::RegisterSpecification& API::getRegisterSpecification(triton::uint32 regId) const {
+    Scope scope(*this);
     return this->arch.getRegisterSpecification(regId);
   }
 
 
   std::set<triton::arch::Register*> API::getAllRegisters(void) const {
+    Scope scope(*this);
     this->checkArchitecture();
     return this->arch.getAllRegisters();
   }
 
 
   std::set<triton::arch::Register*> API::getParentRegisters(void) const {
+    Scope scope(*this);
     this->checkArchitecture();
     return this->arch.getParentRegisters();
   }
 
 
   triton::uint8 API::getConcreteMemoryValue(triton::uint64 addr) const {
+    Scope scope(*this);
     return this->arch.getConcreteMemoryValue(addr);
   }
 
 
   triton::uint512 API::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+    Scope scope(*this);
     return this->arch.getConcreteMemoryValue(mem, execCallbacks);
   }
 
 
   std::vector<triton::uint8> API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
+    Scope scope(*this);
     return this->arch.getConcreteMemoryAreaValue(baseAddr, size, execCallbacks);
   }
 
 
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
+    Scope scope(*this);
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
 
 
   void API::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
+    Scope scope(*this);
     this->arch.setConcreteMemoryValue(addr, value);
   }
 
 
   void API::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->arch.setConcreteMemoryValue(mem);
   }
 
 
   void API::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
+    Scope scope(*this);
     this->arch.setConcreteMemoryAreaValue(baseAddr, values);
   }
 
 
   void API::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+    Scope scope(*this);
     this->arch.setConcreteMemoryAreaValue(baseAddr, area, size);
   }
 
 
   void API::setConcreteRegisterValue(const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->arch.setConcreteRegisterValue(reg);
   }
 
 
   bool API::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
+    Scope scope(*this);
     return this->arch.isMemoryMapped(baseAddr, size);
   }
 
 
   void API::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
+    Scope scope(*this);
     this->arch.unmapMemory(baseAddr, size);
   }
 
 
+  std::vector<triton::uint64> API::getDirtyMemoryPages(void) const {
+    Scope scope(*this);
+    return this->arch.getDirtyMemoryPages();
+  }
+
+
+  void API::clearDirtyMemoryPages(void) {
+    Scope scope(*this);
+    this->arch.clearDirtyMemoryPages();
+  }
+
+
   void API::disassembly(triton::arch::Instruction& inst) const {
+    Scope scope(*this);
+    TRITON_PROFILE_STAGE(this->profiler, triton::engines::profiling::STAGE_DISASSEMBLY);
     this->checkArchitecture();
     this->arch.disassembly(inst);
   }
 
 
+  void API::invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size) {
+    Scope scope(*this);
+    this->checkArchitecture();
+    this->arch.invalidateDisassemblyCache(baseAddr, size);
+  }
+
+
+  void API::clearDisassemblyCache(void) {
+    Scope scope(*this);
+    this->checkArchitecture();
+    this->arch.clearDisassemblyCache();
+  }
+
+
+  std::map<std::string, triton::usize> API::getDisassemblyCacheStats(void) const {
+    Scope scope(*this);
+    this->checkArchitecture();
+    return this->arch.getDisassemblyCacheStats();
+  }
+
+
 
   /* Processing API ================================================================================ */
 
   void API::initEngines(void) {
+    Scope scope(*this);
     this->checkArchitecture();
 
     this->symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(&this->arch, &this->callbacks);
@@ -384,11 +495,18 @@ namespace triton {
     this->z3Interface = new(std::nothrow) triton::ast::Z3Interface(this->symbolic);
     if (this->z3Interface == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
+    this->snapshot = new(std::nothrow) triton::engines::snapshot::SnapshotEngine(&this->arch, this->symbolic, this->taint, this->astGarbageCollector);
+    if (this->snapshot == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
   }
 
 
   void API::removeEngines(void) {
+    Scope scope(*this);
     if (this->isArchitectureValid()) {
+      /* Snapshots must be discarded before the engines they refer to */
+      delete this->snapshot;
       delete this->astGarbageCollector;
       delete this->irBuilder;
       delete this->solver;
@@ -398,6 +516,7 @@ namespace triton {
 
       this->astGarbageCollector = nullptr;
       this->irBuilder           = nullptr;
+      this->snapshot            = nullptr;
       this->solver              = nullptr;
       this->symbolic            = nullptr;
       this->taint               = nullptr;
@@ -407,6 +526,7 @@ namespace triton {
 
 
   void API::resetEngines(void) {
+    Scope scope(*this);
     if (this->isArchitectureValid()) {
       this->removeEngines();
       this->initEngines();
@@ -416,12 +536,62 @@ namespace triton {
 
 
   bool API::processing(triton::arch::Instruction& inst) {
+    Scope scope(*this);
+    TRITON_PROFILE_INSTRUCTION(this->profiler, inst);
     this->checkArchitecture();
     this->disassembly(inst);
     return this->buildSemantics(inst);
   }
 
 
+  triton::usize API::run(triton::uint64 addr, triton::usize maxInstructions, const std::set<triton::uint64>& stopAddresses) {
+    Scope scope(*this);
+    return this->runInstructions(addr, maxInstructions, stopAddresses, false);
+  }
+
+
+  triton::usize API::processBlock(triton::uint64 addr, triton::usize maxInstructions, const std::set<triton::uint64>& stopAddresses) {
+    Scope scope(*this);
+    return this->runInstructions(addr, maxInstructions, stopAddresses, true);
+  }
+
+
+  triton::usize API::runInstructions(triton::uint64 addr, triton::usize maxInstructions, const std::set<triton::uint64>& stopAddresses, bool block) {
+    /* The longest x86 instruction is 15 bytes */
+    const triton::usize fetchSize = 16;
+    triton::arch::Instruction inst;
+    triton::usize count = 0;
+
+    this->checkArchitecture();
+    const triton::arch::Register& pc = this->arch.getProgramCounter();
+
+    while (maxInstructions == 0 || count < maxInstructions) {
+      if (count && stopAddresses.find(addr) != stopAddresses.end())
+        break;
+
+      /* The memory callbacks may provide the code, so the mapping is checked after the fetch */
+      std::vector<triton::uint8> opcodes = this->getConcreteMemoryAreaValue(addr, fetchSize);
+      if (!this->isMemoryMapped(addr))
+        break;
+
+      /* The same instruction is reused, its storage is kept */
+      inst.reset();
+      inst.setOpcodes(opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+      inst.setAddress(addr);
+
+      bool supported = this->processing(inst);
+      count++;
+
+      if (!supported || (block && inst.isControlFlow()))
+        break;
+
+      addr = this->getConcreteRegisterValue(pc).convert_to<triton::uint64>();
+    }
+
+    return count;
+  }
+
+
 
   /* IR builder API ================================================================================= */
 
@@ -432,11 +602,68 @@ namespace triton {
 
 
   bool API::buildSemantics(triton::arch::Instruction& inst) {
+    Scope scope(*this);
     this->checkIrBuilder();
     return this->irBuilder->buildSemantics(inst);
   }
 
 
+  void API::enableFastForward(bool flag) {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    this->irBuilder->enableFastForward(flag);
+  }
+
+
+  bool API::isFastForwardEnabled(void) const {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    return this->irBuilder->isFastForwardEnabled();
+  }
+
+
+  void API::addFastForwardStop(triton::uint64 addr) {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    this->irBuilder->addFastForwardStop(addr);
+  }
+
+
+  void API::clearFastForwardStops(void) {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    this->irBuilder->clearFastForwardStops();
+  }
+
+
+  void API::setFastForwardLimit(triton::usize limit) {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    this->irBuilder->setFastForwardLimit(limit);
+  }
+
+
+  triton::usize API::getFastForwardCount(void) const {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    return this->irBuilder->getFastForwardCount();
+  }
+
+
+  void API::clearSemanticsTemplates(void) {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    this->irBuilder->clearSemanticsTemplates();
+  }
+
+
+  std::map<std::string, triton::usize> API::getSemanticsTemplatesStats(void) const {
+    Scope scope(*this);
+    this->checkIrBuilder();
+    return this->irBuilder->getSemanticsTemplatesStats();
+  }
+
+
 
   /* AST garbage collector API ====================================================================== */
 
@@ -447,60 +674,74 @@ namespace triton {
 
 
   void API::freeAllAstNodes(void) {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
+    if (this->snapshot)
+      this->snapshot->removeAllSnapshots();
     this->astGarbageCollector->freeAllAstNodes();
   }
 
 
   void API::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->freeAstNodes(nodes);
   }
 
 
   void API::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, root);
   }
 
 
   triton::ast::AbstractNode* API::recordAstNode(triton::ast::AbstractNode* node) {
+    Scope scope(*this);
+    TRITON_PROFILE_STAGE(this->profiler, triton::engines::profiling::STAGE_AST_RECORDING);
+    TRITON_PROFILE_COUNT(this->profiler.recordNode());
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->recordAstNode(node);
   }
 
 
   void API::recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node) {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->recordVariableAstNode(name, node);
   }
 
 
   const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAllocatedAstNodes();
   }
 
 
   const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNodes();
   }
 
 
   triton::ast::AbstractNode* API::getAstVariableNode(const std::string& name) const {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNode(name);
   }
 
 
   void API::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->setAllocatedAstNodes(nodes);
   }
 
 
   void API::setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes) {
+    Scope scope(*this);
     this->checkAstGarbageCollector();
     this->astGarbageCollector->setAstVariableNodes(nodes);
   }
@@ -509,12 +750,20 @@ namespace triton {
   /* AST representation API ========================================================================= */
 
   triton::uint32 API::getAstRepresentationMode(void) const {
-    return triton::ast::representations::astRepresentation.getMode();
+    Scope scope(*this);
+    return this->astRepresentation.getMode();
   }
 
 
   void API::setAstRepresentationMode(triton::uint32 mode) {
-    triton::ast::representations::astRepresentation.setMode(mode);
+    Scope scope(*this);
+    this->astRepresentation.setMode(mode);
+  }
+
+
+  std::ostream& API::printAstRepresentation(std::ostream& stream, triton::ast::AbstractNode* node) {
+    Scope scope(*this);
+    return this->astRepresentation.print(stream, node);
   }
 
 
@@ -522,55 +771,89 @@ namespace triton {
   /* Callbacks API ================================================================================= */
 
   void API::addCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
+    Scope scope(*this);
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+    Scope scope(*this);
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+    Scope scope(*this);
     this->callbacks.addCallback(cb);
   }
 
 
   void API::addCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
+    Scope scope(*this);
     this->callbacks.addCallback(cb);
   }
 
 
   void API::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
+    Scope scope(*this);
     this->callbacks.addCallback(cb);
   }
 
 
   #ifdef TRITON_PYTHON_BINDINGS
   void API::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    Scope scope(*this);
     this->callbacks.addCallback(function, kind);
   }
   #endif
 
 
   void API::removeAllCallbacks(void) {
+    Scope scope(*this);
     this->callbacks.removeAllCallbacks();
   }
 
 
   void API::removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
+    Scope scope(*this);
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+    Scope scope(*this);
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+    Scope scope(*this);
     this->callbacks.removeCallback(cb);
   }
 
 
   void API::removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
+    Scope scope(*this);
     this->callbacks.removeCallback(cb);
   }
 
 
   void API::removeCallback(triton::callbacks::symbolicSimplificationCallback cb) {
+    Scope scope(*this);
     this->callbacks.removeCallback(cb);
   }
 
 
   #ifdef TRITON_PYTHON_BINDINGS
   void API::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    Scope scope(*this);
     this->callbacks.removeCallback(function, kind);
   }
   #endif
 
 
   triton::ast::AbstractNode* API::processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const {
+    Scope scope(*this);
     if (this->callbacks.isDefined)
       return this->callbacks.processCallbacks(kind, node);
     return node;
@@ -578,12 +861,14 @@ namespace triton {
 
 
   void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const {
+    Scope scope(*this);
     if (this->callbacks.isDefined)
       this->callbacks.processCallbacks(kind, mem);
   }
 
 
   void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const {
+    Scope scope(*this);
     if (this->callbacks.isDefined)
       this->callbacks.processCallbacks(kind, reg);
   }
@@ -599,192 +884,224 @@ namespace triton {
 
 
   triton::engines::symbolic::SymbolicEngine* API::getSymbolicEngine(void) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic;
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertExpressionToSymbolicVariable(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarComment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->convertExpressionToSymbolicVariable(exprId, symVarSize, symVarComment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->convertMemoryToSymbolicVariable(mem, symVarComment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->convertRegisterToSymbolicVariable(reg, symVarComment);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::OperandWrapper& op) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicOperand(op);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicOperand(inst, op);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicImmediate(imm);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicImmediate(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicImmediate(inst, imm);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicMemory(mem);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicMemory(inst, mem);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicRegister(const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicRegister(reg);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicRegister(inst, reg);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::newSymbolicExpression(triton::ast::AbstractNode* node, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::newSymbolicVariable(triton::uint32 varSize, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEF, 0, varSize, comment);
   }
 
 
   void API::removeSymbolicExpression(triton::usize symExprId) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->removeSymbolicExpression(symExprId);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicExpression(inst, node, dst, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicFlagExpression(inst, node, flag, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
   }
 
 
   void API::assignSymbolicExpressionToMemory(triton::engines::symbolic::SymbolicExpression* se, const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->assignSymbolicExpressionToMemory(se, mem);
   }
 
 
   void API::assignSymbolicExpressionToRegister(triton::engines::symbolic::SymbolicExpression* se, const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->assignSymbolicExpressionToRegister(se, reg);
   }
 
 
   triton::usize API::getSymbolicMemoryId(triton::uint64 addr) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryId(addr);
   }
 
 
   std::map<triton::arch::Register, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicRegisters(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisters();
   }
 
 
   std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicMemory(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemory();
   }
 
 
   triton::usize API::getSymbolicRegisterId(const triton::arch::Register& reg) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterId(reg);
   }
 
 
   triton::uint8 API::getSymbolicMemoryValue(triton::uint64 address) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryValue(address);
   }
 
 
   triton::uint512 API::getSymbolicMemoryValue(const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryValue(mem);
   }
 
 
   std::vector<triton::uint8> API::getSymbolicMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryAreaValue(baseAddr, size);
   }
 
 
   triton::uint512 API::getSymbolicRegisterValue(const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterValue(reg);
   }
 
 
   std::map<std::string, triton::usize> API::getAstDictionariesStats(void) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getAstDictionariesStats();
   }
 
 
   triton::ast::AbstractNode* API::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
+    Scope scope(*this);
     this->checkSymbolic();
     if (z3 == true)
       node = this->processZ3Simplification(node);
@@ -794,132 +1111,196 @@ namespace triton {
 
 
   triton::engines::symbolic::SymbolicExpression* API::getSymbolicExpressionFromId(triton::usize symExprId) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressionFromId(symExprId);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::getSymbolicVariableFromId(triton::usize symVarId) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariableFromId(symVarId);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::getSymbolicVariableFromName(const std::string& symVarName) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariableFromName(symVarName);
   }
 
 
   const std::vector<triton::engines::symbolic::PathConstraint>& API::getPathConstraints(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getPathConstraints();
   }
 
 
   triton::ast::AbstractNode* API::getPathConstraintsAst(void) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getPathConstraintsAst();
   }
 
 
   void API::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->addPathConstraint(inst, expr);
   }
 
 
   void API::clearPathConstraints(void) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->clearPathConstraints();
   }
 
 
   void API::enableSymbolicEngine(bool flag) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->enable(flag);
   }
 
 
   void API::enableSymbolicOptimization(enum triton::engines::symbolic::optimization_e opti, bool flag) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->enableOptimization(opti, flag);
   }
 
 
   bool API::isSymbolicEngineEnabled(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isEnabled();
   }
 
 
   bool API::isSymbolicExpressionIdExists(triton::usize symExprId) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isSymbolicExpressionIdExists(symExprId);
   }
 
 
   bool API::isSymbolicOptimizationEnabled(enum triton::engines::symbolic::optimization_e opti) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isOptimizationEnabled(opti);
   }
 
 
   bool API::isMemorySymbolized(const triton::arch::MemoryAccess& mem) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isMemorySymbolized(mem);
   }
 
 
   bool API::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isMemorySymbolized(addr, size);
   }
 
 
   bool API::isRegisterSymbolized(const triton::arch::Register& reg) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->isRegisterSymbolized(reg);
   }
 
 
   void API::concretizeAllMemory(void) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeAllMemory();
   }
 
 
   void API::concretizeAllRegister(void) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeAllRegister();
   }
 
 
   void API::concretizeMemory(const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeMemory(mem);
   }
 
 
   void API::concretizeMemory(triton::uint64 addr) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeMemory(addr);
   }
 
 
   void API::concretizeRegister(const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkSymbolic();
     this->symbolic->concretizeRegister(reg);
   }
 
 
+  triton::uint64 API::getConcretizationLimit(enum triton::engines::symbolic::concretization_e kind) const {
+    Scope scope(*this);
+    this->checkSymbolic();
+    return this->symbolic->getConcretizationLimit(kind);
+  }
+
+
+  void API::setConcretizationLimit(enum triton::engines::symbolic::concretization_e kind, triton::uint64 limit) {
+    Scope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->setConcretizationLimit(kind, limit);
+  }
+
+
+  void API::addConcretizationRange(triton::uint64 start, triton::uint64 end) {
+    Scope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->addConcretizationRange(start, end);
+  }
+
+
+  void API::clearConcretizationRanges(void) {
+    Scope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->clearConcretizationRanges();
+  }
+
+
+  const std::vector<triton::engines::symbolic::ConcretizationEvent>& API::getConcretizationEvents(void) const {
+    Scope scope(*this);
+    this->checkSymbolic();
+    return this->symbolic->getConcretizationEvents();
+  }
+
+
+  void API::clearConcretizationEvents(void) {
+    Scope scope(*this);
+    this->checkSymbolic();
+    this->symbolic->clearConcretizationEvents();
+  }
+
+
   triton::ast::AbstractNode* API::getFullAst(triton::ast::AbstractNode* node) {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getFullAst(node);
   }
 
 
   triton::ast::AbstractNode* API::getAstFromId(triton::usize symExprId) {
+    Scope scope(*this);
     this->checkSymbolic();
     triton::engines::symbolic::SymbolicExpression* symExpr = this->getSymbolicExpressionFromId(symExprId);
     return symExpr->getAst();
@@ -927,31 +1308,43 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::getFullAstFromId(triton::usize symExprId) {
+    Scope scope(*this);
     this->checkSymbolic();
     triton::ast::AbstractNode* partialAst = this->getAstFromId(symExprId);
     return this->getFullAst(partialAst);
   }
 
 
-  std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> API::sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr) {
+  std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> API::sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr, triton::usize depth) {
+    Scope scope(*this);
     this->checkSymbolic();
-    return this->symbolic->sliceExpressions(expr);
+    return this->symbolic->sliceExpressions(expr, depth);
   }
 
 
   std::list<triton::engines::symbolic::SymbolicExpression*> API::getTaintedSymbolicExpressions(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getTaintedSymbolicExpressions();
   }
 
 
+  std::list<triton::engines::symbolic::SymbolicVariable*> API::getSymbolicVariablesFromAst(triton::ast::AbstractNode* node) const {
+    Scope scope(*this);
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicVariablesFromAst(node);
+  }
+
+
   const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& API::getSymbolicExpressions(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressions();
   }
 
 
   const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& API::getSymbolicVariables(void) const {
+    Scope scope(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariables();
   }
@@ -967,12 +1360,14 @@ namespace triton {
 
 
   std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode* node) const {
+    Scope scope(*this);
     this->checkSolver();
     return this->solver->getModel(node);
   }
 
 
   std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
+    Scope scope(*this);
     this->checkSolver();
     return this->solver->getModels(node, limit);
   }
@@ -988,18 +1383,132 @@ namespace triton {
 
 
   triton::uint512 API::evaluateAstViaZ3(triton::ast::AbstractNode* node) const {
+    Scope scope(*this);
     this->checkZ3Interface();
     return this->z3Interface->evaluate(node);
   }
 
 
   triton::ast::AbstractNode* API::processZ3Simplification(triton::ast::AbstractNode* node) const {
+    Scope scope(*this);
     this->checkZ3Interface();
     return this->z3Interface->simplify(node);
   }
 
 
 
+  /* Snapshot engine API =========================================================================== */
+
+  void API::checkSnapshot(void) const {
+    if (!this->snapshot)
+      throw triton::exceptions::API("API::checkSnapshot(): Snapshot engine is undefined.");
+  }
+
+
+  triton::engines::snapshot::SnapshotEngine* API::getSnapshotEngine(void) {
+    Scope scope(*this);
+    this->checkSnapshot();
+    return this->snapshot;
+  }
+
+
+  triton::usize API::takeSnapshot(void) {
+    Scope scope(*this);
+    this->checkSnapshot();
+    return this->snapshot->takeSnapshot();
+  }
+
+
+  void API::restoreSnapshot(triton::usize id) {
+    Scope scope(*this);
+    this->checkSnapshot();
+    this->snapshot->restoreSnapshot(id);
+  }
+
+
+  void API::removeSnapshot(triton::usize id) {
+    Scope scope(*this);
+    this->checkSnapshot();
+    this->snapshot->removeSnapshot(id);
+  }
+
+
+  void API::removeAllSnapshots(void) {
+    Scope scope(*this);
+    this->checkSnapshot();
+    this->snapshot->removeAllSnapshots();
+  }
+
+
+  bool API::isSnapshotExists(triton::usize id) const {
+    Scope scope(*this);
+    this->checkSnapshot();
+    return this->snapshot->isSnapshotExists(id);
+  }
+
+
+  triton::usize API::getNumberOfSnapshots(void) const {
+    Scope scope(*this);
+    this->checkSnapshot();
+    return this->snapshot->getNumberOfSnapshots();
+  }
+
+
+
+  /* Profiling API ================================================================================= */
+
+  bool API::isProfilingAvailable(void) const {
+    return triton::engines::profiling::Profiler::isAvailable();
+  }
+
+
+  triton::engines::profiling::Profiler& API::getProfiler(void) {
+    return this->profiler;
+  }
+
+
+  std::map<std::string, triton::uint64> API::getProfilingStats(void) const {
+    Scope scope(*this);
+    std::map<std::string, triton::uint64> stats = this->profiler.getStats();
+
+    /* The variables alive, the profiler only counts the created ones */
+    if (this->symbolic)
+      stats["variablesAlive"] = this->symbolic->getSymbolicVariables().size();
+
+    return stats;
+  }
+
+
+  const std::map<triton::uint32, triton::engines::profiling::OpcodeProfile>& API::getProfilingOpcodesStats(void) const {
+    Scope scope(*this);
+    return this->profiler.getOpcodes();
+  }
+
+
+  void API::resetProfiling(void) {
+    Scope scope(*this);
+    this->profiler.reset();
+  }
+
+
+  void API::enableProfilingTrace(bool flag) {
+    Scope scope(*this);
+    this->profiler.enableTrace(flag);
+  }
+
+
+  void API::saveProfilingTrace(const std::string& path) const {
+    Scope scope(*this);
+    std::ofstream out(path);
+
+    if (!out)
+      throw triton::exceptions::API("API::saveProfilingTrace(): Cannot open " + path + ".");
+
+    this->profiler.exportTrace(out);
+  }
+
+
+
   /* Taint engine API ============================================================================== */
 
   void API::checkTaint(void) const {
@@ -1009,66 +1518,105 @@ namespace triton {
 
 
   triton::engines::taint::TaintEngine* API::getTaintEngine(void) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint;
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::set<triton::uint64> API::getTaintedMemory(void) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
+  std::vector<std::pair<triton::uint64, triton::usize>> API::getTaintedMemoryAreas(void) const {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->getTaintedMemoryAreas();
+  }
+
+
   const std::set<triton::arch::Register>& API::getTaintedRegisters(void) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->getTaintedRegisters();
   }
 
 
+  std::vector<triton::uint32> API::getMemoryLabels(triton::uint64 addr) const {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->getMemoryLabels(addr);
+  }
+
+
+  std::vector<triton::uint32> API::getMemoryLabels(const triton::arch::MemoryAccess& mem) const {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->getMemoryLabels(mem);
+  }
+
+
+  std::vector<triton::uint32> API::getRegisterLabels(const triton::arch::Register& reg) const {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->getRegisterLabels(reg);
+  }
+
+
   void API::enableTaintEngine(bool flag) {
+    Scope scope(*this);
     this->checkTaint();
     this->taint->enable(flag);
   }
 
 
   bool API::isTaintEngineEnabled(void) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->isEnabled();
   }
 
 
   bool API::isTainted(const triton::arch::OperandWrapper& op) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->isTainted(op);
   }
 
 
   bool API::isMemoryTainted(triton::uint64 addr, uint32 size) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->isMemoryTainted(addr, size);
   }
 
 
   bool API::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->isMemoryTainted(mem);
   }
 
 
   bool API::isRegisterTainted(const triton::arch::Register& reg) const {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->isRegisterTainted(reg);
   }
 
 
   bool API::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->setTaint(op, flag);
   }
 
 
   bool API::setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag) {
+    Scope scope(*this);
     this->checkTaint();
     this->taint->setTaintMemory(mem, flag);
     return flag;
@@ -1076,127 +1624,169 @@ namespace triton {
 
 
   bool API::setTaintRegister(const triton::arch::Register& reg, bool flag) {
+    Scope scope(*this);
     this->checkTaint();
     this->taint->setTaintRegister(reg, flag);
     return flag;
   }
 
 
+  bool API::labelMemory(triton::uint64 addr, triton::uint32 label) {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->labelMemory(addr, label);
+  }
+
+
+  bool API::labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->labelMemory(mem, label);
+  }
+
+
+  bool API::labelRegister(const triton::arch::Register& reg, triton::uint32 label) {
+    Scope scope(*this);
+    this->checkTaint();
+    return this->taint->labelRegister(reg, label);
+  }
+
+
   bool API::taintMemory(triton::uint64 addr) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintMemory(addr);
   }
 
 
   bool API::taintMemory(const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintMemory(mem);
   }
 
 
   bool API::taintRegister(const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintRegister(reg);
   }
 
 
   bool API::untaintMemory(triton::uint64 addr) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->untaintMemory(addr);
   }
 
 
   bool API::untaintMemory(const triton::arch::MemoryAccess& mem) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->untaintMemory(mem);
   }
 
 
   bool API::untaintRegister(const triton::arch::Register& reg) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->untaintRegister(reg);
   }
 
 
   bool API::taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnion(op1, op2);
   }
 
 
   bool API::taintAssignment(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignment(op1, op2);
   }
 
 
   bool API::taintUnionMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnionMemoryImmediate(memDst);
   }
 
 
   bool API::taintUnionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnionMemoryMemory(memDst, memSrc);
   }
 
 
   bool API::taintUnionMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnionMemoryRegister(memDst, regSrc);
   }
 
 
   bool API::taintUnionRegisterImmediate(const triton::arch::Register& regDst) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnionRegisterImmediate(regDst);
   }
 
 
   bool API::taintUnionRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnionRegisterMemory(regDst, memSrc);
   }
 
 
   bool API::taintUnionRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintUnionRegisterRegister(regDst, regSrc);
   }
 
 
   bool API::taintAssignmentMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignmentMemoryImmediate(memDst);
   }
 
 
   bool API::taintAssignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignmentMemoryMemory(memDst, memSrc);
   }
 
 
   bool API::taintAssignmentMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignmentMemoryRegister(memDst, regSrc);
   }
 
 
   bool API::taintAssignmentRegisterImmediate(const triton::arch::Register& regDst) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignmentRegisterImmediate(regDst);
   }
 
 
   bool API::taintAssignmentRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignmentRegisterMemory(regDst, memSrc);
   }
 
 
   bool API::taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+    Scope scope(*this);
     this->checkTaint();
     return this->taint->taintAssignmentRegisterRegister(regDst, regSrc);
   }
@@ -49,6 +49,9 @@ namespace triton {
       /* Setup global variables */
       this->arch = arch;
 
+      /* Previous snapshots refer to the previous CPU */
+      this->discardSnapshots(0);
+
       /* Allocate and init the good arch */
       switch (this->arch) {
         case triton::arch::ARCH_X86_64:
@@ -130,13 +133,13 @@ namespace triton {
     }
 
 
-    triton::arch::RegisterSpecification Architecture::getRegisterSpecification(triton::uint32 regId) const {
-      triton::arch::RegisterSpecification ret;
+    const triton::arch::RegisterSpecification& Architecture::getRegisterSpecification(triton::uint32 regId) const {
+      static const triton::arch::RegisterSpecification invalid;
 
-      if (this->cpu)
-        ret = this->cpu->getRegisterSpecification(regId);
+      if (!this->cpu)
+        return invalid;
 
-      return ret;
+      return this->cpu->getRegisterSpecification(regId);
     }
 
 
@@ -154,6 +157,13 @@ namespace triton {
     }
 
 
+    const triton::arch::Register& Architecture::getProgramCounter(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getProgramCounter(): You must define an architecture.");
+      return this->cpu->getProgramCounter();
+    }
+
+
     void Architecture::disassembly(triton::arch::Instruction& inst) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::disassembly(): You must define an architecture.");
@@ -161,6 +171,27 @@ namespace triton {
     }
 
 
+    void Architecture::invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::invalidateDisassemblyCache(): You must define an architecture.");
+      this->cpu->invalidateDisassemblyCache(baseAddr, size);
+    }
+
+
+    void Architecture::clearDisassemblyCache(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::clearDisassemblyCache(): You must define an architecture.");
+      this->cpu->clearDisassemblyCache();
+    }
+
+
+    std::map<std::string, triton::usize> Architecture::getDisassemblyCacheStats(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getDisassemblyCacheStats(): You must define an architecture.");
+      return this->cpu->getDisassemblyCacheStats();
+    }
+
+
     triton::uint8 Architecture::getConcreteMemoryValue(triton::uint64 addr) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteMemoryValue(): You must define an architecture.");
@@ -192,6 +223,7 @@ namespace triton {
     void Architecture::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
+      this->journalMemory(addr, 1);
       this->cpu->setConcreteMemoryValue(addr, value);
     }
 
@@ -199,6 +231,7 @@ namespace triton {
     void Architecture::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
+      this->journalMemory(mem.getAddress(), mem.getSize());
       this->cpu->setConcreteMemoryValue(mem);
     }
 
@@ -206,6 +239,7 @@ namespace triton {
     void Architecture::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
+      this->journalMemory(baseAddr, values.size());
       this->cpu->setConcreteMemoryAreaValue(baseAddr, values);
     }
 
@@ -213,6 +247,7 @@ namespace triton {
     void Architecture::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
+      this->journalMemory(baseAddr, size);
       this->cpu->setConcreteMemoryAreaValue(baseAddr, area, size);
     }
 
@@ -220,6 +255,7 @@ namespace triton {
     void Architecture::setConcreteRegisterValue(const triton::arch::Register& reg) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteRegisterValue(): You must define an architecture.");
+      this->journalRegister(reg);
       this->cpu->setConcreteRegisterValue(reg);
     }
 
@@ -234,9 +270,94 @@ namespace triton {
     void Architecture::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::unmapMemory(): You must define an architecture.");
+      this->journalMemory(baseAddr, size);
       this->cpu->unmapMemory(baseAddr, size);
     }
 
+
+    std::vector<triton::uint64> Architecture::getDirtyMemoryPages(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getDirtyMemoryPages(): You must define an architecture.");
+      return this->cpu->getDirtyMemoryPages();
+    }
+
+
+    void Architecture::clearDirtyMemoryPages(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::clearDirtyMemoryPages(): You must define an architecture.");
+      this->cpu->clearDirtyMemoryPages();
+    }
+
+
+
+    void Architecture::journalMemory(triton::uint64 baseAddr, triton::usize size) {
+      if (this->snapshots.empty())
+        return;
+
+      for (triton::usize index = 0; index < size; index++) {
+        triton::uint64 addr = baseAddr + index;
+        if (this->cpu->isMemoryMapped(addr))
+          this->memoryJournal.push_back(std::make_pair(addr, this->cpu->getConcreteMemoryValue(addr)));
+        else
+          this->memoryJournal.push_back(std::make_pair(addr, -1));
+      }
+    }
+
+
+    void Architecture::journalRegister(const triton::arch::Register& reg) {
+      if (this->snapshots.empty())
+        return;
+
+      triton::arch::Register old(reg);
+      old.setConcreteValue(this->cpu->getConcreteRegisterValue(reg, false));
+      this->registerJournal.push_back(old);
+    }
+
+
+    void Architecture::takeSnapshot(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::takeSnapshot(): You must define an architecture.");
+      this->snapshots.push_back(std::make_pair(this->memoryJournal.size(), this->registerJournal.size()));
+    }
+
+
+    void Architecture::restoreSnapshot(triton::usize index) {
+      if (index >= this->snapshots.size())
+        throw triton::exceptions::Architecture("Architecture::restoreSnapshot(): Invalid snapshot index.");
+
+      const std::pair<triton::usize, triton::usize>& mark = this->snapshots[index];
+
+      /* Unwind the memory journal */
+      while (this->memoryJournal.size() > mark.first) {
+        const std::pair<triton::uint64, triton::sint32>& entry = this->memoryJournal.back();
+        if (entry.second == -1)
+          this->cpu->unmapMemory(entry.first);
+        else
+          this->cpu->setConcreteMemoryValue(entry.first, static_cast<triton::uint8>(entry.second));
+        this->memoryJournal.pop_back();
+      }
+
+      /* Unwind the register journal */
+      while (this->registerJournal.size() > mark.second) {
+        this->cpu->setConcreteRegisterValue(this->registerJournal.back());
+        this->registerJournal.pop_back();
+      }
+
+      this->snapshots.resize(index + 1);
+    }
+
+
+    void Architecture::discardSnapshots(triton::usize index) {
+      if (index >= this->snapshots.size())
+        return;
+
+      this->snapshots.resize(index);
+      if (this->snapshots.empty()) {
+        this->memoryJournal.clear();
+        this->registerJournal.clear();
+      }
+    }
+
   }; /* arch namespace */
 }; /* triton namespace */
 
@@ -26,16 +26,6 @@ namespace triton {
     }
 
 
-    BitsVector::BitsVector(const BitsVector &copy) {
-      this->high = copy.high;
-      this->low  = copy.low;
-    }
-
-
-    BitsVector::~BitsVector() {
-    }
-
-
     std::pair<triton::uint32, triton::uint32> BitsVector::getPair(void) const {
       return std::make_pair(this->high, this->low);
     }
@@ -103,12 +93,6 @@ namespace triton {
     }
 
 
-    void BitsVector::operator=(const BitsVector& other) {
-      this->high = other.high;
-      this->low  = other.low;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const BitsVector& bv) {
       stream << "bv[" << bv.getHigh() << ".." << bv.getLow() << "]";
       return stream;
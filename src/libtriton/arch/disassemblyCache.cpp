@@ -0,0 +1,124 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <disassemblyCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DisassemblyCache::DisassemblyCache() {
+      this->clear();
+    }
+
+
+    bool DisassemblyCache::load(triton::arch::Instruction& inst) {
+      auto it = this->entries.find(inst.getAddress());
+
+      if (it == this->entries.end() ||
+          inst.getSize() < it->second.opcodes.size() ||
+          std::memcmp(inst.getOpcodes(), it->second.opcodes.data(), it->second.opcodes.size()) != 0) {
+        this->misses++;
+        return false;
+      }
+
+      const Entry& entry = it->second;
+
+      inst.setDisassembly(entry.disassembly);
+      inst.setSize(static_cast<triton::uint32>(entry.opcodes.size()));
+      inst.setType(entry.type);
+      inst.setPrefix(entry.prefix);
+
+      for (auto op = entry.operands.begin(); op != entry.operands.end(); op++) {
+        /* The concrete value of a register depends on the current state */
+        if (op->getType() == triton::arch::OP_REG)
+          inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(op->getConstRegister().getId())));
+        else
+          inst.operands.push_back(*op);
+      }
+
+      if (entry.branch)
+        inst.setBranch(true);
+
+      if (entry.controlFlow)
+        inst.setControlFlow(true);
+
+      this->hits++;
+      return true;
+    }
+
+
+    void DisassemblyCache::store(const triton::arch::Instruction& inst) {
+      Entry& entry = this->entries[inst.getAddress()];
+
+      entry.opcodes.assign(inst.getOpcodes(), inst.getOpcodes() + inst.getSize());
+      entry.disassembly = inst.getDisassembly();
+      entry.type        = inst.getType();
+      entry.prefix      = inst.getPrefix();
+      entry.operands    = inst.operands;
+      entry.branch      = inst.isBranch();
+      entry.controlFlow = inst.isControlFlow();
+
+      if (inst.getSize() > this->maxSize)
+        this->maxSize = inst.getSize();
+    }
+
+
+    void DisassemblyCache::invalidate(triton::uint64 baseAddr, triton::usize size) {
+      if (size == 0 || this->entries.empty())
+        return;
+
+      /* Two ranges overlap if one of them starts inside the other */
+      auto overlaps = [&](triton::uint64 addr, triton::usize length) {
+        return (addr - baseAddr < size || baseAddr - addr < length);
+      };
+
+      /* An entry overlapping the range starts at most maxSize - 1 bytes before it */
+      triton::uint64 start = baseAddr - (this->maxSize - 1);
+      triton::uint64 count = size + (this->maxSize - 1);
+
+      if (count >= this->entries.size()) {
+        for (auto it = this->entries.begin(); it != this->entries.end();) {
+          if (overlaps(it->first, it->second.opcodes.size()))
+            it = this->entries.erase(it);
+          else
+            it++;
+        }
+        return;
+      }
+
+      for (triton::uint64 offset = 0; offset < count; offset++) {
+        auto it = this->entries.find(start + offset);
+        if (it != this->entries.end() && overlaps(it->first, it->second.opcodes.size()))
+          this->entries.erase(it);
+      }
+    }
+
+
+    void DisassemblyCache::clear(void) {
+      this->entries.clear();
+      this->maxSize = 0;
+      this->hits    = 0;
+      this->misses  = 0;
+    }
+
+
+    std::map<std::string, triton::usize> DisassemblyCache::getStats(void) const {
+      std::map<std::string, triton::usize> stats;
+
+      stats["entries"] = this->entries.size();
+      stats["hits"]    = this->hits;
+      stats["misses"]  = this->misses;
+
+      return stats;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
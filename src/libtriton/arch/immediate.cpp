@@ -50,15 +50,6 @@ namespace triton {
     }
 
 
-    Immediate::Immediate(const Immediate& other) : BitsVector(other) {
-      this->copy(other);
-    }
-
-
-    Immediate::~Immediate() {
-    }
-
-
     triton::uint64 Immediate::getValue(void) const {
       return this->value;
     }
@@ -94,17 +85,6 @@ namespace triton {
     }
 
 
-    void Immediate::operator=(const Immediate& other) {
-      BitsVector::operator=(other);
-      this->copy(other);
-    }
-
-
-    void Immediate::copy(const Immediate& other) {
-      this->value = other.value;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const Immediate& imm) {
       stream << "0x"
              << std::hex << imm.getValue()
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 
 #include <exceptions.hpp>
@@ -16,6 +17,16 @@
 namespace triton {
   namespace arch {
 
+    /* Inserts an access into a sorted vector, unless the same access is already there */
+    template <typename T>
+    static inline void insertAccess(std::vector<std::pair<T, triton::ast::AbstractNode*>>& accesses, const T& object, triton::ast::AbstractNode* node) {
+      std::pair<T, triton::ast::AbstractNode*> access(object, node);
+      auto it = std::lower_bound(accesses.begin(), accesses.end(), access);
+      if (it == accesses.end() || access < *it)
+        accesses.insert(it, access);
+    }
+
+
     Instruction::Instruction() {
       this->address         = 0;
       this->branch          = false;
@@ -55,10 +66,13 @@ namespace triton {
       this->branch              = other.branch;
       this->conditionTaken      = other.conditionTaken;
       this->controlFlow         = other.controlFlow;
+      this->disassembly         = other.disassembly;
       this->loadAccess          = other.loadAccess;
       this->memoryAccess        = other.memoryAccess;
       this->operands            = other.operands;
       this->prefix              = other.prefix;
+      this->readImmediates      = other.readImmediates;
+      this->readRegisters       = other.readRegisters;
       this->registerState       = other.registerState;
       this->size                = other.size;
       this->storeAccess         = other.storeAccess;
@@ -66,11 +80,9 @@ namespace triton {
       this->tainted             = other.tainted;
       this->tid                 = other.tid;
       this->type                = other.type;
+      this->writtenRegisters    = other.writtenRegisters;
 
       std::memcpy(this->opcodes, other.opcodes, sizeof(this->opcodes));
-
-      this->disassembly.clear();
-      this->disassembly.str(other.disassembly.str());
     }
 
 
@@ -99,8 +111,8 @@ namespace triton {
     }
 
 
-    std::string Instruction::getDisassembly(void) const {
-      return this->disassembly.str();
+    const std::string& Instruction::getDisassembly(void) const {
+      return this->disassembly;
     }
 
 
@@ -132,27 +144,27 @@ namespace triton {
     }
 
 
-    const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getLoadAccess(void) const {
+    const std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getLoadAccess(void) const {
       return this->loadAccess;
     }
 
 
-    const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getStoreAccess(void) const {
+    const std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getStoreAccess(void) const {
       return this->storeAccess;
     }
 
 
-    const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getReadRegisters(void) const {
+    const std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getReadRegisters(void) const {
       return this->readRegisters;
     }
 
 
-    const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getWrittenRegisters(void) const {
+    const std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getWrittenRegisters(void) const {
       return this->writtenRegisters;
     }
 
 
-    const std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& Instruction::getReadImmediates(void) const {
+    const std::vector<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& Instruction::getReadImmediates(void) const {
       return this->readImmediates;
     }
 
@@ -164,35 +176,36 @@ namespace triton {
 
     /* If there is a concrete value recorded, build the appropriate Register. Otherwise, perfrom the analysis on zero. */
     triton::arch::Register Instruction::getRegisterState(triton::uint32 regId) {
-      triton::arch::Register reg(regId);
-      if (this->registerState.find(regId) != this->registerState.end())
-        reg = this->registerState[regId];
-      return reg;
+      auto it = std::lower_bound(this->registerState.begin(), this->registerState.end(), regId,
+                  [](const triton::arch::Register& reg, triton::uint32 id) { return reg.getId() < id; });
+      if (it != this->registerState.end() && it->getId() == regId)
+        return *it;
+      return triton::arch::Register(regId);
     }
 
 
     void Instruction::setLoadAccess(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node) {
-      this->loadAccess.insert(std::make_pair(mem, node));
+      insertAccess(this->loadAccess, mem, node);
     }
 
 
     void Instruction::setStoreAccess(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node) {
-      this->storeAccess.insert(std::make_pair(mem, node));
+      insertAccess(this->storeAccess, mem, node);
     }
 
 
     void Instruction::setReadRegister(const triton::arch::Register& reg, triton::ast::AbstractNode* node) {
-      this->readRegisters.insert(std::make_pair(reg, node));
+      insertAccess(this->readRegisters, reg, node);
     }
 
 
     void Instruction::setWrittenRegister(const triton::arch::Register& reg, triton::ast::AbstractNode* node) {
-      this->writtenRegisters.insert(std::make_pair(reg, node));
+      insertAccess(this->writtenRegisters, reg, node);
     }
 
 
     void Instruction::setReadImmediate(const triton::arch::Immediate& imm, triton::ast::AbstractNode* node) {
-      this->readImmediates.insert(std::make_pair(imm, node));
+      insertAccess(this->readImmediates, imm, node);
     }
 
 
@@ -212,8 +225,7 @@ namespace triton {
 
 
     void Instruction::setDisassembly(const std::string& str) {
-      this->disassembly.clear();
-      this->disassembly.str(str);
+      this->disassembly.assign(str);
     }
 
 
@@ -229,7 +241,12 @@ namespace triton {
 
 
     void Instruction::updateContext(const triton::arch::Register& reg) {
-      this->registerState[reg.getId()] = reg;
+      auto it = std::lower_bound(this->registerState.begin(), this->registerState.end(), reg.getId(),
+                  [](const triton::arch::Register& r, triton::uint32 id) { return r.getId() < id; });
+      if (it != this->registerState.end() && it->getId() == reg.getId())
+        *it = reg;
+      else
+        this->registerState.insert(it, reg);
     }
 
 
@@ -318,6 +335,7 @@ namespace triton {
       this->branch          = false;
       this->conditionTaken  = false;
       this->controlFlow     = false;
+      this->prefix          = 0;
       this->size            = 0;
       this->tainted         = false;
       this->tid             = 0;
@@ -7,11 +7,13 @@
 
 #include <new>
 
+#include <api.hpp>
 #include <exceptions.hpp>
 #include <irBuilder.hpp>
 #include <memoryAccess.hpp>
 #include <operandWrapper.hpp>
 #include <register.hpp>
+#include <x86ConcreteSemantics.hpp>
 #include <x86Semantics.hpp>
 
 
@@ -42,8 +44,12 @@ namespace triton {
       this->symbolicEngine       = symbolicEngine;
       this->taintEngine          = taintEngine;
       this->x86Isa               = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine);
+      this->x86ConcreteIsa       = new(std::nothrow) triton::arch::x86::x86ConcreteSemantics(architecture, symbolicEngine, taintEngine);
+      this->fastForwardFlag      = false;
+      this->fastForwardLimit     = 0;
+      this->fastForwardCount     = 0;
 
-      if (this->x86Isa == nullptr || this->backupSymbolicEngine == nullptr)
+      if (this->x86Isa == nullptr || this->x86ConcreteIsa == nullptr || this->backupSymbolicEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
@@ -51,6 +57,7 @@ namespace triton {
     IrBuilder::~IrBuilder() {
       delete this->backupSymbolicEngine;
       delete this->x86Isa;
+      delete this->x86ConcreteIsa;
     }
 
 
@@ -61,15 +68,15 @@ namespace triton {
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
       /* Stage 1 - Update the context memory */
-      std::list<triton::arch::MemoryAccess>::iterator it1;
+      std::vector<triton::arch::MemoryAccess>::iterator it1;
       for (it1 = inst.memoryAccess.begin(); it1 != inst.memoryAccess.end(); it1++) {
         this->architecture->setConcreteMemoryValue(*it1);
       }
 
       /* Stage 2 - Update the context register */
-      std::map<triton::uint32, triton::arch::Register>::iterator it2;
+      std::vector<triton::arch::Register>::iterator it2;
       for (it2 = inst.registerState.begin(); it2 != inst.registerState.end(); it2++) {
-        this->architecture->setConcreteRegisterValue(it2->second);
+        this->architecture->setConcreteRegisterValue(*it2);
       }
 
       /* Stage 3 - Initialize the target address of memory operands */
@@ -80,20 +87,109 @@ namespace triton {
         }
       }
 
+      /* Fast-forward - Execute the instruction on the concrete state only */
+      if (this->fastForwardFlag) {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_FAST_FORWARD);
+        if (this->fastForward(inst))
+          return true;
+      }
+
       /* Pre IR processing */
       this->preIrInit(inst);
 
       /* Processing */
+      {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_SEMANTICS);
+        switch (this->architecture->getArchitecture()) {
+          case triton::arch::ARCH_X86:
+          case triton::arch::ARCH_X86_64:
+            ret = this->x86Isa->buildSemantics(inst);
+        }
+      }
+
+      /* Post IR processing */
+      {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_POST_IR);
+        this->postIrInit(inst);
+      }
+
+      return ret;
+    }
+
+
+    bool IrBuilder::fastForward(triton::arch::Instruction& inst) {
+      triton::arch::x86::concrete_e status = triton::arch::x86::CONCRETE_UNSUPPORTED;
+
+      /* Switch back to the symbolic processing on a stop address or after the limit */
+      if (this->fastForwardStops.find(inst.getAddress()) != this->fastForwardStops.end() ||
+          (this->fastForwardLimit && this->fastForwardCount >= this->fastForwardLimit)) {
+        this->fastForwardFlag = false;
+        return false;
+      }
+
       switch (this->architecture->getArchitecture()) {
         case triton::arch::ARCH_X86:
         case triton::arch::ARCH_X86_64:
-          ret = this->x86Isa->buildSemantics(inst);
+          status = this->x86ConcreteIsa->execute(inst);
       }
 
-      /* Post IR processing */
-      this->postIrInit(inst);
+      /* Switch back to the symbolic processing when a symbolized or tainted operand is touched */
+      if (status == triton::arch::x86::CONCRETE_SYMBOLIC) {
+        this->fastForwardFlag = false;
+        return false;
+      }
 
-      return ret;
+      /* An unsupported instruction is processed symbolically and the mode goes on */
+      this->fastForwardCount++;
+      if (status == triton::arch::x86::CONCRETE_UNSUPPORTED)
+        return false;
+
+      inst.symbolicExpressions.clear();
+      inst.memoryAccess.clear();
+      inst.registerState.clear();
+
+      return true;
+    }
+
+
+    void IrBuilder::enableFastForward(bool flag) {
+      this->fastForwardFlag  = flag;
+      this->fastForwardCount = 0;
+    }
+
+
+    bool IrBuilder::isFastForwardEnabled(void) const {
+      return this->fastForwardFlag;
+    }
+
+
+    void IrBuilder::addFastForwardStop(triton::uint64 addr) {
+      this->fastForwardStops.insert(addr);
+    }
+
+
+    void IrBuilder::clearFastForwardStops(void) {
+      this->fastForwardStops.clear();
+    }
+
+
+    void IrBuilder::setFastForwardLimit(triton::usize limit) {
+      this->fastForwardLimit = limit;
+    }
+
+
+    triton::usize IrBuilder::getFastForwardCount(void) const {
+      return this->fastForwardCount;
+    }
+
+
+    void IrBuilder::clearSemanticsTemplates(void) {
+      this->x86Isa->clearSemanticsTemplates();
+    }
+
+
+    std::map<std::string, triton::usize> IrBuilder::getSemanticsTemplatesStats(void) const {
+      return this->x86Isa->getSemanticsTemplatesStats();
     }
 
 
@@ -115,7 +211,8 @@ namespace triton {
       inst.memoryAccess.clear();
       inst.registerState.clear();
 
-      ///* Set the taint */
+      /* Set the taint */
+      this->spreadMemoryTaint(inst);
       inst.setTaint();
 
       /*
@@ -154,6 +251,14 @@ namespace triton {
         inst.symbolicExpressions = newVector;
       }
 
+      /*
+       * If a concretization policy is defined, the registers and memory
+       * written by the instruction are concretized when their expression
+       * exceeds the policy.
+       */
+      if (this->symbolicEngine->isEnabled())
+        this->symbolicEngine->applyConcretizationPolicy(inst);
+
       /*
        * If there is no symbolic expression, clean memory operands AST
        * and implicit/explicit semantics AST to avoid memory leak.
@@ -161,7 +266,7 @@ namespace triton {
       if (inst.symbolicExpressions.size() == 0) {
         /* Memory operands */
         for (auto it = inst.operands.begin(); it!= inst.operands.end(); it++) {
-          if (it->getType() == triton::arch::OP_MEM) {
+          if (it->getType() == triton::arch::OP_MEM && it->getMemory().isLeaAstBuilt()) {
             this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, it->getMemory().getLeaAst());
           }
         }
@@ -188,6 +293,33 @@ namespace triton {
     }
 
 
+    void IrBuilder::spreadMemoryTaint(triton::arch::Instruction& inst) {
+      const auto& exprs = inst.symbolicExpressions;
+
+      /*
+       * The taint of a store is computed once per access and assigned to the
+       * expression returned by createSymbolicMemoryExpression(). For a multi-byte
+       * store, this is the concatenation which directly follows its byte
+       * references, from the lowest address backwards.
+       */
+      for (triton::usize index = 0; index < exprs.size(); index++) {
+        const triton::engines::symbolic::SymbolicExpression* expr = exprs[index];
+        const triton::arch::MemoryAccess& mem = expr->getOriginMemory();
+        triton::usize size = mem.getSize();
+
+        if (expr->getKind() != triton::engines::symbolic::UNDEF || size <= 1 || index < size)
+          continue;
+
+        for (triton::usize byte = 0; byte < size; byte++) {
+          triton::engines::symbolic::SymbolicExpression* ref = exprs[index - byte - 1];
+          if (ref->getKind() != triton::engines::symbolic::MEM || ref->getOriginMemory().getAddress() != mem.getAddress() + byte)
+            break;
+          ref->isTainted = expr->isTainted;
+        }
+      }
+    }
+
+
     void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes) {
       for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
         this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
@@ -19,6 +19,10 @@ namespace triton {
       this->address       = 0;
       this->ast           = nullptr;
       this->concreteValue = 0;
+      this->leaBase       = 0;
+      this->leaConcrete   = false;
+      this->leaIndex      = 0;
+      this->leaSegment    = 0;
       this->pcRelative    = 0;
     }
 
@@ -27,6 +31,10 @@ namespace triton {
       this->address       = address;
       this->ast           = nullptr;
       this->concreteValue = concreteValue;
+      this->leaBase       = 0;
+      this->leaConcrete   = false;
+      this->leaIndex      = 0;
+      this->leaSegment    = 0;
       this->pcRelative    = 0;
 
       if (size == 0)
@@ -48,15 +56,6 @@ namespace triton {
     }
 
 
-    MemoryAccess::MemoryAccess(const MemoryAccess& other) : BitsVector(other) {
-      this->copy(other);
-    }
-
-
-    MemoryAccess::~MemoryAccess() {
-    }
-
-
     triton::uint32 MemoryAccess::getAbstractLow(void) const {
       return this->getLow();
     }
@@ -73,16 +72,25 @@ namespace triton {
 
 
     triton::ast::AbstractNode* MemoryAccess::getLeaAst(void) const {
+      if (this->ast == nullptr && this->leaConcrete) {
+        triton::uint32 bitSize = this->getAccessSize();
+        this->ast = this->buildLeaAst(triton::ast::bv(this->leaBase, bitSize), triton::ast::bv(this->leaIndex, bitSize));
+      }
       return this->ast;
     }
 
 
+    bool MemoryAccess::isLeaAstBuilt(void) const {
+      return (this->ast != nullptr);
+    }
+
+
     triton::uint64 MemoryAccess::getBaseValue(void) {
       if (this->pcRelative)
         return this->pcRelative;
 
       else if (this->baseReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->baseReg).convert_to<triton::uint64>();
+        return triton::API::getCurrent().getConcreteRegisterValue(this->baseReg).convert_to<triton::uint64>();
 
       return 0;
     }
@@ -90,35 +98,35 @@ namespace triton {
 
     triton::uint64 MemoryAccess::getIndexValue(void) {
       if (this->indexReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->indexReg).convert_to<triton::uint64>();
+        return triton::API::getCurrent().getConcreteRegisterValue(this->indexReg).convert_to<triton::uint64>();
       return 0;
     }
 
 
     triton::uint64 MemoryAccess::getSegmentValue(void) {
       if (this->segmentReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
+        return triton::API::getCurrent().getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
       return 0;
     }
 
 
-    triton::uint64 MemoryAccess::getScaleValue(void) {
+    triton::uint64 MemoryAccess::getScaleValue(void) const {
       return this->scale.getValue();
     }
 
 
-    triton::uint64 MemoryAccess::getDisplacementValue(void) {
+    triton::uint64 MemoryAccess::getDisplacementValue(void) const {
       return this->displacement.getValue();
     }
 
 
     triton::uint64 MemoryAccess::getAccessMask(void) {
       triton::uint64 mask = -1;
-      return (mask >> (QWORD_SIZE_BIT - triton::api.cpuRegisterBitSize()));
+      return (mask >> (QWORD_SIZE_BIT - triton::API::getCurrent().cpuRegisterBitSize()));
     }
 
 
-    triton::uint32 MemoryAccess::getAccessSize(void) {
+    triton::uint32 MemoryAccess::getAccessSize(void) const {
       if (this->indexReg.isValid())
         return this->indexReg.getBitSize();
 
@@ -128,43 +136,92 @@ namespace triton {
       else if (this->displacement.getBitSize())
         return this->displacement.getBitSize();
 
-      return triton::api.cpuRegisterBitSize();
+      return triton::API::getCurrent().cpuRegisterBitSize();
+    }
+
+
+    triton::ast::AbstractNode* MemoryAccess::buildLeaAst(triton::ast::AbstractNode* base, triton::ast::AbstractNode* index) const {
+      triton::uint32 bitSize          = this->getAccessSize();
+      triton::ast::AbstractNode* node = nullptr;
+
+      node = triton::ast::bvadd(
+               base,
+               triton::ast::bvadd(
+                 triton::ast::bvmul(index, triton::ast::bv(this->getScaleValue(), bitSize)),
+                 triton::ast::bv(this->getDisplacementValue(), bitSize)
+               )
+             );
+
+      /* Use segments as base address instead of selector into the GDT. */
+      if (this->leaSegment) {
+        node = triton::ast::bvadd(
+                 triton::ast::bv(this->leaSegment, this->segmentReg.getBitSize()),
+                 triton::ast::sx((this->segmentReg.getBitSize() - bitSize), node)
+               );
+      }
+
+      return node;
+    }
+
+
+    triton::uint64 MemoryAccess::computeConcreteAddress(void) const {
+      triton::uint32 bitSize = this->getAccessSize();
+      triton::uint64 mask    = -1;
+      triton::uint64 addr    = 0;
+
+      if (bitSize < QWORD_SIZE_BIT)
+        mask = (static_cast<triton::uint64>(1) << bitSize) - 1;
+
+      addr = (this->leaBase + (this->leaIndex * this->getScaleValue()) + this->getDisplacementValue()) & mask;
+
+      /* Use segments as base address instead of selector into the GDT. */
+      if (this->leaSegment) {
+        triton::uint32 segSize = this->segmentReg.getBitSize();
+
+        /* Sign-extend the offset to the size of the segment */
+        if (bitSize < segSize && (addr >> (bitSize - 1)) & 1)
+          addr |= ~mask;
+
+        addr += this->leaSegment;
+        if (segSize < QWORD_SIZE_BIT)
+          addr &= (static_cast<triton::uint64>(1) << segSize) - 1;
+      }
+
+      return addr;
     }
 
 
     void MemoryAccess::initAddress(void) {
       /* Otherwise, try to compute the address */
-      if (triton::api.isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
+      if (triton::API::getCurrent().isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
         triton::arch::Register& base  = this->baseReg;
         triton::arch::Register& index = this->indexReg;
-        triton::uint64 segmentValue   = this->getSegmentValue();
-        triton::uint64 scaleValue     = this->getScaleValue();
-        triton::uint64 dispValue      = this->getDisplacementValue();
         triton::uint32 bitSize        = this->getAccessSize();
-
-        /* Initialize the AST of the memory access (LEA) */
-        this->ast = triton::ast::bvadd(
-                      (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::api.buildSymbolicRegister(base) : triton::ast::bv(0, bitSize))),
-                      triton::ast::bvadd(
-                        triton::ast::bvmul(
-                          (index.isValid() ? triton::api.buildSymbolicRegister(index) : triton::ast::bv(0, bitSize)),
-                          triton::ast::bv(scaleValue, bitSize)
-                        ),
-                        triton::ast::bv(dispValue, bitSize)
-                      )
-                    );
-
-        /* Use segments as base address instead of selector into the GDT. */
-        if (segmentValue) {
-          this->ast = triton::ast::bvadd(
-                        triton::ast::bv(segmentValue, this->segmentReg.getBitSize()),
-                        triton::ast::sx((this->segmentReg.getBitSize() - bitSize), this->ast)
+        bool symBase                  = (!this->pcRelative && base.isValid() && triton::API::getCurrent().isRegisterSymbolized(base));
+        bool symIndex                 = (index.isValid() && triton::API::getCurrent().isRegisterSymbolized(index));
+
+        this->leaSegment = this->getSegmentValue();
+        this->leaBase    = this->getBaseValue();
+        this->leaIndex   = this->getIndexValue();
+
+        /* The AST of the memory access (LEA) is built now only if it depends on a symbolized register */
+        if (symBase || symIndex) {
+          this->leaConcrete = false;
+          this->ast = this->buildLeaAst(
+                        (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::API::getCurrent().buildSymbolicRegister(base) : triton::ast::bv(0, bitSize))),
+                        (index.isValid() ? triton::API::getCurrent().buildSymbolicRegister(index) : triton::ast::bv(0, bitSize))
                       );
         }
 
+        /* Otherwise, the AST is built on demand from the concrete values */
+        else {
+          this->leaConcrete = true;
+          this->ast         = nullptr;
+        }
+
         /* Initialize the address only if it is not already defined */
         if (!this->address)
-          this->address = this->ast->evaluate().convert_to<triton::uint64>();
+          this->address = (this->ast ? this->ast->evaluate().convert_to<triton::uint64>() : this->computeConcreteAddress());
       }
     }
 
@@ -293,25 +350,6 @@ namespace triton {
     }
 
 
-    void MemoryAccess::operator=(const MemoryAccess &other) {
-      BitsVector::operator=(other);
-      this->copy(other);
-    }
-
-
-    void MemoryAccess::copy(const MemoryAccess& other) {
-      this->address       = other.address;
-      this->ast           = other.ast;
-      this->baseReg       = other.baseReg;
-      this->concreteValue = other.concreteValue;
-      this->displacement  = other.displacement;
-      this->indexReg      = other.indexReg;
-      this->pcRelative    = other.pcRelative;
-      this->scale         = other.scale;
-      this->segmentReg    = other.segmentReg;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const MemoryAccess& mem) {
       stream << "[@0x"
              << std::hex << mem.getAddress()
@@ -31,10 +31,6 @@ namespace triton {
     }
 
 
-    OperandWrapper::~OperandWrapper() {
-    }
-
-
     triton::uint32 OperandWrapper::getType(void) const {
       return this->type;
     }
@@ -145,14 +141,6 @@ namespace triton {
     }
 
 
-    void OperandWrapper::operator=(const OperandWrapper& other) {
-      this->imm  = other.imm;
-      this->mem  = other.mem;
-      this->reg  = other.reg;
-      this->type = other.type;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const triton::arch::OperandWrapper& op) {
       switch (op.getType()) {
         case triton::arch::OP_IMM: stream << op.getConstImmediate(); break;
@@ -0,0 +1,279 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include <exceptions.hpp>
+#include <pagedMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the mask of the bits [lo:hi[ of a bitmap word */
+    static inline triton::uint64 bitRange(triton::uint32 lo, triton::uint32 hi) {
+      triton::uint64 upper = (hi == 64) ? static_cast<triton::uint64>(-1) : ((1ULL << hi) - 1);
+      return upper & ~((1ULL << lo) - 1);
+    }
+
+
+    PagedMemory::PagedMemory() {
+      this->lastNumber = 0;
+      this->lastPage   = nullptr;
+    }
+
+
+    PagedMemory::PagedMemory(const PagedMemory& other) {
+      this->lastNumber = 0;
+      this->lastPage   = nullptr;
+      *this = other;
+    }
+
+
+    PagedMemory::~PagedMemory() {
+      this->clear();
+    }
+
+
+    PagedMemory& PagedMemory::operator=(const PagedMemory& other) {
+      if (this == &other)
+        return *this;
+
+      /* The pages replaced by the copy are not released, the dirty state is the one of other */
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+        delete it->second;
+      this->pages.clear();
+      this->lastPage = nullptr;
+      this->released = other.released;
+
+      for (auto it = other.pages.begin(); it != other.pages.end(); it++) {
+        Page* page = new(std::nothrow) Page(*it->second);
+        if (page == nullptr)
+          throw triton::exceptions::Cpu("PagedMemory::operator=(): Not enough memory.");
+        this->pages[it->first] = page;
+      }
+
+      return *this;
+    }
+
+
+    void PagedMemory::clear(void) {
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+        this->released.insert(it->first);
+        delete it->second;
+      }
+      this->pages.clear();
+      this->lastPage = nullptr;
+    }
+
+
+    triton::usize PagedMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    PagedMemory::Page* PagedMemory::findPage(triton::uint64 addr) const {
+      triton::uint64 number = (addr >> PAGE_SHIFT);
+
+      if (this->lastPage != nullptr && this->lastNumber == number)
+        return this->lastPage;
+
+      auto it = this->pages.find(number);
+      if (it == this->pages.end())
+        return nullptr;
+
+      this->lastNumber = number;
+      this->lastPage   = it->second;
+
+      return it->second;
+    }
+
+
+    PagedMemory::Page* PagedMemory::getPage(triton::uint64 addr) {
+      Page* page = this->findPage(addr);
+
+      if (page == nullptr) {
+        /* A new page is zeroed, unmapped cells are read as 0 */
+        page = new(std::nothrow) Page();
+        if (page == nullptr)
+          throw triton::exceptions::Cpu("PagedMemory::getPage(): Not enough memory.");
+        this->pages[addr >> PAGE_SHIFT] = page;
+        this->released.erase(addr >> PAGE_SHIFT);
+        this->lastNumber = (addr >> PAGE_SHIFT);
+        this->lastPage   = page;
+      }
+
+      return page;
+    }
+
+
+    void PagedMemory::freePage(triton::uint64 number) {
+      auto it = this->pages.find(number);
+
+      if (it == this->pages.end())
+        return;
+
+      if (this->lastPage == it->second)
+        this->lastPage = nullptr;
+
+      this->released.insert(number);
+      delete it->second;
+      this->pages.erase(it);
+    }
+
+
+    triton::uint8 PagedMemory::read(triton::uint64 addr) const {
+      const Page* page = this->findPage(addr);
+
+      if (page == nullptr)
+        return 0x00;
+      return page->data[addr & (PAGE_SIZE - 1)];
+    }
+
+
+    void PagedMemory::read(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const {
+      while (size) {
+        triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+        const Page* page      = this->findPage(baseAddr);
+
+        if (page == nullptr)
+          std::memset(area, 0x00, chunk);
+        else
+          std::memcpy(area, page->data + offset, chunk);
+
+        baseAddr += chunk;
+        area     += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, triton::uint8 value) {
+      Page* page            = this->getPage(addr);
+      triton::uint64 offset = (addr & (PAGE_SIZE - 1));
+
+      page->data[offset] = value;
+      page->mapped[offset / 64] |= (1ULL << (offset % 64));
+      page->dirty = true;
+    }
+
+
+    void PagedMemory::write(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      while (size) {
+        triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+        Page* page            = this->getPage(baseAddr);
+
+        std::memcpy(page->data + offset, area, chunk);
+        page->dirty = true;
+
+        for (triton::uint32 bit = offset; bit < offset + chunk;) {
+          triton::uint32 word = bit / 64;
+          triton::uint32 end  = std::min<triton::uint32>(offset + chunk, (word + 1) * 64);
+          page->mapped[word] |= bitRange(bit % 64, end - word * 64);
+          bit = end;
+        }
+
+        baseAddr += chunk;
+        area     += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    bool PagedMemory::isMapped(triton::uint64 baseAddr, triton::usize size) const {
+      while (size) {
+        triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+        const Page* page      = this->findPage(baseAddr);
+
+        if (page == nullptr)
+          return false;
+
+        for (triton::uint32 bit = offset; bit < offset + chunk;) {
+          triton::uint32 word = bit / 64;
+          triton::uint32 end  = std::min<triton::uint32>(offset + chunk, (word + 1) * 64);
+          triton::uint64 mask = bitRange(bit % 64, end - word * 64);
+          if ((page->mapped[word] & mask) != mask)
+            return false;
+          bit = end;
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+
+      return true;
+    }
+
+
+    bool PagedMemory::isPageMapped(triton::uint64 addr) const {
+      /* An empty page is freed */
+      return (this->findPage(addr) != nullptr);
+    }
+
+
+    void PagedMemory::unmap(triton::uint64 baseAddr, triton::usize size) {
+      while (size) {
+        triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+        triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+        Page* page            = this->findPage(baseAddr);
+
+        if (page != nullptr) {
+          bool empty = true;
+
+          std::memset(page->data + offset, 0x00, chunk);
+          page->dirty = true;
+          for (triton::uint32 bit = offset; bit < offset + chunk;) {
+            triton::uint32 word = bit / 64;
+            triton::uint32 end  = std::min<triton::uint32>(offset + chunk, (word + 1) * 64);
+            page->mapped[word] &= ~bitRange(bit % 64, end - word * 64);
+            bit = end;
+          }
+
+          for (triton::uint32 word = 0; word < PAGE_SIZE / 64 && empty; word++)
+            empty = (page->mapped[word] == 0);
+
+          if (empty)
+            this->freePage(baseAddr >> PAGE_SHIFT);
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+    std::vector<triton::uint64> PagedMemory::getDirtyPages(void) const {
+      std::vector<triton::uint64> dirty;
+
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+        if (it->second->dirty)
+          dirty.push_back(it->first << PAGE_SHIFT);
+      }
+
+      for (auto number : this->released)
+        dirty.push_back(number << PAGE_SHIFT);
+
+      std::sort(dirty.begin(), dirty.end());
+      dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+      return dirty;
+    }
+
+
+    void PagedMemory::clearDirtyPages(void) {
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+        it->second->dirty = false;
+      this->released.clear();
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -21,7 +21,7 @@ namespace triton {
 
 
     Register::Register(triton::uint32 regId, triton::uint512 concreteValue) {
-      if (!triton::api.isArchitectureValid()) {
+      if (!triton::API::getCurrent().isArchitectureValid()) {
         this->clear();
         return;
       }
@@ -32,21 +32,19 @@ namespace triton {
     void Register::clear(void) {
       this->concreteValue = 0;
       this->id            = triton::arch::INVALID_REGISTER_ID;
-      this->name          = "unknown";
       this->parent        = triton::arch::INVALID_REGISTER_ID;
+      this->specification = nullptr;
     }
 
 
     void Register::setup(triton::uint32 regId, triton::uint512 concreteValue) {
-      triton::arch::RegisterSpecification regInfo;
-
       this->id = regId;
-      if (!triton::api.isCpuRegisterValid(regId))
+      if (!triton::API::getCurrent().isCpuRegisterValid(regId))
         this->id = triton::arch::INVALID_REGISTER_ID;
 
-      regInfo      = triton::api.getRegisterSpecification(this->id);
-      this->name   = regInfo.getName();
-      this->parent = regInfo.getParentId();
+      const triton::arch::RegisterSpecification& regInfo = triton::API::getCurrent().getRegisterSpecification(this->id);
+      this->parent        = regInfo.getParentId();
+      this->specification = &regInfo;
 
       this->setHigh(regInfo.getHigh());
       this->setLow(regInfo.getLow());
@@ -58,15 +56,6 @@ namespace triton {
     }
 
 
-    Register::Register(const Register& other) : BitsVector(other) {
-      this->copy(other);
-    }
-
-
-    Register::~Register() {
-    }
-
-
     triton::uint32 Register::getAbstractLow(void) const {
       return this->getLow();
     }
@@ -98,7 +87,12 @@ namespace triton {
 
 
     std::string Register::getName(void) const {
-      return this->name;
+      static const triton::arch::RegisterSpecification invalid;
+
+      if (this->specification == nullptr)
+        return invalid.getName();
+
+      return this->specification->getName();
     }
 
 
@@ -130,31 +124,17 @@ namespace triton {
 
 
     bool Register::isValid(void) const {
-      return triton::api.isCpuRegisterValid(this->id);
+      return triton::API::getCurrent().isCpuRegisterValid(this->id);
     }
 
 
     bool Register::isRegister(void) const {
-      return triton::api.isCpuRegister(this->id);
+      return triton::API::getCurrent().isCpuRegister(this->id);
     }
 
 
     bool Register::isFlag(void) const {
-      return triton::api.isCpuFlag(this->id);
-    }
-
-
-    void Register::operator=(const Register& other) {
-      BitsVector::operator=(other);
-      this->copy(other);
-    }
-
-
-    void Register::copy(const Register& other) {
-      this->concreteValue = other.concreteValue;
-      this->id            = other.id;
-      this->name          = other.name;
-      this->parent        = other.parent;
+      return triton::API::getCurrent().isCpuFlag(this->id);
     }
 
 
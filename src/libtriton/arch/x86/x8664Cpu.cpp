@@ -27,23 +27,38 @@ namespace triton {
 
       x8664Cpu::x8664Cpu(triton::callbacks::Callbacks* callbacks) {
         this->callbacks = callbacks;
+        this->handle    = 0;
         this->clear();
       }
 
 
       x8664Cpu::x8664Cpu(const x8664Cpu& other) {
+        this->handle = 0;
         this->copy(other);
       }
 
 
       x8664Cpu::~x8664Cpu() {
         this->memory.clear();
+        if (this->handle != 0) {
+          triton::extlibs::capstone::csh handle = this->handle;
+          triton::extlibs::capstone::cs_close(&handle);
+        }
       }
 
 
       void x8664Cpu::copy(const x8664Cpu& other) {
-        this->callbacks = other.callbacks;
-        this->memory    = other.memory;
+        this->callbacks     = other.callbacks;
+        this->memory        = other.memory;
+        this->providedPages = other.providedPages;
+
+        /* The registers of the CPU */
+        this->x86Registers      = other.x86Registers;
+        this->x86ProgramCounter = other.x86ProgramCounter;
+        this->x86StackPointer   = other.x86StackPointer;
+
+        /* Decoded instructions are copied, the capstone handle is not */
+        this->disassemblyCache = other.disassemblyCache;
 
         std::memcpy(this->rax,     other.rax,    sizeof(this->rax));
         std::memcpy(this->rbx,     other.rbx,    sizeof(this->rbx));
@@ -163,226 +178,7 @@ namespace triton {
 
       void x8664Cpu::init(void) {
         /* Define registers ========================================================= */
-        triton::arch::x86::x86_reg_rax    = triton::arch::Register(triton::arch::x86::ID_REG_RAX);
-        triton::arch::x86::x86_reg_eax    = triton::arch::Register(triton::arch::x86::ID_REG_EAX);
-        triton::arch::x86::x86_reg_ax     = triton::arch::Register(triton::arch::x86::ID_REG_AX);
-        triton::arch::x86::x86_reg_ah     = triton::arch::Register(triton::arch::x86::ID_REG_AH);
-        triton::arch::x86::x86_reg_al     = triton::arch::Register(triton::arch::x86::ID_REG_AL);
-
-        triton::arch::x86::x86_reg_rbx    = triton::arch::Register(triton::arch::x86::ID_REG_RBX);
-        triton::arch::x86::x86_reg_ebx    = triton::arch::Register(triton::arch::x86::ID_REG_EBX);
-        triton::arch::x86::x86_reg_bx     = triton::arch::Register(triton::arch::x86::ID_REG_BX);
-        triton::arch::x86::x86_reg_bh     = triton::arch::Register(triton::arch::x86::ID_REG_BH);
-        triton::arch::x86::x86_reg_bl     = triton::arch::Register(triton::arch::x86::ID_REG_BL);
-
-        triton::arch::x86::x86_reg_rcx    = triton::arch::Register(triton::arch::x86::ID_REG_RCX);
-        triton::arch::x86::x86_reg_ecx    = triton::arch::Register(triton::arch::x86::ID_REG_ECX);
-        triton::arch::x86::x86_reg_cx     = triton::arch::Register(triton::arch::x86::ID_REG_CX);
-        triton::arch::x86::x86_reg_ch     = triton::arch::Register(triton::arch::x86::ID_REG_CH);
-        triton::arch::x86::x86_reg_cl     = triton::arch::Register(triton::arch::x86::ID_REG_CL);
-
-        triton::arch::x86::x86_reg_rdx    = triton::arch::Register(triton::arch::x86::ID_REG_RDX);
-        triton::arch::x86::x86_reg_edx    = triton::arch::Register(triton::arch::x86::ID_REG_EDX);
-        triton::arch::x86::x86_reg_dx     = triton::arch::Register(triton::arch::x86::ID_REG_DX);
-        triton::arch::x86::x86_reg_dh     = triton::arch::Register(triton::arch::x86::ID_REG_DH);
-        triton::arch::x86::x86_reg_dl     = triton::arch::Register(triton::arch::x86::ID_REG_DL);
-
-        triton::arch::x86::x86_reg_rdi    = triton::arch::Register(triton::arch::x86::ID_REG_RDI);
-        triton::arch::x86::x86_reg_edi    = triton::arch::Register(triton::arch::x86::ID_REG_EDI);
-        triton::arch::x86::x86_reg_di     = triton::arch::Register(triton::arch::x86::ID_REG_DI);
-        triton::arch::x86::x86_reg_dil    = triton::arch::Register(triton::arch::x86::ID_REG_DIL);
-
-        triton::arch::x86::x86_reg_rsi    = triton::arch::Register(triton::arch::x86::ID_REG_RSI);
-        triton::arch::x86::x86_reg_esi    = triton::arch::Register(triton::arch::x86::ID_REG_ESI);
-        triton::arch::x86::x86_reg_si     = triton::arch::Register(triton::arch::x86::ID_REG_SI);
-        triton::arch::x86::x86_reg_sil    = triton::arch::Register(triton::arch::x86::ID_REG_SIL);
-
-        triton::arch::x86::x86_reg_rsp    = triton::arch::Register(triton::arch::x86::ID_REG_RSP);
-        triton::arch::x86::x86_reg_esp    = triton::arch::Register(triton::arch::x86::ID_REG_ESP);
-        triton::arch::x86::x86_reg_sp     = triton::arch::Register(triton::arch::x86::ID_REG_SP);
-        triton::arch::x86::x86_reg_spl    = triton::arch::Register(triton::arch::x86::ID_REG_SPL);
-        triton::arch::x86::x86_reg_stack  = triton::arch::Register(triton::arch::x86::ID_REG_RSP);
-
-        triton::arch::x86::x86_reg_rbp    = triton::arch::Register(triton::arch::x86::ID_REG_RBP);
-        triton::arch::x86::x86_reg_ebp    = triton::arch::Register(triton::arch::x86::ID_REG_EBP);
-        triton::arch::x86::x86_reg_bp     = triton::arch::Register(triton::arch::x86::ID_REG_BP);
-        triton::arch::x86::x86_reg_bpl    = triton::arch::Register(triton::arch::x86::ID_REG_BPL);
-
-        triton::arch::x86::x86_reg_rip    = triton::arch::Register(triton::arch::x86::ID_REG_RIP);
-        triton::arch::x86::x86_reg_eip    = triton::arch::Register(triton::arch::x86::ID_REG_EIP);
-        triton::arch::x86::x86_reg_ip     = triton::arch::Register(triton::arch::x86::ID_REG_IP);
-        triton::arch::x86::x86_reg_pc     = triton::arch::Register(triton::arch::x86::ID_REG_RIP);
-
-        triton::arch::x86::x86_reg_eflags = triton::arch::Register(triton::arch::x86::ID_REG_EFLAGS);
-
-        triton::arch::x86::x86_reg_r8     = triton::arch::Register(triton::arch::x86::ID_REG_R8);
-        triton::arch::x86::x86_reg_r8d    = triton::arch::Register(triton::arch::x86::ID_REG_R8D);
-        triton::arch::x86::x86_reg_r8w    = triton::arch::Register(triton::arch::x86::ID_REG_R8W);
-        triton::arch::x86::x86_reg_r8b    = triton::arch::Register(triton::arch::x86::ID_REG_R8B);
-
-        triton::arch::x86::x86_reg_r9     = triton::arch::Register(triton::arch::x86::ID_REG_R9);
-        triton::arch::x86::x86_reg_r9d    = triton::arch::Register(triton::arch::x86::ID_REG_R9D);
-        triton::arch::x86::x86_reg_r9w    = triton::arch::Register(triton::arch::x86::ID_REG_R9W);
-        triton::arch::x86::x86_reg_r9b    = triton::arch::Register(triton::arch::x86::ID_REG_R9B);
-
-        triton::arch::x86::x86_reg_r10    = triton::arch::Register(triton::arch::x86::ID_REG_R10);
-        triton::arch::x86::x86_reg_r10d   = triton::arch::Register(triton::arch::x86::ID_REG_R10D);
-        triton::arch::x86::x86_reg_r10w   = triton::arch::Register(triton::arch::x86::ID_REG_R10W);
-        triton::arch::x86::x86_reg_r10b   = triton::arch::Register(triton::arch::x86::ID_REG_R10B);
-
-        triton::arch::x86::x86_reg_r11    = triton::arch::Register(triton::arch::x86::ID_REG_R11);
-        triton::arch::x86::x86_reg_r11d   = triton::arch::Register(triton::arch::x86::ID_REG_R11D);
-        triton::arch::x86::x86_reg_r11w   = triton::arch::Register(triton::arch::x86::ID_REG_R11W);
-        triton::arch::x86::x86_reg_r11b   = triton::arch::Register(triton::arch::x86::ID_REG_R11B);
-
-        triton::arch::x86::x86_reg_r12    = triton::arch::Register(triton::arch::x86::ID_REG_R12);
-        triton::arch::x86::x86_reg_r12d   = triton::arch::Register(triton::arch::x86::ID_REG_R12D);
-        triton::arch::x86::x86_reg_r12w   = triton::arch::Register(triton::arch::x86::ID_REG_R12W);
-        triton::arch::x86::x86_reg_r12b   = triton::arch::Register(triton::arch::x86::ID_REG_R12B);
-
-        triton::arch::x86::x86_reg_r13    = triton::arch::Register(triton::arch::x86::ID_REG_R13);
-        triton::arch::x86::x86_reg_r13d   = triton::arch::Register(triton::arch::x86::ID_REG_R13D);
-        triton::arch::x86::x86_reg_r13w   = triton::arch::Register(triton::arch::x86::ID_REG_R13W);
-        triton::arch::x86::x86_reg_r13b   = triton::arch::Register(triton::arch::x86::ID_REG_R13B);
-
-        triton::arch::x86::x86_reg_r14    = triton::arch::Register(triton::arch::x86::ID_REG_R14);
-        triton::arch::x86::x86_reg_r14d   = triton::arch::Register(triton::arch::x86::ID_REG_R14D);
-        triton::arch::x86::x86_reg_r14w   = triton::arch::Register(triton::arch::x86::ID_REG_R14W);
-        triton::arch::x86::x86_reg_r14b   = triton::arch::Register(triton::arch::x86::ID_REG_R14B);
-
-        triton::arch::x86::x86_reg_r15    = triton::arch::Register(triton::arch::x86::ID_REG_R15);
-        triton::arch::x86::x86_reg_r15d   = triton::arch::Register(triton::arch::x86::ID_REG_R15D);
-        triton::arch::x86::x86_reg_r15w   = triton::arch::Register(triton::arch::x86::ID_REG_R15W);
-        triton::arch::x86::x86_reg_r15b   = triton::arch::Register(triton::arch::x86::ID_REG_R15B);
-
-        triton::arch::x86::x86_reg_mm0    = triton::arch::Register(triton::arch::x86::ID_REG_MM0);
-        triton::arch::x86::x86_reg_mm1    = triton::arch::Register(triton::arch::x86::ID_REG_MM1);
-        triton::arch::x86::x86_reg_mm2    = triton::arch::Register(triton::arch::x86::ID_REG_MM2);
-        triton::arch::x86::x86_reg_mm3    = triton::arch::Register(triton::arch::x86::ID_REG_MM3);
-        triton::arch::x86::x86_reg_mm4    = triton::arch::Register(triton::arch::x86::ID_REG_MM4);
-        triton::arch::x86::x86_reg_mm5    = triton::arch::Register(triton::arch::x86::ID_REG_MM5);
-        triton::arch::x86::x86_reg_mm6    = triton::arch::Register(triton::arch::x86::ID_REG_MM6);
-        triton::arch::x86::x86_reg_mm7    = triton::arch::Register(triton::arch::x86::ID_REG_MM7);
-
-        triton::arch::x86::x86_reg_xmm0   = triton::arch::Register(triton::arch::x86::ID_REG_XMM0);
-        triton::arch::x86::x86_reg_xmm1   = triton::arch::Register(triton::arch::x86::ID_REG_XMM1);
-        triton::arch::x86::x86_reg_xmm2   = triton::arch::Register(triton::arch::x86::ID_REG_XMM2);
-        triton::arch::x86::x86_reg_xmm3   = triton::arch::Register(triton::arch::x86::ID_REG_XMM3);
-        triton::arch::x86::x86_reg_xmm4   = triton::arch::Register(triton::arch::x86::ID_REG_XMM4);
-        triton::arch::x86::x86_reg_xmm5   = triton::arch::Register(triton::arch::x86::ID_REG_XMM5);
-        triton::arch::x86::x86_reg_xmm6   = triton::arch::Register(triton::arch::x86::ID_REG_XMM6);
-        triton::arch::x86::x86_reg_xmm7   = triton::arch::Register(triton::arch::x86::ID_REG_XMM7);
-        triton::arch::x86::x86_reg_xmm8   = triton::arch::Register(triton::arch::x86::ID_REG_XMM8);
-        triton::arch::x86::x86_reg_xmm9   = triton::arch::Register(triton::arch::x86::ID_REG_XMM9);
-        triton::arch::x86::x86_reg_xmm10  = triton::arch::Register(triton::arch::x86::ID_REG_XMM10);
-        triton::arch::x86::x86_reg_xmm11  = triton::arch::Register(triton::arch::x86::ID_REG_XMM11);
-        triton::arch::x86::x86_reg_xmm12  = triton::arch::Register(triton::arch::x86::ID_REG_XMM12);
-        triton::arch::x86::x86_reg_xmm13  = triton::arch::Register(triton::arch::x86::ID_REG_XMM13);
-        triton::arch::x86::x86_reg_xmm14  = triton::arch::Register(triton::arch::x86::ID_REG_XMM14);
-        triton::arch::x86::x86_reg_xmm15  = triton::arch::Register(triton::arch::x86::ID_REG_XMM15);
-
-        triton::arch::x86::x86_reg_ymm0   = triton::arch::Register(triton::arch::x86::ID_REG_YMM0);
-        triton::arch::x86::x86_reg_ymm1   = triton::arch::Register(triton::arch::x86::ID_REG_YMM1);
-        triton::arch::x86::x86_reg_ymm2   = triton::arch::Register(triton::arch::x86::ID_REG_YMM2);
-        triton::arch::x86::x86_reg_ymm3   = triton::arch::Register(triton::arch::x86::ID_REG_YMM3);
-        triton::arch::x86::x86_reg_ymm4   = triton::arch::Register(triton::arch::x86::ID_REG_YMM4);
-        triton::arch::x86::x86_reg_ymm5   = triton::arch::Register(triton::arch::x86::ID_REG_YMM5);
-        triton::arch::x86::x86_reg_ymm6   = triton::arch::Register(triton::arch::x86::ID_REG_YMM6);
-        triton::arch::x86::x86_reg_ymm7   = triton::arch::Register(triton::arch::x86::ID_REG_YMM7);
-        triton::arch::x86::x86_reg_ymm8   = triton::arch::Register(triton::arch::x86::ID_REG_YMM8);
-        triton::arch::x86::x86_reg_ymm9   = triton::arch::Register(triton::arch::x86::ID_REG_YMM9);
-        triton::arch::x86::x86_reg_ymm10  = triton::arch::Register(triton::arch::x86::ID_REG_YMM10);
-        triton::arch::x86::x86_reg_ymm11  = triton::arch::Register(triton::arch::x86::ID_REG_YMM11);
-        triton::arch::x86::x86_reg_ymm12  = triton::arch::Register(triton::arch::x86::ID_REG_YMM12);
-        triton::arch::x86::x86_reg_ymm13  = triton::arch::Register(triton::arch::x86::ID_REG_YMM13);
-        triton::arch::x86::x86_reg_ymm14  = triton::arch::Register(triton::arch::x86::ID_REG_YMM14);
-        triton::arch::x86::x86_reg_ymm15  = triton::arch::Register(triton::arch::x86::ID_REG_YMM15);
-
-        triton::arch::x86::x86_reg_zmm0   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM0);
-        triton::arch::x86::x86_reg_zmm1   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM1);
-        triton::arch::x86::x86_reg_zmm2   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM2);
-        triton::arch::x86::x86_reg_zmm3   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM3);
-        triton::arch::x86::x86_reg_zmm4   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM4);
-        triton::arch::x86::x86_reg_zmm5   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM5);
-        triton::arch::x86::x86_reg_zmm6   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM6);
-        triton::arch::x86::x86_reg_zmm7   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM7);
-        triton::arch::x86::x86_reg_zmm8   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM8);
-        triton::arch::x86::x86_reg_zmm9   = triton::arch::Register(triton::arch::x86::ID_REG_ZMM9);
-        triton::arch::x86::x86_reg_zmm10  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM10);
-        triton::arch::x86::x86_reg_zmm11  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM11);
-        triton::arch::x86::x86_reg_zmm12  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM12);
-        triton::arch::x86::x86_reg_zmm13  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM13);
-        triton::arch::x86::x86_reg_zmm14  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM14);
-        triton::arch::x86::x86_reg_zmm15  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM15);
-        triton::arch::x86::x86_reg_zmm16  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM16);
-        triton::arch::x86::x86_reg_zmm17  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM17);
-        triton::arch::x86::x86_reg_zmm18  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM18);
-        triton::arch::x86::x86_reg_zmm19  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM19);
-        triton::arch::x86::x86_reg_zmm20  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM20);
-        triton::arch::x86::x86_reg_zmm21  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM21);
-        triton::arch::x86::x86_reg_zmm22  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM22);
-        triton::arch::x86::x86_reg_zmm23  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM23);
-        triton::arch::x86::x86_reg_zmm24  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM24);
-        triton::arch::x86::x86_reg_zmm25  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM25);
-        triton::arch::x86::x86_reg_zmm26  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM26);
-        triton::arch::x86::x86_reg_zmm27  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM27);
-        triton::arch::x86::x86_reg_zmm28  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM28);
-        triton::arch::x86::x86_reg_zmm29  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM29);
-        triton::arch::x86::x86_reg_zmm30  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM30);
-        triton::arch::x86::x86_reg_zmm31  = triton::arch::Register(triton::arch::x86::ID_REG_ZMM31);
-
-        triton::arch::x86::x86_reg_mxcsr  = triton::arch::Register(triton::arch::x86::ID_REG_MXCSR);
-
-        triton::arch::x86::x86_reg_cr0    = triton::arch::Register(triton::arch::x86::ID_REG_CR0);
-        triton::arch::x86::x86_reg_cr1    = triton::arch::Register(triton::arch::x86::ID_REG_CR1);
-        triton::arch::x86::x86_reg_cr2    = triton::arch::Register(triton::arch::x86::ID_REG_CR2);
-        triton::arch::x86::x86_reg_cr3    = triton::arch::Register(triton::arch::x86::ID_REG_CR3);
-        triton::arch::x86::x86_reg_cr4    = triton::arch::Register(triton::arch::x86::ID_REG_CR4);
-        triton::arch::x86::x86_reg_cr5    = triton::arch::Register(triton::arch::x86::ID_REG_CR5);
-        triton::arch::x86::x86_reg_cr6    = triton::arch::Register(triton::arch::x86::ID_REG_CR6);
-        triton::arch::x86::x86_reg_cr7    = triton::arch::Register(triton::arch::x86::ID_REG_CR7);
-        triton::arch::x86::x86_reg_cr8    = triton::arch::Register(triton::arch::x86::ID_REG_CR8);
-        triton::arch::x86::x86_reg_cr9    = triton::arch::Register(triton::arch::x86::ID_REG_CR9);
-        triton::arch::x86::x86_reg_cr10   = triton::arch::Register(triton::arch::x86::ID_REG_CR10);
-        triton::arch::x86::x86_reg_cr11   = triton::arch::Register(triton::arch::x86::ID_REG_CR11);
-        triton::arch::x86::x86_reg_cr12   = triton::arch::Register(triton::arch::x86::ID_REG_CR12);
-        triton::arch::x86::x86_reg_cr13   = triton::arch::Register(triton::arch::x86::ID_REG_CR13);
-        triton::arch::x86::x86_reg_cr14   = triton::arch::Register(triton::arch::x86::ID_REG_CR14);
-        triton::arch::x86::x86_reg_cr15   = triton::arch::Register(triton::arch::x86::ID_REG_CR15);
-
-        triton::arch::x86::x86_reg_ie     = triton::arch::Register(triton::arch::x86::ID_REG_IE);
-        triton::arch::x86::x86_reg_de     = triton::arch::Register(triton::arch::x86::ID_REG_DE);
-        triton::arch::x86::x86_reg_ze     = triton::arch::Register(triton::arch::x86::ID_REG_ZE);
-        triton::arch::x86::x86_reg_oe     = triton::arch::Register(triton::arch::x86::ID_REG_OE);
-        triton::arch::x86::x86_reg_ue     = triton::arch::Register(triton::arch::x86::ID_REG_UE);
-        triton::arch::x86::x86_reg_pe     = triton::arch::Register(triton::arch::x86::ID_REG_PE);
-        triton::arch::x86::x86_reg_daz    = triton::arch::Register(triton::arch::x86::ID_REG_DAZ);
-        triton::arch::x86::x86_reg_im     = triton::arch::Register(triton::arch::x86::ID_REG_IM);
-        triton::arch::x86::x86_reg_dm     = triton::arch::Register(triton::arch::x86::ID_REG_DM);
-        triton::arch::x86::x86_reg_zm     = triton::arch::Register(triton::arch::x86::ID_REG_ZM);
-        triton::arch::x86::x86_reg_om     = triton::arch::Register(triton::arch::x86::ID_REG_OM);
-        triton::arch::x86::x86_reg_um     = triton::arch::Register(triton::arch::x86::ID_REG_UM);
-        triton::arch::x86::x86_reg_pm     = triton::arch::Register(triton::arch::x86::ID_REG_PM);
-        triton::arch::x86::x86_reg_rl     = triton::arch::Register(triton::arch::x86::ID_REG_RL);
-        triton::arch::x86::x86_reg_rh     = triton::arch::Register(triton::arch::x86::ID_REG_RH);
-        triton::arch::x86::x86_reg_fz     = triton::arch::Register(triton::arch::x86::ID_REG_FZ);
-
-        triton::arch::x86::x86_reg_af     = triton::arch::Register(triton::arch::x86::ID_REG_AF);
-        triton::arch::x86::x86_reg_cf     = triton::arch::Register(triton::arch::x86::ID_REG_CF);
-        triton::arch::x86::x86_reg_df     = triton::arch::Register(triton::arch::x86::ID_REG_DF);
-        triton::arch::x86::x86_reg_if     = triton::arch::Register(triton::arch::x86::ID_REG_IF);
-        triton::arch::x86::x86_reg_of     = triton::arch::Register(triton::arch::x86::ID_REG_OF);
-        triton::arch::x86::x86_reg_pf     = triton::arch::Register(triton::arch::x86::ID_REG_PF);
-        triton::arch::x86::x86_reg_sf     = triton::arch::Register(triton::arch::x86::ID_REG_SF);
-        triton::arch::x86::x86_reg_tf     = triton::arch::Register(triton::arch::x86::ID_REG_TF);
-        triton::arch::x86::x86_reg_zf     = triton::arch::Register(triton::arch::x86::ID_REG_ZF);
-
-        triton::arch::x86::x86_reg_cs     = triton::arch::Register(triton::arch::x86::ID_REG_CS);
-        triton::arch::x86::x86_reg_ds     = triton::arch::Register(triton::arch::x86::ID_REG_DS);
-        triton::arch::x86::x86_reg_es     = triton::arch::Register(triton::arch::x86::ID_REG_ES);
-        triton::arch::x86::x86_reg_fs     = triton::arch::Register(triton::arch::x86::ID_REG_FS);
-        triton::arch::x86::x86_reg_gs     = triton::arch::Register(triton::arch::x86::ID_REG_GS);
-        triton::arch::x86::x86_reg_ss     = triton::arch::Register(triton::arch::x86::ID_REG_SS);
+        this->initX86Registers(triton::arch::x86::ID_REG_RIP, triton::arch::x86::ID_REG_RSP);
 
         /* Update python env ======================================================== */
         #ifdef TRITON_PYTHON_BINDINGS
@@ -400,6 +196,7 @@ namespace triton {
       void x8664Cpu::clear(void) {
         /* Clear memory */
         this->memory.clear();
+        this->providedPages.clear();
 
         /* Clear registers */
         std::memset(this->rax,     0x00, sizeof(this->rax));
@@ -596,17 +393,34 @@ namespace triton {
       }
 
 
-      triton::arch::RegisterSpecification x8664Cpu::getRegisterSpecification(triton::uint32 regId) const {
+      const triton::arch::RegisterSpecification& x8664Cpu::getRegisterSpecification(triton::uint32 regId) const {
         return this->getX86RegisterSpecification(triton::arch::ARCH_X86_64, regId);
       }
 
 
+      triton::arch::Register& x8664Cpu::getRegister(triton::uint32 regId) {
+        if (regId >= this->x86Registers.size())
+          regId = triton::arch::x86::ID_REG_INVALID;
+        return this->x86Registers[regId];
+      }
+
+
+      triton::arch::Register& x8664Cpu::getProgramCounter(void) {
+        return this->x86ProgramCounter;
+      }
+
+
+      triton::arch::Register& x8664Cpu::getStackPointer(void) {
+        return this->x86StackPointer;
+      }
+
+
       std::set<triton::arch::Register*> x8664Cpu::getAllRegisters(void) const {
         std::set<triton::arch::Register*> ret;
 
-        for (triton::uint32 index = 0; index < triton::arch::x86::ID_REG_LAST_ITEM; index++) {
-          if (this->isRegisterValid(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+        for (triton::uint32 index = 0; index < this->x86Registers.size(); index++) {
+          if (this->isRegisterValid(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
         }
 
         return ret;
@@ -616,34 +430,34 @@ namespace triton {
       std::set<triton::arch::Register*> x8664Cpu::getParentRegisters(void) const {
         std::set<triton::arch::Register*> ret;
 
-        for (triton::uint32 index = 0; index < triton::arch::x86::ID_REG_LAST_ITEM; index++) {
+        for (triton::uint32 index = 0; index < this->x86Registers.size(); index++) {
           /* Add GPR */
-          if (triton::arch::x86::x86_regs[index]->getSize() == this->registerSize())
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          if (this->x86Registers[index].getSize() == this->registerSize())
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
 
           /* Add Flags */
-          else if (this->isFlag(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isFlag(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
 
           /* Add MMX */
-          else if (this->isMMX(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isMMX(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
 
           /* Add SSE */
-          else if (this->isSSE(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isSSE(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
 
           /* Add AVX-256 */
-          else if (this->isAVX256(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isAVX256(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
 
           /* Add AVX-512 */
-          else if (this->isAVX512(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isAVX512(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
 
           /* Add Control */
-          else if (this->isControl(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isControl(this->x86Registers[index].getId()))
+            ret.insert(const_cast<triton::arch::Register*>(&this->x86Registers[index]));
         }
 
         return ret;
@@ -651,7 +465,6 @@ namespace triton {
 
 
       void x8664Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
         triton::extlibs::capstone::cs_insn*  insn;
         triton::usize                        count = 0;
 
@@ -659,16 +472,26 @@ namespace triton {
         if (inst.getOpcodes() == nullptr || inst.getSize() == 0)
           throw triton::exceptions::Disassembly("x8664Cpu::disassembly(): Opcodes and opcodesSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_64, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x8664Cpu::disassembly(): Cannot open capstone.");
+        /* Check if the instruction has already been decoded */
+        if (this->disassemblyCache.load(inst))
+          return;
 
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+        /* Open capstone on the first disassembly */
+        if (this->handle == 0) {
+          triton::extlibs::capstone::csh handle;
+
+          if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_64, &handle) != triton::extlibs::capstone::CS_ERR_OK)
+            throw triton::exceptions::Disassembly("x8664Cpu::disassembly(): Cannot open capstone.");
+
+          /* Init capstone's options */
+          triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+          triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+
+          this->handle = handle;
+        }
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
+        count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
           for (triton::uint32 j = 0; j < 1; j++) {
@@ -750,19 +573,32 @@ namespace triton {
         else
           throw triton::exceptions::Disassembly("x8664Cpu::disassembly(): Failed to disassemble the given code.");
 
-        triton::extlibs::capstone::cs_close(&handle);
-        return;
+        this->disassemblyCache.store(inst);
+      }
+
+
+      void x8664Cpu::invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size) {
+        this->disassemblyCache.invalidate(baseAddr, size);
+      }
+
+
+      void x8664Cpu::clearDisassemblyCache(void) {
+        this->disassemblyCache.clear();
+      }
+
+
+      std::map<std::string, triton::usize> x8664Cpu::getDisassemblyCacheStats(void) const {
+        return this->disassemblyCache.getStats();
       }
 
 
       triton::uint8 x8664Cpu::getConcreteMemoryValue(triton::uint64 addr) const {
-        if (this->memory.find(addr) == this->memory.end())
-          return 0x00;
-        return this->memory.at(addr);
+        return this->memory.read(addr);
       }
 
 
       triton::uint512 x8664Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+        triton::uint8 area[DQQWORD_SIZE];
         triton::uint512 ret = 0;
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
@@ -770,29 +606,88 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x8664Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks) {
+          this->processMemoryCallbacks(addr, size);
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+        }
+
+        this->memory.read(addr, area, size);
+
+        /* Up to a qword, the value is built without uint512 shifts */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 value = 0;
+          for (triton::sint32 i = size-1; i >= 0; i--)
+            value = ((value << BYTE_SIZE_BIT) | area[i]);
+          return value;
+        }
 
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i));
+          ret = ((ret << BYTE_SIZE_BIT) | area[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x8664Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++) {
-          if (execCallbacks && this->callbacks)
-            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        if (execCallbacks && this->callbacks) {
+          this->processMemoryCallbacks(baseAddr, size);
+          if (this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+            for (triton::usize index = 0; index < size; index++)
+              this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
+          }
         }
 
+        if (size)
+          this->memory.read(baseAddr, area.data(), size);
+
         return area;
       }
 
 
+      void x8664Cpu::markProvidedPages(triton::uint64 baseAddr, triton::usize size) {
+        if (size == 0 || !this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE))
+          return;
+
+        triton::uint64 number = (baseAddr >> triton::arch::PAGE_SHIFT);
+        triton::uint64 last   = ((baseAddr + size - 1) >> triton::arch::PAGE_SHIFT);
+
+        while (true) {
+          this->providedPages.insert(number);
+          if (number == last)
+            break;
+          number = (number + 1) & (static_cast<triton::uint64>(-1) >> triton::arch::PAGE_SHIFT);
+        }
+      }
+
+
+      void x8664Cpu::processMemoryCallbacks(triton::uint64 baseAddr, triton::usize size) const {
+        if (size == 0)
+          return;
+
+        /*
+         * Each page is delivered once, before its first read, unless it has been written before. The
+         * page is marked first as the callback may read it.
+         */
+        if (this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE)) {
+          triton::uint64 number = (baseAddr >> triton::arch::PAGE_SHIFT);
+          triton::uint64 last   = ((baseAddr + size - 1) >> triton::arch::PAGE_SHIFT);
+
+          while (true) {
+            if (this->providedPages.insert(number).second)
+              this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, static_cast<triton::uint64>(number << triton::arch::PAGE_SHIFT));
+            if (number == last)
+              break;
+            number = (number + 1) & (static_cast<triton::uint64>(-1) >> triton::arch::PAGE_SHIFT);
+          }
+        }
+
+        if (this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE))
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
+      }
+
+
       triton::uint512 x8664Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
         triton::uint512 value = 0;
 
@@ -1028,7 +923,8 @@ namespace triton {
 
 
       void x8664Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        this->memory[addr] = value;
+        this->markProvidedPages(addr, BYTE_SIZE);
+        this->memory.write(addr, value);
       }
 
 
@@ -1040,24 +936,38 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x8664Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-        for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
-          cv >>= 8;
+        triton::uint8 area[DQQWORD_SIZE];
+
+        /* Up to a qword, the bytes are extracted without uint512 shifts */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 value = (cv & 0xffffffffffffffff).convert_to<triton::uint64>();
+          for (triton::uint32 i = 0; i < size; i++) {
+            area[i] = static_cast<triton::uint8>(value & 0xff);
+            value >>= 8;
+          }
         }
+        else {
+          for (triton::uint32 i = 0; i < size; i++) {
+            area[i] = (cv & 0xff).convert_to<triton::uint8>();
+            cv >>= 8;
+          }
+        }
+
+        this->markProvidedPages(addr, size);
+        this->memory.write(addr, area, size);
       }
 
 
       void x8664Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->memory[baseAddr+index] = values[index];
-        }
+        this->markProvidedPages(baseAddr, values.size());
+        if (!values.empty())
+          this->memory.write(baseAddr, values.data(), values.size());
       }
 
 
       void x8664Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->memory[baseAddr+index] = area[index];
-        }
+        this->markProvidedPages(baseAddr, size);
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -1391,21 +1301,39 @@ namespace triton {
 
 
       bool x8664Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x8664Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
+        this->memory.unmap(baseAddr, size);
+
+        if (size == 0 || this->providedPages.empty())
+          return;
+
+        /* A page which is no longer mapped may be provided again by the GET_CONCRETE_MEMORY_PAGE callbacks */
+        triton::uint64 number = (baseAddr >> triton::arch::PAGE_SHIFT);
+        triton::uint64 last   = ((baseAddr + size - 1) >> triton::arch::PAGE_SHIFT);
+
+        while (true) {
+          if (!this->memory.isPageMapped(number << triton::arch::PAGE_SHIFT))
+            this->providedPages.erase(number);
+          if (number == last)
+            break;
+          number = (number + 1) & (static_cast<triton::uint64>(-1) >> triton::arch::PAGE_SHIFT);
         }
       }
 
+
+      std::vector<triton::uint64> x8664Cpu::getDirtyMemoryPages(void) const {
+        return this->memory.getDirtyPages();
+      }
+
+
+      void x8664Cpu::clearDirtyMemoryPages(void) {
+        this->memory.clearDirtyPages();
+      }
+
     }; /* x86 namespace */
   }; /* arch namespace */
 }; /* triton namespace */
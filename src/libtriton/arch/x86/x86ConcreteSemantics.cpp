@@ -0,0 +1,565 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <x86ConcreteSemantics.hpp>
+#include <x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* Returns the mask of a value of `bits` bits */
+      static inline triton::uint64 maskOf(triton::uint32 bits) {
+        return (bits >= QWORD_SIZE_BIT) ? static_cast<triton::uint64>(-1) : ((1ULL << bits) - 1);
+      }
+
+
+      /* Returns the most significant bit of a value of `bits` bits */
+      static inline bool msbOf(triton::uint64 value, triton::uint32 bits) {
+        return ((value >> (bits - 1)) & 1);
+      }
+
+
+      /* Sign extends a value of `bits` bits to 64 bits */
+      static inline triton::uint64 signExtend(triton::uint64 value, triton::uint32 bits) {
+        if (bits < QWORD_SIZE_BIT && msbOf(value, bits))
+          return value | ~maskOf(bits);
+        return value;
+      }
+
+
+      /* Sign extends a value of `bits` bits to 128 bits */
+      static inline triton::uint512 signExtend128(triton::uint64 value, triton::uint32 bits) {
+        triton::uint512 result = value & maskOf(bits);
+        if (msbOf(value, bits))
+          result += (triton::uint512(1) << 128) - (triton::uint512(1) << bits);
+        return result;
+      }
+
+
+      x86ConcreteSemantics::x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                 triton::engines::taint::TaintEngine* taintEngine) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+        this->symbolic        = false;
+        this->pc              = 0;
+
+        if (this->architecture == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The taint engines API must be defined.");
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::readRegister(const triton::arch::Register& reg) {
+        if (this->symbolicEngine->isRegisterSymbolized(reg) || this->taintEngine->isRegisterTainted(reg))
+          this->symbolic = true;
+        return this->architecture->getConcreteRegisterValue(reg).convert_to<triton::uint64>();
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::readMemory(triton::uint64 addr, triton::uint32 size) {
+        if (this->symbolicEngine->isMemorySymbolized(addr, size) || this->taintEngine->isMemoryTainted(addr, size))
+          this->symbolic = true;
+        return this->architecture->getConcreteMemoryValue(triton::arch::MemoryAccess(addr, size)).convert_to<triton::uint64>();
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::read(triton::arch::OperandWrapper& op) {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return op.getImmediate().getValue() & maskOf(op.getBitSize());
+          case triton::arch::OP_MEM:
+            return this->readMemory(op.getMemory().getAddress(), op.getSize());
+          case triton::arch::OP_REG:
+            return this->readRegister(op.getRegister());
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::read(): Invalid operand.");
+        }
+      }
+
+
+      bool x86ConcreteSemantics::readFlag(const triton::arch::Register& flag) {
+        return (this->readRegister(flag) & 1);
+      }
+
+
+      void x86ConcreteSemantics::writeRegister(const triton::arch::Register& reg, triton::uint64 value) {
+        triton::arch::Register target = reg;
+
+        /* The value is truncated to the written register before a widening */
+        value &= maskOf(reg.getBitSize());
+
+        /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register */
+        if (this->architecture->getArchitecture() == triton::arch::ARCH_X86_64 && !reg.isFlag() && reg.getSize() == DWORD_SIZE)
+          target = reg.getParent();
+
+        target.setConcreteValue(value);
+        this->registers.push_back(target);
+      }
+
+
+      void x86ConcreteSemantics::writeMemory(triton::uint64 addr, triton::uint32 size, triton::uint64 value) {
+        this->memory.push_back(triton::arch::MemoryAccess(addr, size, value & maskOf(size * BYTE_SIZE_BIT)));
+      }
+
+
+      void x86ConcreteSemantics::write(triton::arch::OperandWrapper& op, triton::uint64 value) {
+        switch (op.getType()) {
+          case triton::arch::OP_MEM:
+            this->writeMemory(op.getMemory().getAddress(), op.getSize(), value);
+            break;
+          case triton::arch::OP_REG:
+            this->writeRegister(op.getRegister(), value);
+            break;
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::write(): Invalid operand.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::writeFlag(const triton::arch::Register& flag, bool value) {
+        this->writeRegister(flag, value);
+      }
+
+
+      void x86ConcreteSemantics::writeResultFlags(triton::uint64 result, triton::uint32 bits) {
+        triton::uint8 byte = static_cast<triton::uint8>(result);
+
+        byte ^= (byte >> 4);
+        byte ^= (byte >> 2);
+        byte ^= (byte >> 1);
+
+        this->writeFlag(TRITON_X86_REG_PF, !(byte & 1));
+        this->writeFlag(TRITON_X86_REG_SF, msbOf(result, bits));
+        this->writeFlag(TRITON_X86_REG_ZF, (result & maskOf(bits)) == 0);
+      }
+
+
+      bool x86ConcreteSemantics::condition(triton::uint32 type) {
+        /* Every flag of the condition is read, even if the result is already known */
+        switch (type) {
+          case ID_INS_CMOVA:  case ID_INS_JA:  case ID_INS_SETA:  return !this->readFlag(TRITON_X86_REG_CF) & !this->readFlag(TRITON_X86_REG_ZF);
+          case ID_INS_CMOVAE: case ID_INS_JAE: case ID_INS_SETAE: return !this->readFlag(TRITON_X86_REG_CF);
+          case ID_INS_CMOVB:  case ID_INS_JB:  case ID_INS_SETB:  return this->readFlag(TRITON_X86_REG_CF);
+          case ID_INS_CMOVBE: case ID_INS_JBE: case ID_INS_SETBE: return this->readFlag(TRITON_X86_REG_CF) | this->readFlag(TRITON_X86_REG_ZF);
+          case ID_INS_CMOVE:  case ID_INS_JE:  case ID_INS_SETE:  return this->readFlag(TRITON_X86_REG_ZF);
+          case ID_INS_CMOVNE: case ID_INS_JNE: case ID_INS_SETNE: return !this->readFlag(TRITON_X86_REG_ZF);
+          case ID_INS_CMOVG:  case ID_INS_JG:  case ID_INS_SETG:  return !this->readFlag(TRITON_X86_REG_ZF) & (this->readFlag(TRITON_X86_REG_SF) == this->readFlag(TRITON_X86_REG_OF));
+          case ID_INS_CMOVGE: case ID_INS_JGE: case ID_INS_SETGE: return (this->readFlag(TRITON_X86_REG_SF) == this->readFlag(TRITON_X86_REG_OF));
+          case ID_INS_CMOVL:  case ID_INS_JL:  case ID_INS_SETL:  return (this->readFlag(TRITON_X86_REG_SF) != this->readFlag(TRITON_X86_REG_OF));
+          case ID_INS_CMOVLE: case ID_INS_JLE: case ID_INS_SETLE: return this->readFlag(TRITON_X86_REG_ZF) | (this->readFlag(TRITON_X86_REG_SF) != this->readFlag(TRITON_X86_REG_OF));
+          case ID_INS_CMOVO:  case ID_INS_JO:  case ID_INS_SETO:  return this->readFlag(TRITON_X86_REG_OF);
+          case ID_INS_CMOVNO: case ID_INS_JNO: case ID_INS_SETNO: return !this->readFlag(TRITON_X86_REG_OF);
+          case ID_INS_CMOVP:  case ID_INS_JP:  case ID_INS_SETP:  return this->readFlag(TRITON_X86_REG_PF);
+          case ID_INS_CMOVNP: case ID_INS_JNP: case ID_INS_SETNP: return !this->readFlag(TRITON_X86_REG_PF);
+          case ID_INS_CMOVS:  case ID_INS_JS:  case ID_INS_SETS:  return this->readFlag(TRITON_X86_REG_SF);
+          case ID_INS_CMOVNS: case ID_INS_JNS: case ID_INS_SETNS: return !this->readFlag(TRITON_X86_REG_SF);
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::condition(): Invalid condition.");
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isSupported(triton::arch::Instruction& inst) const {
+        /* The string instructions are handled by the symbolic semantics */
+        if (inst.getPrefix() != ID_PREFIX_INVALID)
+          return false;
+
+        for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+          if (it->getBitSize() > QWORD_SIZE_BIT)
+            return false;
+        }
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::commit(void) {
+        triton::uint32 pcId = TRITON_X86_REG_PC.getParent().getId();
+
+        /* The program counter is always overwritten */
+        for (auto it = this->registers.begin(); it != this->registers.end(); it++) {
+          if (it->getParent().getId() == pcId)
+            continue;
+          if (this->symbolicEngine->isRegisterSymbolized(*it) || this->taintEngine->isRegisterTainted(*it))
+            return false;
+        }
+
+        for (auto it = this->memory.begin(); it != this->memory.end(); it++) {
+          if (this->symbolicEngine->isMemorySymbolized(*it) || this->taintEngine->isMemoryTainted(*it))
+            return false;
+        }
+
+        for (auto it = this->registers.begin(); it != this->registers.end(); it++) {
+          this->architecture->setConcreteRegisterValue(*it);
+          this->symbolicEngine->concretizeRegister(*it);
+        }
+
+        for (auto it = this->memory.begin(); it != this->memory.end(); it++) {
+          this->architecture->setConcreteMemoryValue(*it);
+          this->symbolicEngine->concretizeMemory(*it);
+        }
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::run(triton::arch::Instruction& inst) {
+        std::vector<triton::arch::OperandWrapper>& ops = inst.operands;
+        triton::arch::Register stack                   = TRITON_X86_REG_SP.getParent();
+        triton::uint32 type                            = inst.getType();
+        triton::uint32 bits                            = ops.empty() ? 0 : ops[0].getBitSize();
+        triton::uint64 mask                            = maskOf(bits);
+
+        switch (type) {
+          case ID_INS_NOP:
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_MOVZX:
+            this->write(ops[0], this->read(ops[1]));
+            break;
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+            this->write(ops[0], signExtend(this->read(ops[1]), ops[1].getBitSize()));
+            break;
+
+          case ID_INS_LEA: {
+            triton::arch::MemoryAccess& mem = ops[1].getMemory();
+            const triton::arch::Register& base  = mem.getConstBaseRegister();
+            const triton::arch::Register& index = mem.getConstIndexRegister();
+            triton::uint64 value = signExtend(mem.getConstDisplacement().getValue(), mem.getConstDisplacement().getBitSize());
+
+            if (base.isValid()) {
+              value += this->readRegister(base);
+              if (base.getParent().getId() == TRITON_X86_REG_PC.getId())
+                value += inst.getSize();
+            }
+
+            if (index.isValid())
+              value += this->readRegister(index) * mem.getConstScale().getValue();
+
+            this->write(ops[0], value);
+            break;
+          }
+
+          case ID_INS_XCHG: {
+            triton::uint64 op1 = this->read(ops[0]);
+            triton::uint64 op2 = this->read(ops[1]);
+            this->write(ops[0], op2);
+            this->write(ops[1], op1);
+            break;
+          }
+
+          case ID_INS_ADD:
+          case ID_INS_ADC: {
+            triton::uint64 op1   = this->read(ops[0]);
+            triton::uint64 op2   = this->read(ops[1]);
+            bool carry           = (type == ID_INS_ADC) ? this->readFlag(TRITON_X86_REG_CF) : false;
+            triton::uint64 res   = (op1 + op2 + carry) & mask;
+            this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_AF, ((op1 ^ op2 ^ res) >> 4) & 1);
+            this->writeFlag(TRITON_X86_REG_CF, carry ? (res <= op1) : (res < op1));
+            this->writeFlag(TRITON_X86_REG_OF, msbOf((op1 ^ res) & (op2 ^ res), bits));
+            this->writeResultFlags(res, bits);
+            break;
+          }
+
+          case ID_INS_SUB:
+          case ID_INS_SBB:
+          case ID_INS_CMP: {
+            triton::uint64 op1   = this->read(ops[0]);
+            triton::uint64 op2   = this->read(ops[1]);
+            bool borrow          = (type == ID_INS_SBB) ? this->readFlag(TRITON_X86_REG_CF) : false;
+            triton::uint64 res   = (op1 - op2 - borrow) & mask;
+            if (type != ID_INS_CMP)
+              this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_AF, ((op1 ^ op2 ^ res) >> 4) & 1);
+            this->writeFlag(TRITON_X86_REG_CF, borrow ? (op1 <= op2) : (op1 < op2));
+            this->writeFlag(TRITON_X86_REG_OF, msbOf((op1 ^ op2) & (op1 ^ res), bits));
+            this->writeResultFlags(res, bits);
+            break;
+          }
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_XOR:
+          case ID_INS_TEST: {
+            triton::uint64 op1 = this->read(ops[0]);
+            triton::uint64 op2 = this->read(ops[1]);
+            triton::uint64 res = 0;
+            switch (type) {
+              case ID_INS_OR:   res = op1 | op2; break;
+              case ID_INS_XOR:  res = op1 ^ op2; break;
+              default:          res = op1 & op2; break;
+            }
+            if (type != ID_INS_TEST)
+              this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_CF, false);
+            this->writeFlag(TRITON_X86_REG_OF, false);
+            this->writeResultFlags(res, bits);
+            break;
+          }
+
+          case ID_INS_INC:
+          case ID_INS_DEC: {
+            triton::uint64 op1 = this->read(ops[0]);
+            triton::uint64 res = ((type == ID_INS_INC) ? (op1 + 1) : (op1 - 1)) & mask;
+            this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_AF, ((op1 ^ 1 ^ res) >> 4) & 1);
+            this->writeFlag(TRITON_X86_REG_OF, (type == ID_INS_INC) ? (res == (1ULL << (bits - 1))) : (op1 == (1ULL << (bits - 1))));
+            this->writeResultFlags(res, bits);
+            break;
+          }
+
+          case ID_INS_NEG: {
+            triton::uint64 op1 = this->read(ops[0]);
+            triton::uint64 res = (0 - op1) & mask;
+            this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_AF, ((op1 ^ res) >> 4) & 1);
+            this->writeFlag(TRITON_X86_REG_CF, op1 != 0);
+            this->writeFlag(TRITON_X86_REG_OF, op1 == (1ULL << (bits - 1)));
+            this->writeResultFlags(res, bits);
+            break;
+          }
+
+          case ID_INS_NOT:
+            this->write(ops[0], ~this->read(ops[0]));
+            break;
+
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+          case ID_INS_SAR: {
+            if (ops.size() != 2)
+              return false;
+
+            triton::uint64 op1   = this->read(ops[0]);
+            triton::uint32 count = static_cast<triton::uint32>(this->read(ops[1]) & ((bits == QWORD_SIZE_BIT) ? (QWORD_SIZE_BIT - 1) : (DWORD_SIZE_BIT - 1)));
+            triton::uint64 res   = 0;
+            bool cf              = false;
+            bool of              = false;
+
+            /* The flags are not affected if the count is 0, but the destination is still written */
+            if (count == 0) {
+              this->write(ops[0], op1);
+              break;
+            }
+
+            if (type == ID_INS_SHL) {
+              res = (count < QWORD_SIZE_BIT) ? ((op1 << count) & mask) : 0;
+              cf  = (count <= bits) ? ((op1 >> (bits - count)) & 1) : false;
+              of  = msbOf(op1, bits) ^ msbOf(op1 << 1, bits);
+            }
+            else if (type == ID_INS_SHR) {
+              res = op1 >> count;
+              cf  = (op1 >> (count - 1)) & 1;
+              of  = msbOf(op1, bits);
+            }
+            else {
+              triton::sint64 sop1 = static_cast<triton::sint64>(signExtend(op1, bits));
+              res = static_cast<triton::uint64>(sop1 >> count) & mask;
+              cf  = (sop1 >> (count - 1)) & 1;
+              of  = false;
+            }
+
+            this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_CF, cf);
+            if (count == 1)
+              this->writeFlag(TRITON_X86_REG_OF, of);
+            this->writeResultFlags(res, bits);
+            break;
+          }
+
+          case ID_INS_IMUL: {
+            if (ops.size() < 2)
+              return false;
+
+            triton::uint64 op1   = this->read(ops[ops.size() - 2]);
+            triton::uint64 op2   = this->read(ops[ops.size() - 1]);
+            triton::uint512 full = (signExtend128(op1, bits) * signExtend128(op2, bits)) & ((triton::uint512(1) << 128) - 1);
+            triton::uint64 res   = full.convert_to<triton::uint64>() & mask;
+            bool overflow        = (signExtend128(res, bits) != full);
+            this->write(ops[0], res);
+            this->writeFlag(TRITON_X86_REG_CF, overflow);
+            this->writeFlag(TRITON_X86_REG_OF, overflow);
+            break;
+          }
+
+          case ID_INS_CBW:
+            this->writeRegister(TRITON_X86_REG_AX, signExtend(this->readRegister(TRITON_X86_REG_AL), BYTE_SIZE_BIT));
+            break;
+
+          case ID_INS_CWDE:
+            this->writeRegister(TRITON_X86_REG_EAX, signExtend(this->readRegister(TRITON_X86_REG_AX), WORD_SIZE_BIT));
+            break;
+
+          case ID_INS_CDQE:
+            this->writeRegister(TRITON_X86_REG_RAX, signExtend(this->readRegister(TRITON_X86_REG_EAX), DWORD_SIZE_BIT));
+            break;
+
+          case ID_INS_CWD:
+            this->writeRegister(TRITON_X86_REG_DX, msbOf(this->readRegister(TRITON_X86_REG_AX), WORD_SIZE_BIT) ? -1 : 0);
+            break;
+
+          case ID_INS_CDQ:
+            this->writeRegister(TRITON_X86_REG_EDX, msbOf(this->readRegister(TRITON_X86_REG_EAX), DWORD_SIZE_BIT) ? -1 : 0);
+            break;
+
+          case ID_INS_CQO:
+            this->writeRegister(TRITON_X86_REG_RDX, msbOf(this->readRegister(TRITON_X86_REG_RAX), QWORD_SIZE_BIT) ? -1 : 0);
+            break;
+
+          case ID_INS_CLC: this->writeFlag(TRITON_X86_REG_CF, false);                                   break;
+          case ID_INS_CLD: this->writeFlag(TRITON_X86_REG_DF, false);                                   break;
+          case ID_INS_CMC: this->writeFlag(TRITON_X86_REG_CF, !this->readFlag(TRITON_X86_REG_CF));      break;
+          case ID_INS_STC: this->writeFlag(TRITON_X86_REG_CF, true);                                    break;
+          case ID_INS_STD: this->writeFlag(TRITON_X86_REG_DF, true);                                    break;
+
+          case ID_INS_PUSH: {
+            /* If it's an immediate source, the memory access is always based on the arch size */
+            triton::uint32 size = (ops[0].getType() == triton::arch::OP_IMM) ? stack.getSize() : ops[0].getSize();
+            triton::uint64 sp   = this->readRegister(stack) - size;
+            this->writeMemory(sp, size, this->read(ops[0]));
+            this->writeRegister(stack, sp);
+            break;
+          }
+
+          case ID_INS_POP: {
+            /* pop into the stack pointer is handled by the symbolic semantics */
+            if (ops[0].getType() == triton::arch::OP_REG && ops[0].getRegister().getParent().getId() == stack.getId())
+              return false;
+            triton::uint64 sp = this->readRegister(stack);
+            this->write(ops[0], this->readMemory(sp, ops[0].getSize()));
+            this->writeRegister(stack, sp + ops[0].getSize());
+            break;
+          }
+
+          case ID_INS_LEAVE: {
+            triton::arch::Register base = TRITON_X86_REG_BP.getParent();
+            triton::uint64 bp           = this->readRegister(base);
+            this->writeRegister(base, this->readMemory(bp, base.getSize()));
+            this->writeRegister(stack, bp + base.getSize());
+            break;
+          }
+
+          case ID_INS_CALL: {
+            triton::uint64 sp = this->readRegister(stack) - stack.getSize();
+            this->pc = this->read(ops[0]);
+            this->writeMemory(sp, stack.getSize(), inst.getNextAddress());
+            this->writeRegister(stack, sp);
+            break;
+          }
+
+          case ID_INS_RET: {
+            triton::uint64 sp = this->readRegister(stack);
+            this->pc = this->readMemory(sp, stack.getSize());
+            sp += stack.getSize();
+            if (!ops.empty())
+              sp += ops[0].getImmediate().getValue();
+            this->writeRegister(stack, sp);
+            break;
+          }
+
+          case ID_INS_JMP:
+            this->pc = this->read(ops[0]);
+            break;
+
+          case ID_INS_JA:  case ID_INS_JAE: case ID_INS_JB:  case ID_INS_JBE:
+          case ID_INS_JE:  case ID_INS_JG:  case ID_INS_JGE: case ID_INS_JL:
+          case ID_INS_JLE: case ID_INS_JNE: case ID_INS_JNO: case ID_INS_JNP:
+          case ID_INS_JNS: case ID_INS_JO:  case ID_INS_JP:  case ID_INS_JS: {
+            triton::uint64 target = this->read(ops[0]);
+            if (this->condition(type)) {
+              this->pc = target;
+              inst.setConditionTaken(true);
+            }
+            break;
+          }
+
+          case ID_INS_CMOVA:  case ID_INS_CMOVAE: case ID_INS_CMOVB:  case ID_INS_CMOVBE:
+          case ID_INS_CMOVE:  case ID_INS_CMOVG:  case ID_INS_CMOVGE: case ID_INS_CMOVL:
+          case ID_INS_CMOVLE: case ID_INS_CMOVNE: case ID_INS_CMOVNO: case ID_INS_CMOVNP:
+          case ID_INS_CMOVNS: case ID_INS_CMOVO:  case ID_INS_CMOVP:  case ID_INS_CMOVS: {
+            triton::uint64 op1 = this->read(ops[0]);
+            triton::uint64 op2 = this->read(ops[1]);
+            /* Like the symbolic semantics, the destination is always written */
+            this->write(ops[0], this->condition(type) ? op2 : op1);
+            break;
+          }
+
+          case ID_INS_SETA:  case ID_INS_SETAE: case ID_INS_SETB:  case ID_INS_SETBE:
+          case ID_INS_SETE:  case ID_INS_SETG:  case ID_INS_SETGE: case ID_INS_SETL:
+          case ID_INS_SETLE: case ID_INS_SETNE: case ID_INS_SETNO: case ID_INS_SETNP:
+          case ID_INS_SETNS: case ID_INS_SETO:  case ID_INS_SETP:  case ID_INS_SETS:
+            this->write(ops[0], this->condition(type));
+            break;
+
+          default:
+            return false;
+        }
+
+        return true;
+      }
+
+
+      concrete_e x86ConcreteSemantics::execute(triton::arch::Instruction& inst) {
+        concrete_e ret = CONCRETE_EXECUTED;
+
+        this->symbolic = false;
+        this->registers.clear();
+        this->memory.clear();
+        this->pc = inst.getNextAddress();
+
+        if (!this->isSupported(inst))
+          return CONCRETE_UNSUPPORTED;
+
+        /* The registers used to compute the memory addresses are operands too */
+        for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+          if (it->getType() == triton::arch::OP_MEM) {
+            triton::arch::MemoryAccess& mem = it->getMemory();
+            if (mem.getConstBaseRegister().isValid())
+              this->readRegister(mem.getConstBaseRegister());
+            if (mem.getConstIndexRegister().isValid())
+              this->readRegister(mem.getConstIndexRegister());
+          }
+        }
+
+        if (!this->run(inst))
+          ret = CONCRETE_UNSUPPORTED;
+
+        else {
+          this->writeRegister(TRITON_X86_REG_PC.getParent(), this->pc);
+          if (this->symbolic || !this->commit())
+            ret = CONCRETE_SYMBOLIC;
+        }
+
+        if (ret != CONCRETE_EXECUTED)
+          inst.setConditionTaken(false);
+
+        this->registers.clear();
+        this->memory.clear();
+
+        return ret;
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
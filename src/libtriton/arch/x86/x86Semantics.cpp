@@ -313,6 +313,8 @@ namespace triton {
         this->architecture    = architecture;
         this->symbolicEngine  = symbolicEngine;
         this->taintEngine     = taintEngine;
+        this->templateHits    = 0;
+        this->templateMisses  = 0;
 
         if (this->architecture == nullptr)
           throw triton::exceptions::Semantics("x86Semantics::x86Semantics(): The architecture API must be defined.");
@@ -330,6 +332,157 @@ namespace triton {
 
 
       bool x86Semantics::buildSemantics(triton::arch::Instruction& inst) {
+        bool ret = false;
+
+        if (!this->isTemplateAllowed(inst))
+          return this->runHandler(inst);
+
+        /* Build the semantics from the template of a previous execution */
+        auto it = this->templates.find(inst.getAddress());
+        if (it != this->templates.end() && it->second.match(inst)) {
+          it->second.instantiate(inst, this->symbolicEngine);
+          this->templateHits++;
+          return true;
+        }
+
+        /* Otherwise, run the handler and record its template */
+        triton::engines::symbolic::SemanticsRecorder recorder(inst);
+        this->symbolicEngine->setSemanticsRecorder(&recorder);
+        try {
+          ret = this->runHandler(inst);
+        }
+        catch (...) {
+          this->symbolicEngine->setSemanticsRecorder(nullptr);
+          throw;
+        }
+        this->symbolicEngine->setSemanticsRecorder(nullptr);
+        this->templateMisses++;
+
+        if (ret && recorder.isValid())
+          this->templates[inst.getAddress()] = recorder.getTemplate();
+        else
+          this->templates.erase(inst.getAddress());
+
+        return ret;
+      }
+
+
+      bool x86Semantics::isTemplateAllowed(const triton::arch::Instruction& inst) const {
+        if (!this->symbolicEngine->isEnabled() || !this->symbolicEngine->isOptimizationEnabled(triton::engines::symbolic::SEMANTICS_TEMPLATES))
+          return false;
+
+        /* Both optimizations rewrite the nodes built by the handler */
+        if (this->symbolicEngine->isOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES) ||
+            this->symbolicEngine->isOptimizationEnabled(triton::engines::symbolic::CONSTANT_FOLDING))
+          return false;
+
+        /* The taint is spread by the handler */
+        if (this->taintEngine->isEnabled() || this->taintEngine->hasTaintedMemory() || !this->taintEngine->getTaintedRegisters().empty())
+          return false;
+
+        /*
+         * Only the handlers which do not depend on concrete values, do not
+         * touch the control flow and only access memory operands.
+         */
+        switch (inst.getType()) {
+          case ID_INS_ADC:
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_ANDNPD:
+          case ID_INS_ANDNPS:
+          case ID_INS_ANDPD:
+          case ID_INS_ANDPS:
+          case ID_INS_BSF:
+          case ID_INS_BSR:
+          case ID_INS_BSWAP:
+          case ID_INS_BT:
+          case ID_INS_BTC:
+          case ID_INS_BTR:
+          case ID_INS_BTS:
+          case ID_INS_CBW:
+          case ID_INS_CDQ:
+          case ID_INS_CDQE:
+          case ID_INS_CLC:
+          case ID_INS_CLD:
+          case ID_INS_CMC:
+          case ID_INS_CMP:
+          case ID_INS_CQO:
+          case ID_INS_CWD:
+          case ID_INS_CWDE:
+          case ID_INS_DEC:
+          case ID_INS_IMUL:
+          case ID_INS_INC:
+          case ID_INS_LEA:
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_MOVAPD:
+          case ID_INS_MOVAPS:
+          case ID_INS_MOVD:
+          case ID_INS_MOVDQA:
+          case ID_INS_MOVDQU:
+          case ID_INS_MOVQ:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVUPD:
+          case ID_INS_MOVUPS:
+          case ID_INS_MOVZX:
+          case ID_INS_MUL:
+          case ID_INS_NEG:
+          case ID_INS_NOP:
+          case ID_INS_NOT:
+          case ID_INS_OR:
+          case ID_INS_ORPD:
+          case ID_INS_ORPS:
+          case ID_INS_PADDB:
+          case ID_INS_PADDD:
+          case ID_INS_PADDQ:
+          case ID_INS_PADDW:
+          case ID_INS_PAND:
+          case ID_INS_PANDN:
+          case ID_INS_POR:
+          case ID_INS_PSUBB:
+          case ID_INS_PSUBD:
+          case ID_INS_PSUBQ:
+          case ID_INS_PSUBW:
+          case ID_INS_PXOR:
+          case ID_INS_SAR:
+          case ID_INS_SBB:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+          case ID_INS_STC:
+          case ID_INS_STD:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XCHG:
+          case ID_INS_XOR:
+          case ID_INS_XORPD:
+          case ID_INS_XORPS:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      void x86Semantics::clearSemanticsTemplates(void) {
+        this->templates.clear();
+        this->templateHits   = 0;
+        this->templateMisses = 0;
+      }
+
+
+      std::map<std::string, triton::usize> x86Semantics::getSemanticsTemplatesStats(void) const {
+        std::map<std::string, triton::usize> stats;
+
+        stats["entries"] = this->templates.size();
+        stats["hits"]    = this->templateHits;
+        stats["misses"]  = this->templateMisses;
+
+        return stats;
+      }
+
+
+      bool x86Semantics::runHandler(triton::arch::Instruction& inst) {
         switch (inst.getType()) {
           case ID_INS_ADC:            this->adc_s(inst);          break;
           case ID_INS_ADD:            this->add_s(inst);          break;
@@ -5,7 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <new>
 
 #include <api.hpp>
@@ -23,27 +25,34 @@ namespace triton {
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(enum kind_e kind) {
+      this->depth       = 1;
       this->eval        = 0;
       this->kind        = kind;
       this->size        = 0;
       this->symbolized  = false;
+      this->nodes       = 1;
     }
 
 
     AbstractNode::AbstractNode() {
+      this->depth       = 1;
       this->eval        = 0;
       this->kind        = UNDEFINED_NODE;
       this->size        = 0;
       this->symbolized  = false;
+      this->nodes       = 1;
     }
 
 
     AbstractNode::AbstractNode(const AbstractNode& copy) {
+      this->depth       = copy.depth;
       this->eval        = copy.eval;
       this->kind        = copy.kind;
+      this->nodes       = copy.nodes;
       this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
+      this->variables   = copy.variables;
 
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
@@ -84,6 +93,73 @@ namespace triton {
     }
 
 
+    const std::vector<triton::usize>& AbstractNode::getSymbolicVariableIds(void) const {
+      static const std::vector<triton::usize> empty;
+
+      if (this->variables == nullptr)
+        return empty;
+      return *this->variables;
+    }
+
+
+    bool AbstractNode::isDependentOn(triton::usize symVarId) const {
+      if (this->variables == nullptr)
+        return false;
+      return std::binary_search(this->variables->begin(), this->variables->end(), symVarId);
+    }
+
+
+    triton::uint32 AbstractNode::getDepth(void) const {
+      return this->depth;
+    }
+
+
+    triton::uint64 AbstractNode::getNumberOfNodes(void) const {
+      return this->nodes;
+    }
+
+
+    void AbstractNode::initInformation(void) {
+      this->depth = 1;
+      this->nodes = 1;
+      this->variables.reset();
+    }
+
+
+    void AbstractNode::spreadInformation(const AbstractNode* node) {
+      std::vector<triton::usize> merged;
+
+      this->depth = std::max(this->depth, node->depth + 1);
+
+      if (this->nodes > static_cast<triton::uint64>(-1) - node->nodes)
+        this->nodes = static_cast<triton::uint64>(-1);
+      else
+        this->nodes += node->nodes;
+
+      if (node->variables == nullptr || node->variables == this->variables)
+        return;
+
+      if (this->variables == nullptr) {
+        this->variables = node->variables;
+        return;
+      }
+
+      std::set_union(this->variables->begin(), this->variables->end(),
+                     node->variables->begin(), node->variables->end(),
+                     std::back_inserter(merged));
+
+      /* Keep sharing the set of one side if the other side brings nothing new */
+      if (merged.size() == this->variables->size())
+        return;
+      if (merged.size() == node->variables->size()) {
+        this->variables = node->variables;
+        return;
+      }
+
+      this->variables = std::make_shared<const std::vector<triton::usize>>(std::move(merged));
+    }
+
+
     triton::uint512 AbstractNode::evaluate(void) const {
       return this->eval;
     }
@@ -170,9 +246,11 @@ namespace triton {
       this->eval = 0;
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -226,9 +304,11 @@ namespace triton {
       this->eval = ((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -282,9 +362,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() & this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -371,9 +453,11 @@ namespace triton {
       }
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -435,9 +519,11 @@ namespace triton {
       this->eval = 0;
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -491,9 +577,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -547,9 +635,11 @@ namespace triton {
       this->eval = ((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -603,9 +693,11 @@ namespace triton {
       this->eval = (~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -655,9 +747,11 @@ namespace triton {
       this->eval = ((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -711,9 +805,11 @@ namespace triton {
       this->eval = (~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -763,9 +859,11 @@ namespace triton {
       this->eval = (~this->childs[0]->evaluate() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -819,9 +917,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() | this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -891,9 +991,11 @@ namespace triton {
       this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -962,9 +1064,11 @@ namespace triton {
       this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1031,9 +1135,11 @@ namespace triton {
         this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1094,9 +1200,11 @@ namespace triton {
       this->eval = (op1Signed >= op2Signed);
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1157,9 +1265,11 @@ namespace triton {
       this->eval = (op1Signed > op2Signed);
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1213,9 +1323,11 @@ namespace triton {
       this->eval = ((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1276,9 +1388,11 @@ namespace triton {
       this->eval = (op1Signed <= op2Signed);
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1339,9 +1453,11 @@ namespace triton {
       this->eval = (op1Signed < op2Signed);
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1406,9 +1522,11 @@ namespace triton {
         this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1473,9 +1591,11 @@ namespace triton {
         this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1529,9 +1649,11 @@ namespace triton {
       this->eval = ((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1589,9 +1711,11 @@ namespace triton {
         this->eval = (this->childs[0]->evaluate() / this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1645,9 +1769,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() >= this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1701,9 +1827,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() > this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1757,9 +1885,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() <= this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1813,9 +1943,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() < this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1873,9 +2005,11 @@ namespace triton {
         this->eval = (this->childs[0]->evaluate() % this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1929,9 +2063,11 @@ namespace triton {
       this->eval = (~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -1985,9 +2121,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2053,9 +2191,11 @@ namespace triton {
       this->eval = (value & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2106,9 +2246,11 @@ namespace triton {
       this->eval = 0;
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2184,9 +2326,11 @@ namespace triton {
         this->eval = ((this->eval << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2290,9 +2434,11 @@ namespace triton {
       this->eval = this->childs[1]->evaluate();
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2343,9 +2489,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() != this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2396,9 +2544,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() == this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2465,9 +2615,11 @@ namespace triton {
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2522,9 +2674,11 @@ namespace triton {
       this->eval = this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate();
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2575,9 +2729,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2632,9 +2788,11 @@ namespace triton {
       this->eval = this->childs[2]->evaluate();
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2684,9 +2842,11 @@ namespace triton {
       this->eval = !(this->childs[0]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2737,9 +2897,11 @@ namespace triton {
       this->eval = (this->childs[0]->evaluate() || this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2783,17 +2945,20 @@ namespace triton {
 
     void ReferenceNode::init(void) {
       /* Init attributes */
-      if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
+      if (!triton::API::getCurrent().isSymbolicExpressionIdExists(this->value)) {
         this->eval        = 0;
         this->size        = 0;
         this->symbolized  = false;
+        this->initInformation();
       }
       else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
-        this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
-        this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
+        this->eval        = triton::API::getCurrent().getAstFromId(this->value)->evaluate();
+        this->size        = triton::API::getCurrent().getAstFromId(this->value)->getBitvectorSize();
+        this->symbolized  = triton::API::getCurrent().getAstFromId(this->value)->isSymbolized();
+        this->initInformation();
+        this->spreadInformation(triton::API::getCurrent().getAstFromId(this->value));
 
-        triton::api.getAstFromId(this->value)->setParent(this);
+        triton::API::getCurrent().getAstFromId(this->value)->setParent(this);
       }
 
       /* Init parents */
@@ -2906,9 +3071,11 @@ namespace triton {
       this->eval = ((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -2953,11 +3120,12 @@ namespace triton {
     void VariableNode::init(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
-      symVar = triton::api.getSymbolicVariableFromName(this->value);
+      symVar = triton::API::getCurrent().getSymbolicVariableFromName(this->value);
       if (symVar) {
         this->size        = symVar->getSize();
         this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
         this->symbolized  = true;
+        this->variables   = std::make_shared<const std::vector<triton::usize>>(1, symVar->getId());
       }
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
@@ -3025,9 +3193,11 @@ namespace triton {
       this->eval = (this->childs[1]->evaluate() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->initInformation();
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
+        this->spreadInformation(this->childs[index]);
       }
 
       /* Init parents */
@@ -3061,7 +3231,7 @@ namespace triton {
 
     /* Representation dispatcher from an abstract node */
     std::ostream& operator<<(std::ostream& stream, AbstractNode* node) {
-      return triton::ast::representations::astRepresentation.print(stream, node);
+      return triton::API::getCurrent().printAstRepresentation(stream, node);
     }
 
 
@@ -3126,7 +3296,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) AssertNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3134,7 +3304,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvNode(value, size);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3142,7 +3312,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvaddNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3150,7 +3320,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3158,7 +3328,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvashrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3166,7 +3336,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvdeclNode(size);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3174,7 +3344,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvNode(0, 1);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3182,7 +3352,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvlshrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3190,7 +3360,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvmulNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3198,7 +3368,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3206,7 +3376,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnegNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3214,7 +3384,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3222,7 +3392,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3230,7 +3400,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3238,7 +3408,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3246,7 +3416,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3254,7 +3424,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3262,7 +3432,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3270,7 +3440,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsdivNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3278,7 +3448,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsgeNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3286,7 +3456,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsgtNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3294,7 +3464,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvshlNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3302,7 +3472,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsleNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3310,7 +3480,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsltNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3318,7 +3488,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsmodNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3326,7 +3496,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsremNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3334,7 +3504,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsubNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3342,7 +3512,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvNode(1, 1);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3350,7 +3520,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvudivNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3358,7 +3528,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvugeNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3366,7 +3536,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvugtNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3374,7 +3544,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvuleNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3382,7 +3552,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvultNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3390,7 +3560,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvuremNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3398,7 +3568,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvxnorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3406,7 +3576,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvxorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3414,7 +3584,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) CompoundNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3422,7 +3592,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ConcatNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3430,7 +3600,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3438,7 +3608,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3446,7 +3616,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) DecimalNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3454,7 +3624,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) DeclareFunctionNode(name, bvDecl);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3462,7 +3632,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) DistinctNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3470,7 +3640,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) EqualNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3478,7 +3648,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ExtractNode(high, low, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3486,7 +3656,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) IteNode(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3494,7 +3664,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3502,7 +3672,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LetNode(alias, expr2, expr3);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3510,7 +3680,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3518,7 +3688,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3526,7 +3696,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ReferenceNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3534,7 +3704,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) StringNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3542,7 +3712,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) SxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
@@ -3551,8 +3721,8 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) VariableNode(symVar);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      ret = triton::api.recordAstNode(node);
-      triton::api.recordVariableAstNode(symVar.getName(), ret);
+      ret = triton::API::getCurrent().recordAstNode(node);
+      triton::API::getCurrent().recordVariableAstNode(symVar.getName(), ret);
       return ret;
     }
 
@@ -3561,7 +3731,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ZxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::API::getCurrent().recordAstNode(node);
     }
 
 
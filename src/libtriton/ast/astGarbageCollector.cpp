@@ -76,7 +76,8 @@ namespace triton {
       }
       else {
         /* Record the node */
-        this->allocatedNodes.insert(node);
+        if (this->allocatedNodes.insert(node).second && !this->snapshots.empty())
+          this->nodeJournal.push_back(node);
       }
       return node;
     }
@@ -118,6 +119,49 @@ namespace triton {
       this->variableNodes = nodes;
     }
 
+
+
+    void AstGarbageCollector::takeSnapshot(void) {
+      this->snapshots.push_back(this->nodeJournal.size());
+    }
+
+
+    void AstGarbageCollector::restoreSnapshot(triton::usize index) {
+      std::set<triton::ast::AbstractNode*> nodes;
+
+      if (index >= this->snapshots.size())
+        throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::restoreSnapshot(): Invalid snapshot index.");
+
+      /* Only nodes still alive are freed (some of them may have already been freed by the IR builder) */
+      for (triton::usize i = this->snapshots[index]; i < this->nodeJournal.size(); i++) {
+        if (this->allocatedNodes.find(this->nodeJournal[i]) != this->allocatedNodes.end())
+          nodes.insert(this->nodeJournal[i]);
+      }
+
+      /* Unlink nodes from their surviving childs */
+      for (std::set<triton::ast::AbstractNode*>::iterator it = nodes.begin(); it != nodes.end(); it++) {
+        std::vector<triton::ast::AbstractNode*>& childs = (*it)->getChilds();
+        for (triton::usize i = 0; i < childs.size(); i++) {
+          if (nodes.find(childs[i]) == nodes.end() && this->allocatedNodes.find(childs[i]) != this->allocatedNodes.end())
+            childs[i]->removeParent(*it);
+        }
+      }
+
+      this->freeAstNodes(nodes);
+      this->nodeJournal.resize(this->snapshots[index]);
+      this->snapshots.resize(index + 1);
+    }
+
+
+    void AstGarbageCollector::discardSnapshots(triton::usize index) {
+      if (index >= this->snapshots.size())
+        return;
+
+      this->snapshots.resize(index);
+      if (this->snapshots.empty())
+        this->nodeJournal.clear();
+    }
+
   }; /* ast namespace */
 }; /*triton namespace */
 
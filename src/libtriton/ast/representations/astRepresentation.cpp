@@ -16,10 +16,6 @@ namespace triton {
   namespace ast {
     namespace representations {
 
-      /* External access to the AST representation API */
-      AstRepresentation astRepresentation = AstRepresentation();
-
-
       AstRepresentation::AstRepresentation() {
         /* Set the default representation */
         this->mode = triton::ast::representations::SMT_REPRESENTATION;
@@ -81,6 +81,12 @@ namespace triton {
         initCallbackNamespace(callbackDict);
         PyObject* idCallbackDictClass = xPyClass_New(nullptr, callbackDict, xPyString_FromString("CALLBACK"));
 
+        /* Create the CONCRETIZATION namespace ======================================================= */
+
+        PyObject* concretizationDict = xPyDict_New();
+        initConcretizationNamespace(concretizationDict);
+        PyObject* idConcretizationClass = xPyClass_New(nullptr, concretizationDict, xPyString_FromString("CONCRETIZATION"));
+
         /* Create the CPUSIZE namespace ============================================================== */
 
         triton::bindings::python::cpuSizeDict = xPyDict_New();
@@ -146,6 +152,7 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_NODE",            idAstNodeDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_REPRESENTATION",  idAstRepresentationDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CALLBACK",            idCallbackDictClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "CONCRETIZATION",      idConcretizationClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "ELF",                 idElfDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);            /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);            /* Empty: filled on the fly */
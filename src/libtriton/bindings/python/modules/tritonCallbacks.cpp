@@ -74,6 +74,12 @@ If you want to use the libTriton without Python bindings, recompile the project
 - <b>void addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>void addConcretizationRange(integer start, integer end)</b><br>
+Adds a concretization range [start, end]. Once an instruction is processed, its symbolic stores which overlap a range are concretized.
+
+- <b>void addFastForwardStop(integer addr)</b><br>
+Adds an address where the fast-forward mode is disabled. The instruction at this address is processed symbolically.
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -96,9 +102,27 @@ Builds a symbolic memory cell from a \ref py_MemoryAccess_page with the SSA form
 - <b>\ref py_AstNode_page buildSymbolicRegister(\ref py_REG_page reg)</b><br>
 Builds a symbolic register from a \ref py_REG_page with the SSA form.
 
+- <b>void clearConcretizationEvents(void)</b><br>
+Clears the log of the concretizations applied by the concretization policy.
+
+- <b>void clearConcretizationRanges(void)</b><br>
+Removes all concretization ranges.
+
+- <b>void clearDirtyMemoryPages(void)</b><br>
+Marks all memory pages as clean. See getDirtyMemoryPages().
+
+- <b>void clearDisassemblyCache(void)</b><br>
+Removes all decoded instructions from the disassembly cache.
+
+- <b>void clearFastForwardStops(void)</b><br>
+Removes all addresses where the fast-forward mode is disabled.
+
 - <b>void clearPathConstraints(void)</b><br>
 Clears the logical conjunction vector of path constraints.
 
+- <b>void clearSemanticsTemplates(void)</b><br>
+Removes all semantics templates recorded with the \ref py_OPTIMIZATION_page `SEMANTICS_TEMPLATES` optimization.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -144,6 +168,15 @@ Returns the new symbolic volatile expression and links this expression to the in
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- <b>void enableFastForward(bool flag)</b><br>
+Enables or disables the fast-forward mode. In this mode, the instructions are executed on the concrete state only, without
+building any symbolic expression, until an instruction touches a symbolized or tainted operand, a stop address is reached or
+the limit of instructions is reached. Then the mode is disabled and the instructions are processed symbolically. The unsupported
+instructions are processed symbolically without disabling the mode.
+
+- <b>void enableProfilingTrace(bool flag)</b><br>
+Enables or disables the recording of the profiled stages for saveProfilingTrace(). At most 1048576 stages are recorded.
+
 - <b>void enableSymbolicEngine(bool flag)</b><br>
 Enables or disables the symbolic execution engine.
 
@@ -183,12 +216,36 @@ Returns the concrete value of memory cells.
 - <b>integer getConcreteRegisterValue(\ref py_REG_page reg)</b><br>
 Returns the concrete value of a register.
 
+- <b>[dict, ...] getConcretizationEvents(void)</b><br>
+Returns the log of the concretizations applied by the concretization policy. Each event is a dictionary with the
+keys `reason` (\ref py_CONCRETIZATION_page), `kind` (\ref py_SYMEXPR_page), `register` or `memory`, `address` and
+`index` of the instruction, `exprId` of the dropped expression, its `depth`, its number of `nodes` and the `age`
+of the location in instructions.
+
+- <b>integer getConcretizationLimit(\ref py_CONCRETIZATION_page kind)</b><br>
+Returns a limit of the concretization policy. 0 means that the limit is disabled.
+
+- <b>[integer, ...] getDirtyMemoryPages(void)</b><br>
+Returns the sorted base addresses of the 4 KiB memory pages written or unmapped since the last call to clearDirtyMemoryPages().
+
+- <b>dict getDisassemblyCacheStats(void)</b><br>
+Returns a dictionary which contains the number of `entries` of the disassembly cache and the number of lookups which `hits` or `misses`.
+
+- <b>integer getFastForwardCount(void)</b><br>
+Returns the number of instructions processed in the fast-forward mode since it has been enabled.
+
 - <b>\ref py_AstNode_page getFullAst(\ref py_AstNode_page node)</b><br>
 Returns the full AST without SSA form from a given root node.
 
 - <b>\ref py_AstNode_page getFullAstFromId(integer symExprId)</b><br>
 Returns the full AST without SSA form from a symbolic expression id.
 
+- <b>[integer, ...] getMemoryLabels(intger addr)</b><br>
+Returns the sorted taint labels of an address.
+
+- <b>[integer, ...] getMemoryLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the sorted union of the taint labels of a memory.
+
 - <b>dict getModel(\ref py_AstNode_page node)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 
@@ -198,12 +255,33 @@ Computes and returns several models from a symbolic constraint. The `limit` is t
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
+- <b>integer getNumberOfSnapshots(void)</b><br>
+Returns the number of snapshots alive.
+
 - <b>[\ref py_PathConstraint_page, ...] getPathConstraints(void)</b><br>
 Returns the logical conjunction vector of path constraints as list of \ref py_PathConstraint_page.
 
 - <b>\ref py_AstNode_page getPathConstraintsAst(void)</b><br>
 Returns the logical conjunction AST of path constraints.
 
+- <b>dict getProfilingOpcodesStats(void)</b><br>
+Returns a dictionary of {\ref py_OPCODE_page opcode : dict} which contains, for each opcode processed, the number of instructions
+(`count`), the AST nodes recorded (`nodes`), the symbolic expressions created (`expressions`) and the cycles spent (`cycles`).
+
+- <b>dict getProfilingStats(void)</b><br>
+Returns a dictionary of the profiling counters. Each stage of the processing (`processing`, `disassembly`, `fastForward`, `semantics`,
+`simplification`, `astRecording`, `taint` and `postIr`) has a number of `<stage>.calls`, the `<stage>.cycles` spent in the stage
+itself and the `<stage>.totalCycles` spent with its nested stages. The other counters are the AST `nodes` recorded, the symbolic
+`expressions` and `variables` created, the symbolic variables alive (`variablesAlive`) and the recorded `events`. All counters stay
+at zero if isProfilingAvailable() is false.
+
+- <b>[integer, ...] getRegisterLabels(\ref py_REG_page reg)</b><br>
+Returns the sorted taint labels of a register.
+
+- <b>dict getSemanticsTemplatesStats(void)</b><br>
+Returns a dictionary which contains the number of `entries` of semantics templates, the number of instructions built from a template (`hits`)
+and the number of instructions recorded as template (`misses`).
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(intger symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -240,8 +318,14 @@ Returns the symbolic variable corresponding to a symbolic variable name.
 - <b>dict getSymbolicVariables(void)</b><br>
 Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
 
+- <b>[\ref py_SymbolicVariable_page, ...] getSymbolicVariablesFromAst(\ref py_AstNode_page node)</b><br>
+Returns the list of the symbolic variables a node depends on. This list comes from the dependency set carried by the node, the tree is not walked.
+
 - <b>[intger, ...] getTaintedMemory(void)</b><br>
-Returns the list of all tainted addresses.
+Returns the list of all tainted addresses. On large tainted areas, prefer getTaintedMemoryAreas().
+
+- <b>[tuple, ...] getTaintedMemoryAreas(void)</b><br>
+Returns the list of the tainted memory areas as sorted and disjoint tuples <integer baseAddr, integer size>.
 
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
 Returns the list of all tainted registers.
@@ -249,9 +333,16 @@ Returns the list of all tainted registers.
 - <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(void)</b><br>
 Returns the list of all tainted symbolic expressions.
 
+- <b>void invalidateDisassemblyCache(integer baseAddr, integer size)</b><br>
+Removes the decoded instructions which overlap the range `[baseAddr:size]` from the disassembly cache. Note that an instruction
+is decoded again if its opcodes differ from the cached ones, so this is only needed to free entries.
+
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
+- <b>bool isFastForwardEnabled(void)</b><br>
+Returns true if the fast-forward mode is enabled.
+
 - <b>bool isMemoryMapped(integer baseAddr, integer size=1)</b><br>
 Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation.
 
@@ -267,12 +358,18 @@ Returns true if the address is tainted.
 - <b>bool isMemoryTainted(\ref py_MemoryAccess_page mem)</b><br>
 Returns true if the memory is tainted.
 
+- <b>bool isProfilingAvailable(void)</b><br>
+Returns true if the library has been built with the profiling hooks (`cmake -DPROFILING=on`).
+
 - <b>bool isRegisterSymbolized(\ref py_REG_page reg)</b><br>
 Returns true if the register expression contains a symbolic variable.
 
 - <b>bool isRegisterTainted(\ref py_REG_page reg)</b><br>
 Returns true if the register is tainted.
 
+- <b>bool isSnapshotExists(integer id)</b><br>
+Returns true if the snapshot id exists.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -285,24 +382,61 @@ Returns true if the symbolic optimization is enabled.
 - <b>bool isTaintEngineEnabled(void)</b><br>
 Returns true if the taint engine is enabled.
 
+- <b>bool labelMemory(intger addr, integer label)</b><br>
+Taints an address and adds `label` to its taint labels. Once a label is set, the taint engine spreads the label sets
+along with the taint, so one run tracks which inputs reach each location. Returns true if the address is tainted.
+
+- <b>bool labelMemory(\ref py_MemoryAccess_page mem, integer label)</b><br>
+Taints a memory and adds `label` to the taint labels of each of its bytes. Returns true if the memory is tainted.
+
+- <b>bool labelRegister(\ref py_REG_page reg, integer label)</b><br>
+Taints a register and adds `label` to its taint labels. Returns true if the register is tainted.
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment="")</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(intger varSize, string comment="")</b><br>
 Returns a new symbolic variable.
 
+- <b>integer processBlock(integer addr, integer maxInstructions=0, [integer,] stopAddresses=[])</b><br>
+Processes the basic block at `addr`, up to its first control flow instruction, as run() does. Returns the number of
+instructions processed.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
 - <b>void removeAllCallbacks(void)</b><br>
 Removes all recorded callbacks.
 
+- <b>void removeAllSnapshots(void)</b><br>
+Removes all snapshots.
+
 - <b>void removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- <b>void removeSnapshot(integer id)</b><br>
+Removes the snapshot `id` and all snapshots taken after it.
+
 - <b>void resetEngines(void)</b><br>
 Resets everything.
 
+- <b>void resetProfiling(void)</b><br>
+Resets all profiling counters and drops the recorded stages.
+
+- <b>void restoreSnapshot(integer id)</b><br>
+Restores the concrete, symbolic and taint states at the snapshot `id`. The snapshot is kept alive but all snapshots
+taken after it are discarded.
+
+- <b>integer run(integer addr, integer maxInstructions=0, [integer,] stopAddresses=[])</b><br>
+Processes the instructions from `addr` and follows the program counter, without going back to Python for each
+instruction. The opcodes are fetched from the concrete memory. The run stops before an unmapped address or an address
+of `stopAddresses` (except `addr`, so that a run may be resumed), after `maxInstructions` instructions (0 if unlimited)
+or after an unsupported instruction. The callbacks are called during the run. Returns the number of instructions processed.
+
+- <b>void saveProfilingTrace(string path)</b><br>
+Writes the stages recorded since enableProfilingTrace() into `path` in the Chrome trace-event JSON format, which may be loaded in
+`chrome://tracing` for a timeline view.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -329,6 +463,14 @@ the symbolic state (if it exists). You should probably use the concretize functi
 Sets the concrete value of a register. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- <b>void setConcretizationLimit(\ref py_CONCRETIZATION_page kind, integer limit)</b><br>
+Sets a limit of the concretization policy. Once an instruction is processed, the registers and memory it wrote are
+concretized if their symbolized expression exceeds the limit. 0 disables the limit.<br>
+e.g: `setConcretizationLimit(CONCRETIZATION.MAX_DEPTH, 100)`
+
+- <b>void setFastForwardLimit(integer limit)</b><br>
+Sets the maximum number of instructions processed in the fast-forward mode. 0 means no limit.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -339,8 +481,13 @@ Sets the targeted register as tainted or not. Returns true if the register is st
 Calls all simplification callbacks recorded and returns a new simplified node. If the `z3` flag is
 set to True, Triton will use z3 to simplify the given `node` before to call its recorded callbacks.
 
-- <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
+- <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr, integer depth=SYMEXPR.UNSET)</b><br>
 Slices expressions from a given one and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+The `depth` bounds the number of dependency levels followed (e.g: `1` returns only the direct dependencies). By default, the slice is unbounded.
+
+- <b>integer takeSnapshot(void)</b><br>
+Takes a snapshot of the concrete, symbolic and taint states and returns its id. Taking a snapshot is cheap, only
+modifications made after it are journaled.
 
 - <b>bool taintAssignmentMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
@@ -414,6 +561,7 @@ Untaints a register. Returns true if the register is still tainted.
 - \ref py_AST_NODE_page
 - \ref py_AST_REPRESENTATION_page
 - \ref py_CALLBACK_page
+- \ref py_CONCRETIZATION_page
 - \ref py_CPUSIZE_page
 - \ref py_ELF_page
 - \ref py_OPCODE_page
@@ -750,6 +898,55 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addConcretizationRange(PyObject* self, PyObject* args) {
+        PyObject* start = nullptr;
+        PyObject* end   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addConcretizationRange(): Architecture is not defined.");
+
+        if (start == nullptr || (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "addConcretizationRange(): Expects a start address (integer) as first argument.");
+
+        if (end == nullptr || (!PyLong_Check(end) && !PyInt_Check(end)))
+          return PyErr_Format(PyExc_TypeError, "addConcretizationRange(): Expects an end address (integer) as second argument.");
+
+        try {
+          triton::api.addConcretizationRange(PyLong_AsUint64(start), PyLong_AsUint64(end));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_addFastForwardStop(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addFastForwardStop(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "addFastForwardStop(): Expects an address (integer) as argument.");
+
+        try {
+          triton::api.addFastForwardStop(PyLong_AsUint64(addr));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -884,6 +1081,56 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearConcretizationEvents(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearConcretizationEvents(): Architecture is not defined.");
+        triton::api.clearConcretizationEvents();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearConcretizationRanges(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearConcretizationRanges(): Architecture is not defined.");
+        triton::api.clearConcretizationRanges();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearDirtyMemoryPages(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearDirtyMemoryPages(): Architecture is not defined.");
+        triton::api.clearDirtyMemoryPages();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearDisassemblyCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearDisassemblyCache(): Architecture is not defined.");
+        triton::api.clearDisassemblyCache();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearFastForwardStops(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearFastForwardStops(): Architecture is not defined.");
+        triton::api.clearFastForwardStops();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_clearPathConstraints(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -894,6 +1141,16 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearSemanticsTemplates(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearSemanticsTemplates(): Architecture is not defined.");
+        triton::api.clearSemanticsTemplates();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1255,6 +1512,42 @@ namespace triton {
       }
 
 
+      static PyObject* triton_enableFastForward(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableFastForward(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableFastForward(): Expects an boolean as argument.");
+
+        try {
+          triton::api.enableFastForward(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_enableProfilingTrace(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableProfilingTrace(): Expects an boolean as argument.");
+
+        try {
+          triton::api.enableProfilingTrace(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_enableSymbolicEngine(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1491,6 +1784,117 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getConcretizationEvents(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcretizationEvents(): Architecture is not defined.");
+
+        try {
+          const auto& events = triton::api.getConcretizationEvents();
+
+          ret = xPyList_New(events.size());
+          for (triton::usize index = 0; index < events.size(); index++) {
+            PyObject* event = xPyDict_New();
+            PyDict_SetItemString(event, "reason",   PyLong_FromUint32(events[index].reason));
+            PyDict_SetItemString(event, "kind",     PyLong_FromUint32(events[index].kind));
+            PyDict_SetItemString(event, "address",  PyLong_FromUint64(events[index].address));
+            PyDict_SetItemString(event, "index",    PyLong_FromUint64(events[index].index));
+            PyDict_SetItemString(event, "exprId",   PyLong_FromUsize(events[index].exprId));
+            PyDict_SetItemString(event, "depth",    PyLong_FromUint32(events[index].depth));
+            PyDict_SetItemString(event, "nodes",    PyLong_FromUint64(events[index].nodes));
+            PyDict_SetItemString(event, "age",      PyLong_FromUint64(events[index].age));
+            if (events[index].kind == triton::engines::symbolic::REG)
+              PyDict_SetItemString(event, "register", PyRegister(events[index].reg));
+            else
+              PyDict_SetItemString(event, "memory", PyMemoryAccess(events[index].mem));
+            PyList_SetItem(ret, index, event);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getConcretizationLimit(PyObject* self, PyObject* kind) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcretizationLimit(): Architecture is not defined.");
+
+        if (!PyLong_Check(kind) && !PyInt_Check(kind))
+          return PyErr_Format(PyExc_TypeError, "getConcretizationLimit(): Expects a CONCRETIZATION as argument.");
+
+        try {
+          return PyLong_FromUint64(triton::api.getConcretizationLimit(static_cast<enum triton::engines::symbolic::concretization_e>(PyLong_AsUint32(kind))));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getDirtyMemoryPages(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getDirtyMemoryPages(): Architecture is not defined.");
+
+        try {
+          std::vector<triton::uint64> pages = triton::api.getDirtyMemoryPages();
+
+          ret = xPyList_New(pages.size());
+          for (triton::usize index = 0; index < pages.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint64(pages[index]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getDisassemblyCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getDisassemblyCacheStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getDisassemblyCacheStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getFastForwardCount(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getFastForwardCount(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.getFastForwardCount());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1525,6 +1929,41 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getMemoryLabels(PyObject* self, PyObject* mem) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Architecture is not defined.");
+
+        try {
+          std::vector<triton::uint32> labels;
+
+          if (PyMemoryAccess_Check(mem))
+            labels = triton::api.getMemoryLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem))
+            labels = triton::api.getMemoryLabels(PyLong_AsUint64(mem));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Expects a MemoryAccess or an integer as argument.");
+
+          size = labels.size();
+          ret = xPyList_New(size);
+          for (auto it = labels.begin(); it != labels.end(); it++) {
+            PyList_SetItem(ret, index, PyLong_FromUint32(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getModel(PyObject* self, PyObject* node) {
         PyObject* ret = nullptr;
 
@@ -1592,20 +2031,34 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* triton_getNumberOfSnapshots(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getParentRegisters(): Architecture is not defined.");
+          return PyErr_Format(PyExc_TypeError, "getNumberOfSnapshots(): Architecture is not defined.");
 
         try {
-          triton::uint32 index = 0;
-          std::set<triton::arch::Register*> reg = triton::api.getParentRegisters();
-          ret = xPyList_New(reg.size());
-
-          for (auto it = reg.begin(); it != reg.end(); it++)
-            PyList_SetItem(ret, index++, PyRegister(**it));
+          return PyLong_FromUsize(triton::api.getNumberOfSnapshots());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getParentRegisters(): Architecture is not defined.");
+
+        try {
+          triton::uint32 index = 0;
+          std::set<triton::arch::Register*> reg = triton::api.getParentRegisters();
+          ret = xPyList_New(reg.size());
+
+          for (auto it = reg.begin(); it != reg.end(); it++)
+            PyList_SetItem(ret, index++, PyRegister(**it));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1652,6 +2105,99 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getProfilingOpcodesStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& opcodes = triton::api.getProfilingOpcodesStats();
+
+          ret = xPyDict_New();
+          for (auto it = opcodes.begin(); it != opcodes.end(); it++) {
+            PyObject* stats = xPyDict_New();
+            PyDict_SetItem(stats, PyString_FromString("count"), PyLong_FromUsize(it->second.count));
+            PyDict_SetItem(stats, PyString_FromString("cycles"), PyLong_FromUint64(it->second.cycles));
+            PyDict_SetItem(stats, PyString_FromString("expressions"), PyLong_FromUsize(it->second.expressions));
+            PyDict_SetItem(stats, PyString_FromString("nodes"), PyLong_FromUsize(it->second.nodes));
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), stats);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getProfilingStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          std::map<std::string, triton::uint64> stats = triton::api.getProfilingStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUint64(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getRegisterLabels(PyObject* self, PyObject* reg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getRegisterLabels(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterLabels(): Expects a REG as argument.");
+
+        try {
+          std::vector<triton::uint32> labels = triton::api.getRegisterLabels(*PyRegister_AsRegister(reg));
+
+          size = labels.size();
+          ret = xPyList_New(size);
+          for (auto it = labels.begin(); it != labels.end(); it++) {
+            PyList_SetItem(ret, index, PyLong_FromUint32(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSemanticsTemplatesStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSemanticsTemplatesStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getSemanticsTemplatesStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1865,6 +2411,34 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getSymbolicVariablesFromAst(PyObject* self, PyObject* node) {
+        PyObject* ret = nullptr;
+        triton::usize index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariablesFromAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariablesFromAst(): Expects a AstNode as argument.");
+
+        try {
+          auto variables = triton::api.getSymbolicVariablesFromAst(PyAstNode_AsAstNode(node));
+
+          ret = xPyList_New(variables.size());
+          for (auto it = variables.begin(); it != variables.end(); it++) {
+            PyList_SetItem(ret, index, PySymbolicVariable(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getTaintedMemory(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -1891,6 +2465,35 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getTaintedMemoryAreas(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryAreas(): Architecture is not defined.");
+
+        try {
+          std::vector<std::pair<triton::uint64, triton::usize>> areas = triton::api.getTaintedMemoryAreas();
+
+          size = areas.size();
+          ret = xPyList_New(size);
+          for (auto it = areas.begin(); it != areas.end(); it++) {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, PyLong_FromUint64(it->first));
+            PyTuple_SetItem(item, 1, PyLong_FromUsize(it->second));
+            PyList_SetItem(ret, index, item);
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getTaintedRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -1943,6 +2546,35 @@ namespace triton {
       }
 
 
+      static PyObject* triton_invalidateDisassemblyCache(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "invalidateDisassemblyCache(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "invalidateDisassemblyCache(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "invalidateDisassemblyCache(): Expects a size (integer) as second argument.");
+
+        try {
+          triton::api.invalidateDisassemblyCache(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_isArchitectureValid(PyObject* self, PyObject* noarg) {
         if (triton::api.isArchitectureValid() == true)
           Py_RETURN_TRUE;
@@ -1950,6 +2582,22 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isFastForwardEnabled(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isFastForwardEnabled(): Architecture is not defined.");
+
+        try {
+          if (triton::api.isFastForwardEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_isMemoryMapped(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -2027,6 +2675,13 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isProfilingAvailable(PyObject* self, PyObject* noarg) {
+        if (triton::api.isProfilingAvailable() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_isRegisterSymbolized(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2055,6 +2710,25 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isSnapshotExists(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSnapshotExists(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "isSnapshotExists(): Expects an integer as argument.");
+
+        try {
+          if (triton::api.isSnapshotExists(PyLong_AsUsize(id)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "isSymbolicEngineEnabled(): Architecture is not defined.");
@@ -2101,6 +2775,69 @@ namespace triton {
       }
 
 
+      static PyObject* triton_labelMemory(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Architecture is not defined.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Expects an integer as second argument.");
+
+        try {
+          if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+            if (triton::api.labelMemory(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+            if (triton::api.labelMemory(PyLong_AsUint64(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "labelMemory(): Expects a MemoryAccess or an integer as first argument.");
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_labelRegister(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Architecture is not defined.");
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Expects a REG as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Expects an integer as second argument.");
+
+        try {
+          if (triton::api.labelRegister(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -2161,6 +2898,50 @@ namespace triton {
       }
 
 
+      static PyObject* triton_processBlock(PyObject* self, PyObject* args) {
+        PyObject* addr  = nullptr;
+        PyObject* limit = nullptr;
+        PyObject* stops = nullptr;
+        std::set<triton::uint64> stopAddresses;
+        triton::usize maxInstructions = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &addr, &limit, &stops);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects an address (integer) as first argument.");
+
+        if (limit != nullptr && !PyLong_Check(limit) && !PyInt_Check(limit))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects a number of instructions (integer) as second argument.");
+
+        if (stops != nullptr && !PyList_Check(stops))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects a list of addresses as third argument.");
+
+        if (limit != nullptr)
+          maxInstructions = PyLong_AsUsize(limit);
+
+        if (stops != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(stops); i++) {
+            PyObject* item = PyList_GetItem(stops, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "processBlock(): Each stop address must be an integer.");
+            stopAddresses.insert(PyLong_AsUint64(item));
+          }
+        }
+
+        try {
+          return PyLong_FromUsize(triton::api.processBlock(PyLong_AsUint64(addr), maxInstructions, stopAddresses));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_processing(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2193,6 +2974,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_removeAllSnapshots(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeAllSnapshots(): Architecture is not defined.");
+
+        try {
+          triton::api.removeAllSnapshots();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_removeCallback(PyObject* self, PyObject* args) {
         PyObject* function = nullptr;
         PyObject* mode     = nullptr;
@@ -2222,6 +3020,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_removeSnapshot(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSnapshot(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "removeSnapshot(): Expects an integer as argument.");
+
+        try {
+          triton::api.removeSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2239,6 +3057,99 @@ namespace triton {
       }
 
 
+      static PyObject* triton_resetProfiling(PyObject* self, PyObject* noarg) {
+        try {
+          triton::api.resetProfiling();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_restoreSnapshot(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "restoreSnapshot(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "restoreSnapshot(): Expects an integer as argument.");
+
+        try {
+          triton::api.restoreSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_run(PyObject* self, PyObject* args) {
+        PyObject* addr  = nullptr;
+        PyObject* limit = nullptr;
+        PyObject* stops = nullptr;
+        std::set<triton::uint64> stopAddresses;
+        triton::usize maxInstructions = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &addr, &limit, &stops);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "run(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "run(): Expects an address (integer) as first argument.");
+
+        if (limit != nullptr && !PyLong_Check(limit) && !PyInt_Check(limit))
+          return PyErr_Format(PyExc_TypeError, "run(): Expects a number of instructions (integer) as second argument.");
+
+        if (stops != nullptr && !PyList_Check(stops))
+          return PyErr_Format(PyExc_TypeError, "run(): Expects a list of addresses as third argument.");
+
+        if (limit != nullptr)
+          maxInstructions = PyLong_AsUsize(limit);
+
+        if (stops != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(stops); i++) {
+            PyObject* item = PyList_GetItem(stops, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "run(): Each stop address must be an integer.");
+            stopAddresses.insert(PyLong_AsUint64(item));
+          }
+        }
+
+        try {
+          return PyLong_FromUsize(triton::api.run(PyLong_AsUint64(addr), maxInstructions, stopAddresses));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_saveProfilingTrace(PyObject* self, PyObject* path) {
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "saveProfilingTrace(): Expects a string as argument.");
+
+        try {
+          triton::api.saveProfilingTrace(PyString_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2415,6 +3326,55 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setConcretizationLimit(PyObject* self, PyObject* args) {
+        PyObject* kind  = nullptr;
+        PyObject* limit = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &kind, &limit);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setConcretizationLimit(): Architecture is not defined.");
+
+        if (kind == nullptr || (!PyLong_Check(kind) && !PyInt_Check(kind)))
+          return PyErr_Format(PyExc_TypeError, "setConcretizationLimit(): Expects a CONCRETIZATION as first argument.");
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "setConcretizationLimit(): Expects a limit (integer) as second argument.");
+
+        try {
+          triton::api.setConcretizationLimit(static_cast<enum triton::engines::symbolic::concretization_e>(PyLong_AsUint32(kind)), PyLong_AsUint64(limit));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setFastForwardLimit(PyObject* self, PyObject* limit) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setFastForwardLimit(): Architecture is not defined.");
+
+        if (!PyLong_Check(limit) && !PyInt_Check(limit))
+          return PyErr_Format(PyExc_TypeError, "setFastForwardLimit(): Expects a limit (integer) as argument.");
+
+        try {
+          triton::api.setFastForwardLimit(PyLong_AsUsize(limit));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem    = nullptr;
         PyObject* flag   = nullptr;
@@ -2500,18 +3460,30 @@ namespace triton {
       }
 
 
-      static PyObject* triton_sliceExpressions(PyObject* self, PyObject* expr) {
-        PyObject* ret = nullptr;
+      static PyObject* triton_sliceExpressions(PyObject* self, PyObject* args) {
+        PyObject* expr        = nullptr;
+        PyObject* depth       = nullptr;
+        PyObject* ret         = nullptr;
+        triton::usize c_depth = triton::engines::symbolic::UNSET;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &expr, &depth);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Architecture is not defined.");
 
-        if (!PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Expects a SymbolicExpression as argument.");
+        if (expr == nullptr || !PySymbolicExpression_Check(expr))
+          return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Expects a SymbolicExpression as first argument.");
+
+        if (depth != nullptr && !PyLong_Check(depth) && !PyInt_Check(depth))
+          return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Expects a depth (integer) as second argument.");
+
+        if (depth != nullptr)
+          c_depth = PyLong_AsUsize(depth);
 
         try {
-          auto exprs = triton::api.sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr));
+          auto exprs = triton::api.sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr), c_depth);
 
           ret = xPyDict_New();
           for (auto it = exprs.begin(); it != exprs.end(); it++)
@@ -2525,6 +3497,20 @@ namespace triton {
       }
 
 
+      static PyObject* triton_takeSnapshot(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "takeSnapshot(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.takeSnapshot());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_taintAssignmentMemoryImmediate(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2957,13 +3943,21 @@ namespace triton {
         {"MemoryAccess",                        (PyCFunction)triton_MemoryAccess,                           METH_VARARGS,       ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addConcretizationRange",              (PyCFunction)triton_addConcretizationRange,                 METH_VARARGS,       ""},
+        {"addFastForwardStop",                  (PyCFunction)triton_addFastForwardStop,                     METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
         {"buildSymbolicImmediate",              (PyCFunction)triton_buildSymbolicImmediate,                 METH_O,             ""},
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
+        {"clearConcretizationEvents",           (PyCFunction)triton_clearConcretizationEvents,              METH_NOARGS,        ""},
+        {"clearConcretizationRanges",           (PyCFunction)triton_clearConcretizationRanges,              METH_NOARGS,        ""},
+        {"clearDirtyMemoryPages",               (PyCFunction)triton_clearDirtyMemoryPages,                  METH_NOARGS,        ""},
+        {"clearDisassemblyCache",               (PyCFunction)triton_clearDisassemblyCache,                  METH_NOARGS,        ""},
+        {"clearFastForwardStops",               (PyCFunction)triton_clearFastForwardStops,                  METH_NOARGS,        ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearSemanticsTemplates",             (PyCFunction)triton_clearSemanticsTemplates,                METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)triton_concretizeMemory,                       METH_O,             ""},
@@ -2978,6 +3972,8 @@ namespace triton {
         {"createSymbolicRegisterExpression",    (PyCFunction)triton_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)triton_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
         {"disassembly",                         (PyCFunction)triton_disassembly,                            METH_O,             ""},
+        {"enableFastForward",                   (PyCFunction)triton_enableFastForward,                      METH_O,             ""},
+        {"enableProfilingTrace",                (PyCFunction)triton_enableProfilingTrace,                   METH_O,             ""},
         {"enableSymbolicEngine",                (PyCFunction)triton_enableSymbolicEngine,                   METH_O,             ""},
         {"enableSymbolicOptimization",          (PyCFunction)triton_enableSymbolicOptimization,             METH_VARARGS,       ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
@@ -2990,13 +3986,24 @@ namespace triton {
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
+        {"getConcretizationEvents",             (PyCFunction)triton_getConcretizationEvents,                METH_NOARGS,        ""},
+        {"getConcretizationLimit",              (PyCFunction)triton_getConcretizationLimit,                 METH_O,             ""},
+        {"getDirtyMemoryPages",                 (PyCFunction)triton_getDirtyMemoryPages,                    METH_NOARGS,        ""},
+        {"getDisassemblyCacheStats",            (PyCFunction)triton_getDisassemblyCacheStats,               METH_NOARGS,        ""},
+        {"getFastForwardCount",                 (PyCFunction)triton_getFastForwardCount,                    METH_NOARGS,        ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
+        {"getMemoryLabels",                     (PyCFunction)triton_getMemoryLabels,                        METH_O,             ""},
         {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getNumberOfSnapshots",                (PyCFunction)triton_getNumberOfSnapshots,                   METH_NOARGS,        ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getProfilingOpcodesStats",            (PyCFunction)triton_getProfilingOpcodesStats,               METH_NOARGS,        ""},
+        {"getProfilingStats",                   (PyCFunction)triton_getProfilingStats,                      METH_NOARGS,        ""},
+        {"getRegisterLabels",                   (PyCFunction)triton_getRegisterLabels,                      METH_O,             ""},
+        {"getSemanticsTemplatesStats",          (PyCFunction)triton_getSemanticsTemplatesStats,             METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
@@ -3008,34 +4015,52 @@ namespace triton {
         {"getSymbolicVariableFromId",           (PyCFunction)triton_getSymbolicVariableFromId,              METH_O,             ""},
         {"getSymbolicVariableFromName",         (PyCFunction)triton_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)triton_getSymbolicVariables,                   METH_NOARGS,        ""},
+        {"getSymbolicVariablesFromAst",         (PyCFunction)triton_getSymbolicVariablesFromAst,            METH_O,             ""},
         {"getTaintedMemory",                    (PyCFunction)triton_getTaintedMemory,                       METH_NOARGS,        ""},
+        {"getTaintedMemoryAreas",               (PyCFunction)triton_getTaintedMemoryAreas,                  METH_NOARGS,        ""},
         {"getTaintedRegisters",                 (PyCFunction)triton_getTaintedRegisters,                    METH_NOARGS,        ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
+        {"invalidateDisassemblyCache",          (PyCFunction)triton_invalidateDisassemblyCache,             METH_VARARGS,       ""},
         {"isArchitectureValid",                 (PyCFunction)triton_isArchitectureValid,                    METH_NOARGS,        ""},
+        {"isFastForwardEnabled",                (PyCFunction)triton_isFastForwardEnabled,                   METH_NOARGS,        ""},
         {"isMemoryMapped",                      (PyCFunction)triton_isMemoryMapped,                         METH_VARARGS,       ""},
         {"isMemorySymbolized",                  (PyCFunction)triton_isMemorySymbolized,                     METH_O,             ""},
         {"isMemoryTainted",                     (PyCFunction)triton_isMemoryTainted,                        METH_O,             ""},
+        {"isProfilingAvailable",                (PyCFunction)triton_isProfilingAvailable,                   METH_NOARGS,        ""},
         {"isRegisterSymbolized",                (PyCFunction)triton_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)triton_isRegisterTainted,                      METH_O,             ""},
+        {"isSnapshotExists",                    (PyCFunction)triton_isSnapshotExists,                       METH_O,             ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)triton_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)triton_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isSymbolicOptimizationEnabled",       (PyCFunction)triton_isSymbolicOptimizationEnabled,          METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"labelMemory",                         (PyCFunction)triton_labelMemory,                            METH_VARARGS,       ""},
+        {"labelRegister",                       (PyCFunction)triton_labelRegister,                          METH_VARARGS,       ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"processBlock",                        (PyCFunction)triton_processBlock,                           METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
+        {"removeAllSnapshots",                  (PyCFunction)triton_removeAllSnapshots,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
+        {"removeSnapshot",                      (PyCFunction)triton_removeSnapshot,                         METH_O,             ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"resetProfiling",                      (PyCFunction)triton_resetProfiling,                         METH_NOARGS,        ""},
+        {"restoreSnapshot",                     (PyCFunction)triton_restoreSnapshot,                        METH_O,             ""},
+        {"run",                                 (PyCFunction)triton_run,                                    METH_VARARGS,       ""},
+        {"saveProfilingTrace",                  (PyCFunction)triton_saveProfilingTrace,                     METH_O,             ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)triton_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)triton_setConcreteRegisterValue,               METH_O,             ""},
+        {"setConcretizationLimit",              (PyCFunction)triton_setConcretizationLimit,                 METH_VARARGS,       ""},
+        {"setFastForwardLimit",                 (PyCFunction)triton_setFastForwardLimit,                    METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
-        {"sliceExpressions",                    (PyCFunction)triton_sliceExpressions,                       METH_O,             ""},
+        {"sliceExpressions",                    (PyCFunction)triton_sliceExpressions,                       METH_VARARGS,       ""},
+        {"takeSnapshot",                        (PyCFunction)triton_takeSnapshot,                           METH_NOARGS,        ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)triton_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)triton_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
         {"taintAssignmentMemoryRegister",       (PyCFunction)triton_taintAssignmentMemoryRegister,          METH_VARARGS,       ""},
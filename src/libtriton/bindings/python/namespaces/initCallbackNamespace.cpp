@@ -32,6 +32,15 @@ The CALLBACK namespace contains all kinds of callbacks.
 \section CALLBACK_py_api Python API - Items of the CALLBACK namespace
 <hr>
 
+- **CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE**<br>
+The callback takes as arguments the base address and the size (integers) of an area. Callbacks will be called once per
+memory read, whatever the size of the area, before the concrete value is read. The callback must return nothing.
+
+- **CALLBACK.GET_CONCRETE_MEMORY_PAGE**<br>
+The callback takes as unique argument the base address (integer) of a 4 KiB page. Callbacks will be called the first
+time that a byte of the page is read, before the concrete value is read, unless the page has been written before. The
+callback may fill the whole page with `setConcreteMemoryAreaValue()`. The callback must return nothing.
+
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as unique argument a \ref py_MemoryAccess_page. Callbacks will be called each time that the
 Triton library will need a concrete memory value. The callback must return nothing.
@@ -54,9 +63,11 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
-        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
-        PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
-        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_AREA_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_PAGE",       PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_PAGE));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",      PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE",    PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
+        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",        PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
       }
 
     }; /* python namespace */
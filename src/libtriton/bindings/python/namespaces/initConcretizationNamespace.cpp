@@ -0,0 +1,68 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+#include <symbolicEnums.hpp>
+
+
+
+/*! \page py_CONCRETIZATION_page CONCRETIZATION
+    \brief [**python api**] All information about the CONCRETIZATION python namespace.
+
+\tableofcontents
+
+\section CONCRETIZATION_py_description Description
+<hr>
+
+The CONCRETIZATION namespace contains all kinds of automatic concretization. Once an instruction is processed, the
+registers and memory it wrote are concretized if their symbolized expression exceeds a limit of the policy.
+
+\subsection CONCRETIZATION_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> setConcretizationLimit(CONCRETIZATION.MAX_DEPTH, 100)
+>>> addConcretizationRange(0x7fff0000, 0x7fffffff)
+~~~~~~~~~~~~~
+
+\section CONCRETIZATION_py_api Python API - Items of the CONCRETIZATION namespace
+<hr>
+
+- **CONCRETIZATION.ADDRESS_RANGE**<br>
+Symbolic stores which overlap a range added with `addConcretizationRange()` are concretized. This is not a limit.
+
+- **CONCRETIZATION.MAX_AGE**<br>
+Locations which are symbolized since more than N instructions are concretized.
+
+- **CONCRETIZATION.MAX_DEPTH**<br>
+Expressions deeper than N (references included) are concretized.
+
+- **CONCRETIZATION.MAX_NODES**<br>
+Expressions bigger than N nodes once unrolled are concretized.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initConcretizationNamespace(PyObject* concretizationDict) {
+        PyDict_SetItemString(concretizationDict, "ADDRESS_RANGE", PyLong_FromUint32(triton::engines::symbolic::ADDRESS_RANGE));
+        PyDict_SetItemString(concretizationDict, "MAX_AGE",       PyLong_FromUint32(triton::engines::symbolic::MAX_AGE));
+        PyDict_SetItemString(concretizationDict, "MAX_DEPTH",     PyLong_FromUint32(triton::engines::symbolic::MAX_DEPTH));
+        PyDict_SetItemString(concretizationDict, "MAX_NODES",     PyLong_FromUint32(triton::engines::symbolic::MAX_NODES));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
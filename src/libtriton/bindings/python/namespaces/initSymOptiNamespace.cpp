@@ -38,6 +38,10 @@ Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory
 - **OPTIMIZATION.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **OPTIMIZATION.CONSTANT_FOLDING**<br>
+Enabled, Triton will replace every non-symbolized subtree of a new symbolic expression by a single bitvector node of its
+concrete value. Unlike `ONLY_ON_SYMBOLIZED`, expressions are kept but reduced to their symbolic part.
+
 - **OPTIMIZATION.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -47,6 +51,11 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **OPTIMIZATION.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This optimization is enabled by default.
 
+- **OPTIMIZATION.SEMANTICS_TEMPLATES**<br>
+Enabled, Triton will record the semantics of an instruction the first time it is executed and will build it again from
+this template at the next executions. Templates are used only for a subset of data-flow instructions, when the taint engine
+is disabled and when the `AST_DICTIONARIES` and `CONSTANT_FOLDING` optimizations are disabled.
+
 */
 
 
@@ -58,9 +67,11 @@ namespace triton {
       void initSymOptiNamespace(PyObject* symOptiDict) {
         PyDict_SetItemString(symOptiDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::engines::symbolic::ALIGNED_MEMORY));
         PyDict_SetItemString(symOptiDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::engines::symbolic::AST_DICTIONARIES));
+        PyDict_SetItemString(symOptiDict, "CONSTANT_FOLDING",       PyLong_FromUint32(triton::engines::symbolic::CONSTANT_FOLDING));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::engines::symbolic::ONLY_ON_TAINTED));
         PyDict_SetItemString(symOptiDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::engines::symbolic::PC_TRACKING_SYMBOLIC));
+        PyDict_SetItemString(symOptiDict, "SEMANTICS_TEMPLATES",    PyLong_FromUint32(triton::engines::symbolic::SEMANTICS_TEMPLATES));
       }
 
     }; /* python namespace */
@@ -58,6 +58,9 @@ Returns the node vector size.
 - <b>[\ref py_AstNode_page, ...] getChilds(void)</b><br>
 Returns the list of child nodes.
 
+- <b>integer getDepth(void)</b><br>
+Returns the depth of the tree. References are followed and a leaf has a depth of 1.
+
 - <b>integer getHash(void)</b><br>
 Returns the hash (signature) of the AST .
 
@@ -65,12 +68,22 @@ Returns the hash (signature) of the AST .
 Returns the kind of the node.<br>
 e.g: `AST_NODE.BVADD`
 
+- <b>integer getNumberOfNodes(void)</b><br>
+Returns the number of nodes of the tree once references are unrolled. The count saturates.
+
 - <b>[\ref py_AstNode_page, ...] getParents(void)</b><br>
 Returns the parents list nodes. The list is empty if there is still no parent defined.
 
+- <b>[integer, ...] getSymbolicVariableIds(void)</b><br>
+Returns the sorted list of symbolic variable ids the tree depends on.<br>
+e.g: `[0, 3]`
+
 - <b>integer/string getValue(void)</b><br>
 Returns the node value (metadata) as integer or string (it depends of the kind). For example if the kind of node is `decimal`, the value is an integer.
 
+- <b>bool isDependentOn(integer symVarId)</b><br>
+Returns true if the tree depends on the symbolic variable id.
+
 - <b>bool isSigned(void)</b><br>
 According to the size of the expression, returns true if the MSB is 1.
 
@@ -143,6 +156,16 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getDepth(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyAstNode_AsAstNode(self)->getDepth());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash(1));
@@ -163,6 +186,16 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getNumberOfNodes(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getNumberOfNodes());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getParents(PyObject* self, PyObject* noarg) {
         try {
           PyObject* ret = nullptr;
@@ -179,6 +212,22 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getSymbolicVariableIds(PyObject* self, PyObject* noarg) {
+        try {
+          const std::vector<triton::usize>& ids = PyAstNode_AsAstNode(self)->getSymbolicVariableIds();
+          PyObject* ret = xPyList_New(ids.size());
+
+          for (triton::usize index = 0; index < ids.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(ids[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getValue(PyObject* self, PyObject* noarg) {
         try {
           triton::ast::AbstractNode *node = PyAstNode_AsAstNode(self);
@@ -203,6 +252,21 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_isDependentOn(PyObject* self, PyObject* symVarId) {
+        try {
+          if (!PyLong_Check(symVarId) && !PyInt_Check(symVarId))
+            return PyErr_Format(PyExc_TypeError, "AstNode::isDependentOn(): Expected a symbolic variable id (integer) as argument.");
+
+          if (PyAstNode_AsAstNode(self)->isDependentOn(PyLong_AsUsize(symVarId)))
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_isSigned(PyObject* self, PyObject* noarg) {
         try {
           if (PyAstNode_AsAstNode(self)->isSigned())
@@ -451,18 +515,22 @@ namespace triton {
 
       //! AstNode methods.
       PyMethodDef AstNode_callbacks[] = {
-        {"evaluate",          AstNode_evaluate,          METH_NOARGS,     ""},
-        {"getBitvectorMask",  AstNode_getBitvectorMask,  METH_NOARGS,     ""},
-        {"getBitvectorSize",  AstNode_getBitvectorSize,  METH_NOARGS,     ""},
-        {"getChilds",         AstNode_getChilds,         METH_NOARGS,     ""},
-        {"getHash",           AstNode_getHash,           METH_NOARGS,     ""},
-        {"getKind",           AstNode_getKind,           METH_NOARGS,     ""},
-        {"getParents",        AstNode_getParents,        METH_NOARGS,     ""},
-        {"getValue",          AstNode_getValue,          METH_NOARGS,     ""},
-        {"isSigned",          AstNode_isSigned,          METH_NOARGS,     ""},
-        {"isSymbolized",      AstNode_isSymbolized,      METH_NOARGS,     ""},
-        {"setChild",          AstNode_setChild,          METH_VARARGS,    ""},
-        {nullptr,             nullptr,                   0,               nullptr}
+        {"evaluate",               AstNode_evaluate,               METH_NOARGS,     ""},
+        {"getBitvectorMask",       AstNode_getBitvectorMask,       METH_NOARGS,     ""},
+        {"getBitvectorSize",       AstNode_getBitvectorSize,       METH_NOARGS,     ""},
+        {"getChilds",              AstNode_getChilds,              METH_NOARGS,     ""},
+        {"getDepth",               AstNode_getDepth,               METH_NOARGS,     ""},
+        {"getHash",                AstNode_getHash,                METH_NOARGS,     ""},
+        {"getKind",                AstNode_getKind,                METH_NOARGS,     ""},
+        {"getNumberOfNodes",       AstNode_getNumberOfNodes,       METH_NOARGS,     ""},
+        {"getParents",             AstNode_getParents,             METH_NOARGS,     ""},
+        {"getSymbolicVariableIds", AstNode_getSymbolicVariableIds, METH_NOARGS,     ""},
+        {"getValue",               AstNode_getValue,               METH_NOARGS,     ""},
+        {"isDependentOn",          AstNode_isDependentOn,          METH_O,          ""},
+        {"isSigned",               AstNode_isSigned,               METH_NOARGS,     ""},
+        {"isSymbolized",           AstNode_isSymbolized,           METH_NOARGS,     ""},
+        {"setChild",               AstNode_setChild,               METH_VARARGS,    ""},
+        {nullptr,                  nullptr,                        0,               nullptr}
       };
 
 
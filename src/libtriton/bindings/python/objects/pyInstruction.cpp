@@ -93,6 +93,18 @@ True
 40000: mov rax, 1
 ~~~~~~~~~~~~~
 
+In a tight processing loop, the same instruction may be reset and reused. Its internal storage is kept from
+one instruction to the next.
+
+~~~~~~~~~~~~~{.py}
+>>> inst = Instruction()
+>>> for (addr, opcodes) in trace:
+...     inst.reset()
+...     inst.setOpcodes(opcodes)
+...     inst.setAddress(addr)
+...     processing(inst)
+~~~~~~~~~~~~~
+
 \section Instruction_py_api Python API - Methods of the Instruction class
 <hr>
 
@@ -174,6 +186,10 @@ Returns true if at least one of its \ref py_SymbolicExpression_page contains a s
 - <b>bool isTainted(void)</b><br>
 Returns true if at least one of its \ref py_SymbolicExpression_page is tainted.
 
+- <b>void reset(void)</b><br>
+Resets all information of the instruction (opcodes, address, operands, semantics and context) so that it may be reused
+for another processing. The internal storage is kept.
+
 - <b>void setAddress(integer addr)</b><br>
 Sets the address of the instruction.
 
@@ -665,6 +681,18 @@ namespace triton {
       }
 
 
+      static PyObject* Instruction_reset(PyObject* self, PyObject* noarg) {
+        try {
+          PyInstruction_AsInstruction(self)->reset();
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* Instruction_setAddress(PyObject* self, PyObject* addr) {
         try {
           if (!PyLong_Check(addr) && !PyInt_Check(addr))
@@ -788,6 +816,7 @@ namespace triton {
         {"isPrefixed",                Instruction_isPrefixed,               METH_NOARGS,     ""},
         {"isSymbolized",              Instruction_isSymbolized,             METH_NOARGS,     ""},
         {"isTainted",                 Instruction_isTainted,                METH_NOARGS,     ""},
+        {"reset",                     Instruction_reset,                    METH_NOARGS,     ""},
         {"setAddress",                Instruction_setAddress,               METH_O,          ""},
         {"setOpcodes",                Instruction_setOpcodes,               METH_O,          ""},
         {"setThreadId",               Instruction_setThreadId,              METH_O,          ""},
@@ -107,7 +107,8 @@ Returns the displacement (if exists) of the memory access.
 Returns the index register (if exists) of the memory access.<br>
 
 - <b>\ref py_AstNode_page getLeaAst(void)</b><br>
-Returns the AST of the memory access (LEA).
+Returns the AST of the memory access (LEA). If the base and the index are not symbolized, the address is computed
+concretely and the AST is built on the first call.
 
 - <b>\ref py_Immediate_page getScale(void)</b><br>
 Returns the scale (if exists) of the  memory access.
@@ -88,6 +88,10 @@ Returns the AST root node of the symbolic expression.
 - <b>string getComment(void)</b><br>
 Returns the comment (if exists) of the symbolic expression.
 
+- <b>[integer, ...] getDependencies(void)</b><br>
+Returns the sorted list of symbolic expression ids directly referenced by this expression.<br>
+e.g: `[12, 15]`
+
 - <b>integer getId(void)</b><br>
 Returns the if of the symbolic expression. This id is always unique.<br>
 e.g: `2387`
@@ -105,6 +109,10 @@ Returns the origin memory access if `isMemory()` is equal to `True`, invalid mem
 - <b>\ref py_Register_page getOriginRegister(void)</b><br>
 Returns the origin register if `isRegister()` is equal `True`, `REG.INVALID` otherwise. This register represents the target assignment.
 
+- <b>[integer, ...] getSymbolicVariableIds(void)</b><br>
+Returns the sorted list of symbolic variable ids this expression depends on.<br>
+e.g: `[0, 3]`
+
 - <b>bool isMemory(void)</b><br>
 Returns true if the expression is assigned to a memory.
 
@@ -155,6 +163,22 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getDependencies(PyObject* self, PyObject* noarg) {
+        try {
+          const std::vector<triton::usize>& deps = PySymbolicExpression_AsSymbolicExpression(self)->getDependencies();
+          PyObject* ret = xPyList_New(deps.size());
+
+          for (triton::usize index = 0; index < deps.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(deps[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_getId(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUsize(PySymbolicExpression_AsSymbolicExpression(self)->getId());
@@ -205,6 +229,22 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getSymbolicVariableIds(PyObject* self, PyObject* noarg) {
+        try {
+          const std::vector<triton::usize>& ids = PySymbolicExpression_AsSymbolicExpression(self)->getSymbolicVariableIds();
+          PyObject* ret = xPyList_New(ids.size());
+
+          for (triton::usize index = 0; index < ids.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(ids[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_isMemory(PyObject* self, PyObject* noarg) {
         try {
           if (PySymbolicExpression_AsSymbolicExpression(self)->isMemory() == true)
@@ -287,19 +327,21 @@ namespace triton {
 
       //! SymbolicExpression methods.
       PyMethodDef SymbolicExpression_callbacks[] = {
-        {"getAst",            SymbolicExpression_getAst,            METH_NOARGS,    ""},
-        {"getComment",        SymbolicExpression_getComment,        METH_NOARGS,    ""},
-        {"getId",             SymbolicExpression_getId,             METH_NOARGS,    ""},
-        {"getKind",           SymbolicExpression_getKind,           METH_NOARGS,    ""},
-        {"getNewAst",         SymbolicExpression_getNewAst,         METH_NOARGS,    ""},
-        {"getOriginMemory",   SymbolicExpression_getOriginMemory,   METH_NOARGS,    ""},
-        {"getOriginRegister", SymbolicExpression_getOriginRegister, METH_NOARGS,    ""},
-        {"isMemory",          SymbolicExpression_isMemory,          METH_NOARGS,    ""},
-        {"isRegister",        SymbolicExpression_isRegister,        METH_NOARGS,    ""},
-        {"isSymbolized",      SymbolicExpression_isSymbolized,      METH_NOARGS,    ""},
-        {"isTainted",         SymbolicExpression_isTainted,         METH_NOARGS,    ""},
-        {"setAst",            SymbolicExpression_setAst,            METH_O,         ""},
-        {nullptr,             nullptr,                              0,              nullptr}
+        {"getAst",                 SymbolicExpression_getAst,                 METH_NOARGS,    ""},
+        {"getComment",             SymbolicExpression_getComment,             METH_NOARGS,    ""},
+        {"getDependencies",        SymbolicExpression_getDependencies,        METH_NOARGS,    ""},
+        {"getId",                  SymbolicExpression_getId,                  METH_NOARGS,    ""},
+        {"getKind",                SymbolicExpression_getKind,                METH_NOARGS,    ""},
+        {"getNewAst",              SymbolicExpression_getNewAst,              METH_NOARGS,    ""},
+        {"getOriginMemory",        SymbolicExpression_getOriginMemory,        METH_NOARGS,    ""},
+        {"getOriginRegister",      SymbolicExpression_getOriginRegister,      METH_NOARGS,    ""},
+        {"getSymbolicVariableIds", SymbolicExpression_getSymbolicVariableIds, METH_NOARGS,    ""},
+        {"isMemory",               SymbolicExpression_isMemory,               METH_NOARGS,    ""},
+        {"isRegister",             SymbolicExpression_isRegister,             METH_NOARGS,    ""},
+        {"isSymbolized",           SymbolicExpression_isSymbolized,           METH_NOARGS,    ""},
+        {"isTainted",              SymbolicExpression_isTainted,              METH_NOARGS,    ""},
+        {"setAst",                 SymbolicExpression_setAst,                 METH_O,         ""},
+        {nullptr,                  nullptr,                                   0,              nullptr}
       };
 
 
@@ -26,14 +26,18 @@ namespace triton {
 
     Callbacks::Callbacks(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
-      this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
-      this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
-      this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pyGetConcreteMemoryValueCallbacks     = copy.pyGetConcreteMemoryValueCallbacks;
+      this->pyGetConcreteMemoryAreaValueCallbacks = copy.pyGetConcreteMemoryAreaValueCallbacks;
+      this->pyGetConcreteMemoryPageCallbacks      = copy.pyGetConcreteMemoryPageCallbacks;
+      this->pyGetConcreteRegisterValueCallbacks   = copy.pyGetConcreteRegisterValueCallbacks;
+      this->pySymbolicSimplificationCallbacks     = copy.pySymbolicSimplificationCallbacks;
       #endif
-      this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
-      this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
-      this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
-      this->isDefined                           = copy.isDefined;
+      this->getConcreteMemoryValueCallbacks       = copy.getConcreteMemoryValueCallbacks;
+      this->getConcreteMemoryAreaValueCallbacks   = copy.getConcreteMemoryAreaValueCallbacks;
+      this->getConcreteMemoryPageCallbacks        = copy.getConcreteMemoryPageCallbacks;
+      this->getConcreteRegisterValueCallbacks     = copy.getConcreteRegisterValueCallbacks;
+      this->symbolicSimplificationCallbacks       = copy.symbolicSimplificationCallbacks;
+      this->isDefined                             = copy.isDefined;
     }
 
 
@@ -43,14 +47,18 @@ namespace triton {
 
     void Callbacks::operator=(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
-      this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
-      this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
-      this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pyGetConcreteMemoryValueCallbacks     = copy.pyGetConcreteMemoryValueCallbacks;
+      this->pyGetConcreteMemoryAreaValueCallbacks = copy.pyGetConcreteMemoryAreaValueCallbacks;
+      this->pyGetConcreteMemoryPageCallbacks      = copy.pyGetConcreteMemoryPageCallbacks;
+      this->pyGetConcreteRegisterValueCallbacks   = copy.pyGetConcreteRegisterValueCallbacks;
+      this->pySymbolicSimplificationCallbacks     = copy.pySymbolicSimplificationCallbacks;
       #endif
-      this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
-      this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
-      this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
-      this->isDefined                           = copy.isDefined;
+      this->getConcreteMemoryValueCallbacks       = copy.getConcreteMemoryValueCallbacks;
+      this->getConcreteMemoryAreaValueCallbacks   = copy.getConcreteMemoryAreaValueCallbacks;
+      this->getConcreteMemoryPageCallbacks        = copy.getConcreteMemoryPageCallbacks;
+      this->getConcreteRegisterValueCallbacks     = copy.getConcreteRegisterValueCallbacks;
+      this->symbolicSimplificationCallbacks       = copy.symbolicSimplificationCallbacks;
+      this->isDefined                             = copy.isDefined;
     }
 
 
@@ -60,6 +68,18 @@ namespace triton {
     }
 
 
+    void Callbacks::addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+      this->getConcreteMemoryAreaValueCallbacks.push_back(cb);
+      this->isDefined = true;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+      this->getConcreteMemoryPageCallbacks.push_back(cb);
+      this->isDefined = true;
+    }
+
+
     void Callbacks::addCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
       this->getConcreteRegisterValueCallbacks.push_back(cb);
       this->isDefined = true;
@@ -78,6 +98,12 @@ namespace triton {
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.push_back(function);
           break;
+        case GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->pyGetConcreteMemoryAreaValueCallbacks.push_back(function);
+          break;
+        case GET_CONCRETE_MEMORY_PAGE:
+          this->pyGetConcreteMemoryPageCallbacks.push_back(function);
+          break;
         case GET_CONCRETE_REGISTER_VALUE:
           this->pyGetConcreteRegisterValueCallbacks.push_back(function);
           break;
@@ -94,10 +120,14 @@ namespace triton {
 
     void Callbacks::removeAllCallbacks(void) {
       this->getConcreteMemoryValueCallbacks.clear();
+      this->getConcreteMemoryAreaValueCallbacks.clear();
+      this->getConcreteMemoryPageCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
       #ifdef TRITON_PYTHON_BINDINGS
       this->pyGetConcreteMemoryValueCallbacks.clear();
+      this->pyGetConcreteMemoryAreaValueCallbacks.clear();
+      this->pyGetConcreteMemoryPageCallbacks.clear();
       this->pyGetConcreteRegisterValueCallbacks.clear();
       this->pySymbolicSimplificationCallbacks.clear();
       #endif
@@ -111,6 +141,20 @@ namespace triton {
     }
 
 
+    void Callbacks::removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+      this->getConcreteMemoryAreaValueCallbacks.remove(cb);
+      if (this->countCallbacks() == 0)
+        this->isDefined = false;
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+      this->getConcreteMemoryPageCallbacks.remove(cb);
+      if (this->countCallbacks() == 0)
+        this->isDefined = false;
+    }
+
+
     void Callbacks::removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
       this->getConcreteRegisterValueCallbacks.remove(cb);
       if (this->countCallbacks() == 0)
@@ -131,6 +175,12 @@ namespace triton {
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.remove(function);
           break;
+        case GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->pyGetConcreteMemoryAreaValueCallbacks.remove(function);
+          break;
+        case GET_CONCRETE_MEMORY_PAGE:
+          this->pyGetConcreteMemoryPageCallbacks.remove(function);
+          break;
         case GET_CONCRETE_REGISTER_VALUE:
           this->pyGetConcreteRegisterValueCallbacks.remove(function);
           break;
@@ -271,14 +321,118 @@ namespace triton {
     }
 
 
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE: {
+          // C++ callbacks
+          std::list<triton::callbacks::getConcreteMemoryAreaValueCallback>::const_iterator it1;
+          for (it1 = this->getConcreteMemoryAreaValueCallbacks.begin(); it1 != this->getConcreteMemoryAreaValueCallbacks.end(); it1++)
+            (*it1)(baseAddr, size);
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyGetConcreteMemoryAreaValueCallbacks.begin(); it2 != this->pyGetConcreteMemoryAreaValueCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUint64(baseAddr));
+            PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUsize(size));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_AREA_VALUE): Fail to call the python callback.");
+            }
+
+            Py_DECREF(ret);
+            Py_DECREF(args);
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 pageAddr) const {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_PAGE: {
+          // C++ callbacks
+          std::list<triton::callbacks::getConcreteMemoryPageCallback>::const_iterator it1;
+          for (it1 = this->getConcreteMemoryPageCallbacks.begin(); it1 != this->getConcreteMemoryPageCallbacks.end(); it1++)
+            (*it1)(pageAddr);
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyGetConcreteMemoryPageCallbacks.begin(); it2 != this->pyGetConcreteMemoryPageCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(1);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUint64(pageAddr));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_PAGE): Fail to call the python callback.");
+            }
+
+            Py_DECREF(ret);
+            Py_DECREF(args);
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+    bool Callbacks::hasCallbacks(triton::callbacks::callback_e kind) const {
+      switch (kind) {
+        #ifdef TRITON_PYTHON_BINDINGS
+        case GET_CONCRETE_MEMORY_VALUE:       return (!this->getConcreteMemoryValueCallbacks.empty() || !this->pyGetConcreteMemoryValueCallbacks.empty());
+        case GET_CONCRETE_MEMORY_AREA_VALUE:  return (!this->getConcreteMemoryAreaValueCallbacks.empty() || !this->pyGetConcreteMemoryAreaValueCallbacks.empty());
+        case GET_CONCRETE_MEMORY_PAGE:        return (!this->getConcreteMemoryPageCallbacks.empty() || !this->pyGetConcreteMemoryPageCallbacks.empty());
+        case GET_CONCRETE_REGISTER_VALUE:     return (!this->getConcreteRegisterValueCallbacks.empty() || !this->pyGetConcreteRegisterValueCallbacks.empty());
+        case SYMBOLIC_SIMPLIFICATION:         return (!this->symbolicSimplificationCallbacks.empty() || !this->pySymbolicSimplificationCallbacks.empty());
+        #else
+        case GET_CONCRETE_MEMORY_VALUE:       return !this->getConcreteMemoryValueCallbacks.empty();
+        case GET_CONCRETE_MEMORY_AREA_VALUE:  return !this->getConcreteMemoryAreaValueCallbacks.empty();
+        case GET_CONCRETE_MEMORY_PAGE:        return !this->getConcreteMemoryPageCallbacks.empty();
+        case GET_CONCRETE_REGISTER_VALUE:     return !this->getConcreteRegisterValueCallbacks.empty();
+        case SYMBOLIC_SIMPLIFICATION:         return !this->symbolicSimplificationCallbacks.empty();
+        #endif
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::hasCallbacks(): Invalid kind of callback.");
+      };
+    }
+
+
     triton::usize Callbacks::countCallbacks(void) const {
       triton::usize count = 0;
 
       count += this->getConcreteMemoryValueCallbacks.size();
+      count += this->getConcreteMemoryAreaValueCallbacks.size();
+      count += this->getConcreteMemoryPageCallbacks.size();
       count += this->getConcreteRegisterValueCallbacks.size();
       count += this->symbolicSimplificationCallbacks.size();
       #ifdef TRITON_PYTHON_BINDINGS
       count += this->pyGetConcreteMemoryValueCallbacks.size();
+      count += this->pyGetConcreteMemoryAreaValueCallbacks.size();
+      count += this->pyGetConcreteMemoryPageCallbacks.size();
       count += this->pyGetConcreteRegisterValueCallbacks.size();
       count += this->pySymbolicSimplificationCallbacks.size();
       #endif
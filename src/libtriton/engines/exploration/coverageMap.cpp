@@ -0,0 +1,93 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <coverageMap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      std::size_t CoverageMap::BranchHash::operator()(const Branch& branch) const {
+        triton::uint64 hash = (branch.first * 0x9e3779b97f4a7c15ULL) ^ branch.second;
+        return static_cast<std::size_t>(hash ^ (hash >> 29));
+      }
+
+
+      CoverageMap::CoverageMap() {
+        this->count = 0;
+      }
+
+
+      CoverageMap::Shard& CoverageMap::getShard(const Branch& branch) const {
+        return this->shards[BranchHash()(branch) % SHARDS];
+      }
+
+
+      bool CoverageMap::cover(triton::uint64 srcAddr, triton::uint64 dstAddr) {
+        Branch branch(srcAddr, dstAddr);
+        Shard& shard = this->getShard(branch);
+        std::lock_guard<std::mutex> guard(shard.lock);
+
+        if (!shard.covered.insert(branch).second)
+          return false;
+
+        this->count++;
+        return true;
+      }
+
+
+      bool CoverageMap::isCovered(triton::uint64 srcAddr, triton::uint64 dstAddr) const {
+        Branch branch(srcAddr, dstAddr);
+        Shard& shard = this->getShard(branch);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        return (shard.covered.find(branch) != shard.covered.end());
+      }
+
+
+      bool CoverageMap::target(triton::uint64 srcAddr, triton::uint64 dstAddr) {
+        Branch branch(srcAddr, dstAddr);
+        Shard& shard = this->getShard(branch);
+        std::lock_guard<std::mutex> guard(shard.lock);
+
+        if (shard.covered.find(branch) != shard.covered.end())
+          return false;
+
+        return shard.targeted.insert(branch).second;
+      }
+
+
+      triton::usize CoverageMap::size(void) const {
+        return this->count;
+      }
+
+
+      std::vector<Branch> CoverageMap::getBranches(void) const {
+        std::vector<Branch> branches;
+
+        for (triton::usize index = 0; index < SHARDS; index++) {
+          std::lock_guard<std::mutex> guard(this->shards[index].lock);
+          branches.insert(branches.end(), this->shards[index].covered.begin(), this->shards[index].covered.end());
+        }
+
+        return branches;
+      }
+
+
+      void CoverageMap::clear(void) {
+        for (triton::usize index = 0; index < SHARDS; index++) {
+          std::lock_guard<std::mutex> guard(this->shards[index].lock);
+          this->shards[index].covered.clear();
+          this->shards[index].targeted.clear();
+        }
+        this->count = 0;
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
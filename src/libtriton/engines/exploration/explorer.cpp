@@ -0,0 +1,280 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <z3++.h>
+
+#include <exceptions.hpp>
+#include <explorer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      Explorer::Explorer(const SetupCallback& setup, const std::vector<triton::uint64>& inputs, triton::uint64 entry) {
+        if (!setup)
+          throw triton::exceptions::Exploration("Explorer::Explorer(): The setup callback cannot be null.");
+
+        this->setup           = setup;
+        this->reportInterval  = std::chrono::milliseconds(1000);
+        this->inputs          = inputs;
+        this->entry           = entry;
+        this->maxInstructions = 0;
+        this->maxRuns         = 0;
+        this->workers         = 0;
+        this->runs            = 0;
+        this->errors          = 0;
+        this->queries         = 0;
+        this->cacheHits       = 0;
+      }
+
+
+      void Explorer::addSeed(const Seed& seed) {
+        if (seed.size() != this->inputs.size())
+          throw triton::exceptions::Exploration("Explorer::addSeed(): The seed size must match the number of inputs.");
+        this->initialSeeds.push_back(seed);
+      }
+
+
+      void Explorer::addStopAddress(triton::uint64 addr) {
+        this->stopAddresses.insert(addr);
+      }
+
+
+      void Explorer::setMaxInstructions(triton::usize limit) {
+        this->maxInstructions = limit;
+      }
+
+
+      void Explorer::setMaxRuns(triton::usize limit) {
+        this->maxRuns = limit;
+      }
+
+
+      void Explorer::setWorkers(triton::usize workers) {
+        this->workers = workers;
+      }
+
+
+      void Explorer::setReportCallback(const ReportCallback& report, std::chrono::milliseconds interval) {
+        this->report         = report;
+        this->reportInterval = interval;
+      }
+
+
+      ExplorerStats Explorer::explore(void) {
+        auto start          = std::chrono::steady_clock::now();
+        triton::usize count = this->workers;
+        std::vector<std::thread> threads;
+        std::atomic<triton::usize> active;
+
+        if (count == 0)
+          count = std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+
+        SeedQueue queue(count);
+
+        /* Spreads the initial seeds over the workers */
+        if (this->initialSeeds.empty())
+          this->initialSeeds.push_back(Seed(this->inputs.size(), 0));
+
+        for (triton::usize index = 0; index < this->initialSeeds.size(); index++)
+          queue.push(index % count, this->initialSeeds[index]);
+
+        {
+          std::lock_guard<std::mutex> guard(this->seedsLock);
+          this->seeds = this->initialSeeds;
+        }
+
+        active = count;
+        for (triton::usize worker = 0; worker < count; worker++) {
+          threads.push_back(std::thread([this, &queue, &active, worker]() {
+            this->work(queue, worker);
+            active--;
+          }));
+        }
+
+        /* Reports the statistics until all workers are over */
+        ExplorerStats previous = this->getStats(queue, start);
+        while (active) {
+          auto deadline = std::chrono::steady_clock::now() + this->reportInterval;
+          while (active && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+          if (!active || !this->report)
+            continue;
+
+          ExplorerStats stats = this->getStats(queue, start);
+          if (stats.elapsed > previous.elapsed)
+            stats.coveragePerSecond = (stats.branches - previous.branches) / (stats.elapsed - previous.elapsed);
+          this->report(stats);
+          previous = stats;
+        }
+
+        for (auto& thread : threads)
+          thread.join();
+
+        ExplorerStats stats = this->getStats(queue, start);
+        if (stats.elapsed > 0)
+          stats.coveragePerSecond = stats.branches / stats.elapsed;
+        if (this->report)
+          this->report(stats);
+
+        return stats;
+      }
+
+
+      void Explorer::work(SeedQueue& queue, triton::usize worker) {
+        triton::API ctx;
+        triton::API::Scope scope(ctx);
+        Seed seed;
+
+        while (queue.pop(worker, seed)) {
+          /* Claims a run, closes the queue once the limit is reached */
+          if (this->maxRuns && this->runs++ >= this->maxRuns) {
+            this->runs--;
+            queue.close();
+            queue.done();
+            break;
+          }
+          if (!this->maxRuns)
+            this->runs++;
+
+          try {
+            this->run(ctx, queue, worker, seed);
+          }
+          catch (const triton::exceptions::Exception&) {
+            this->errors++;
+          }
+          catch (const z3::exception&) {
+            this->errors++;
+          }
+          /* Any other failure is counted too, the other workers keep running */
+          catch (const std::exception&) {
+            this->errors++;
+          }
+          catch (...) {
+            this->errors++;
+          }
+
+          queue.done();
+        }
+      }
+
+
+      void Explorer::run(triton::API& ctx, SeedQueue& queue, triton::usize worker, const Seed& seed) {
+        std::map<triton::usize, triton::usize> indexes;
+        triton::ast::AbstractNode* prefix = nullptr;
+        bool discovered = false;
+
+        ctx.resetEngines();
+        this->setup(ctx);
+
+        /* Writes and symbolizes the input bytes */
+        for (triton::usize index = 0; index < this->inputs.size(); index++) {
+          triton::arch::MemoryAccess mem(this->inputs[index], BYTE_SIZE, seed[index]);
+          ctx.setConcreteMemoryValue(mem);
+          indexes[ctx.convertMemoryToSymbolicVariable(mem)->getId()] = index;
+        }
+
+        ctx.run(this->entry, this->maxInstructions, this->stopAddresses);
+
+        for (const auto& pc : ctx.getPathConstraints()) {
+          if (!pc.isMultipleBranches())
+            continue;
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            triton::uint64 srcAddr = std::get<1>(branch);
+            triton::uint64 dstAddr = std::get<2>(branch);
+
+            if (std::get<0>(branch)) {
+              discovered |= this->coverage.cover(srcAddr, dstAddr);
+              continue;
+            }
+
+            if (!this->coverage.target(srcAddr, dstAddr))
+              continue;
+
+            /* Solves the branch not taken under the path prefix */
+            triton::ast::AbstractNode* query = std::get<3>(branch);
+            if (prefix != nullptr)
+              query = triton::ast::land(prefix, query);
+
+            auto model = this->solve(ctx, triton::ast::assert_(query));
+            if (model.empty())
+              continue;
+
+            Seed child = seed;
+            for (const auto& value : model) {
+              auto it = indexes.find(value.first);
+              if (it != indexes.end())
+                child[it->second] = static_cast<triton::uint8>(value.second.getValue().convert_to<triton::uint64>() & 0xff);
+            }
+            queue.push(worker, child);
+          }
+
+          triton::ast::AbstractNode* taken = pc.getTakenPathConstraintAst();
+          prefix = (prefix == nullptr) ? taken : triton::ast::land(prefix, taken);
+        }
+
+        if (discovered) {
+          std::lock_guard<std::mutex> guard(this->seedsLock);
+          this->seeds.push_back(seed);
+        }
+      }
+
+
+      std::map<triton::uint32, triton::engines::solver::SolverModel> Explorer::solve(triton::API& ctx, triton::ast::AbstractNode* query) {
+        std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+        /* The references are unrolled, their ids are local to a context */
+        triton::uint512 key = ctx.getFullAst(query)->hash(1);
+
+        this->queries++;
+        if (this->solverCache.find(key, model)) {
+          this->cacheHits++;
+          return model;
+        }
+
+        model = ctx.getModel(query);
+        this->solverCache.insert(key, model);
+
+        return model;
+      }
+
+
+      ExplorerStats Explorer::getStats(const SeedQueue& queue, std::chrono::steady_clock::time_point start) const {
+        ExplorerStats stats;
+
+        stats.runs              = this->runs;
+        stats.errors            = this->errors;
+        stats.branches          = this->coverage.size();
+        stats.queries           = this->queries;
+        stats.cacheHits         = this->cacheHits;
+        stats.pendingSeeds      = queue.size();
+        stats.elapsed           = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        stats.coveragePerSecond = 0;
+
+        return stats;
+      }
+
+
+      std::vector<Branch> Explorer::getCoverage(void) const {
+        return this->coverage.getBranches();
+      }
+
+
+      std::vector<Seed> Explorer::getSeeds(void) const {
+        std::lock_guard<std::mutex> guard(this->seedsLock);
+        return this->seeds;
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
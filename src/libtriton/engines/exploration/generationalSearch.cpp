@@ -0,0 +1,358 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <exceptions.hpp>
+#include <generationalSearch.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      /* Orders the heap of the nodes, the best score first and the oldest node on a tie */
+      static inline bool isWorse(const SearchNode& node1, const SearchNode& node2) {
+        if (node1.score != node2.score)
+          return node1.score < node2.score;
+        return node1.id > node2.id;
+      }
+
+
+      /* Extends the hash of a path prefix with a branch */
+      static inline triton::uint64 hashBranch(triton::uint64 hash, triton::uint64 srcAddr, triton::uint64 dstAddr) {
+        hash = (hash ^ srcAddr) * 0x100000001b3ULL;
+        hash = (hash ^ dstAddr) * 0x100000001b3ULL;
+        return hash;
+      }
+
+
+      GenerationalSearch::GenerationalSearch(triton::API& ctx, const SetupCallback& setup, const std::vector<triton::uint64>& inputs, triton::uint64 entry)
+        : ctx(ctx) {
+        if (!setup)
+          throw triton::exceptions::Exploration("GenerationalSearch::GenerationalSearch(): The setup callback cannot be null.");
+
+        this->setup           = setup;
+        this->inputs          = inputs;
+        this->entry           = entry;
+        this->maxInstructions = 0;
+        this->runs            = 0;
+        this->queries         = 0;
+        this->nextId          = 0;
+        this->scoring         = [](const SearchNode& node) { return static_cast<double>(node.newBranches); };
+      }
+
+
+      void GenerationalSearch::addSeed(const Seed& seed) {
+        SearchNode node;
+
+        if (seed.size() != this->inputs.size())
+          throw triton::exceptions::Exploration("GenerationalSearch::addSeed(): The seed size must match the number of inputs.");
+
+        node.seed        = seed;
+        node.bound       = 0;
+        node.generation  = 0;
+        node.newBranches = 0;
+        node.executed    = false;
+        this->push(node);
+      }
+
+
+      void GenerationalSearch::addStopAddress(triton::uint64 addr) {
+        this->stopAddresses.insert(addr);
+      }
+
+
+      void GenerationalSearch::setMaxInstructions(triton::usize limit) {
+        this->maxInstructions = limit;
+      }
+
+
+      void GenerationalSearch::setScoringCallback(const ScoringCallback& scoring) {
+        if (!scoring)
+          throw triton::exceptions::Exploration("GenerationalSearch::setScoringCallback(): The scoring callback cannot be null.");
+        this->scoring = scoring;
+      }
+
+
+      void GenerationalSearch::push(SearchNode& node) {
+        node.id    = this->nextId++;
+        node.score = (node.generation == 0) ? std::numeric_limits<double>::infinity() : this->scoring(node);
+        this->nodes.push_back(std::move(node));
+        std::push_heap(this->nodes.begin(), this->nodes.end(), isWorse);
+      }
+
+
+      void GenerationalSearch::execute(SearchNode& node) {
+        triton::API::Scope scope(this->ctx);
+        std::map<triton::usize, triton::usize> indexes;
+        triton::ast::AbstractNode* prefix = nullptr;
+        triton::uint64 hash = 0xcbf29ce484222325ULL;
+        triton::usize index = 0;
+
+        this->ctx.resetEngines();
+        this->setup(this->ctx);
+        this->runs++;
+
+        node.executed    = true;
+        node.newBranches = 0;
+        node.children.clear();
+
+        /* Writes and symbolizes the input bytes */
+        for (triton::usize index = 0; index < this->inputs.size(); index++) {
+          triton::arch::MemoryAccess mem(this->inputs[index], BYTE_SIZE, node.seed[index]);
+          this->ctx.setConcreteMemoryValue(mem);
+          indexes[this->ctx.convertMemoryToSymbolicVariable(mem)->getId()] = index;
+        }
+
+        this->ctx.run(this->entry, this->maxInstructions, this->stopAddresses);
+
+        for (const auto& pc : this->ctx.getPathConstraints()) {
+          if (!pc.isMultipleBranches())
+            continue;
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            if (std::get<0>(branch) && this->coverage.cover(std::get<1>(branch), std::get<2>(branch)))
+              node.newBranches++;
+          }
+
+          /* Negates each branch from the bound on, under the branches taken before it */
+          for (const auto& branch : pc.getBranchConstraints()) {
+            if (std::get<0>(branch) || index < node.bound)
+              continue;
+
+            if (!this->prefixes.insert(hashBranch(hash, std::get<1>(branch), std::get<2>(branch))).second)
+              continue;
+
+            triton::ast::AbstractNode* query = std::get<3>(branch);
+            if (prefix != nullptr)
+              query = triton::ast::land(prefix, query);
+
+            auto model = this->ctx.getModel(triton::ast::assert_(query));
+            this->queries++;
+            if (model.empty())
+              continue;
+
+            Seed child = node.seed;
+            for (const auto& value : model) {
+              auto it = indexes.find(value.first);
+              if (it != indexes.end())
+                child[it->second] = static_cast<triton::uint8>(value.second.getValue().convert_to<triton::uint64>() & 0xff);
+            }
+            node.children.push_back(std::make_pair(child, index + 1));
+          }
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            if (std::get<0>(branch))
+              hash = hashBranch(hash, std::get<1>(branch), std::get<2>(branch));
+          }
+
+          triton::ast::AbstractNode* taken = pc.getTakenPathConstraintAst();
+          prefix = (prefix == nullptr) ? taken : triton::ast::land(prefix, taken);
+          index++;
+        }
+
+        if (node.newBranches)
+          this->seeds.push_back(node.seed);
+      }
+
+
+      bool GenerationalSearch::step(void) {
+        if (this->nodes.empty() && this->runs == 0)
+          this->addSeed(Seed(this->inputs.size(), 0));
+
+        if (this->nodes.empty())
+          return false;
+
+        std::pop_heap(this->nodes.begin(), this->nodes.end(), isWorse);
+        SearchNode parent = std::move(this->nodes.back());
+        this->nodes.pop_back();
+
+        /* Only the initial seeds are pushed before their run */
+        if (!parent.executed)
+          this->execute(parent);
+
+        /* Runs each child once, which scores it and keeps the models of its own children */
+        for (const auto& generated : parent.children) {
+          SearchNode child;
+          child.seed       = generated.first;
+          child.bound      = generated.second;
+          child.generation = parent.generation + 1;
+          this->execute(child);
+          this->push(child);
+        }
+
+        return true;
+      }
+
+
+      triton::usize GenerationalSearch::explore(triton::usize maxRuns) {
+        triton::usize start = this->runs;
+
+        while (maxRuns == 0 || this->runs - start < maxRuns) {
+          if (!this->step())
+            break;
+        }
+
+        return this->runs - start;
+      }
+
+
+      triton::usize GenerationalSearch::getPendingSeeds(void) const {
+        return this->nodes.size();
+      }
+
+
+      triton::usize GenerationalSearch::getRuns(void) const {
+        return this->runs;
+      }
+
+
+      triton::usize GenerationalSearch::getQueries(void) const {
+        return this->queries;
+      }
+
+
+      std::vector<Branch> GenerationalSearch::getCoverage(void) const {
+        return this->coverage.getBranches();
+      }
+
+
+      std::vector<Seed> GenerationalSearch::getSeeds(void) const {
+        return this->seeds;
+      }
+
+
+      /* Writes a seed as hexadecimal bytes, '-' if empty */
+      static inline void saveSeed(std::ostream& stream, const Seed& seed) {
+        static const char digits[] = "0123456789abcdef";
+
+        if (seed.empty())
+          stream << "-";
+        for (auto byte : seed)
+          stream << digits[byte >> 4] << digits[byte & 0xf];
+      }
+
+
+      /* Reads a seed written by saveSeed() */
+      static inline bool loadSeed(std::istream& stream, Seed& seed) {
+        std::string text;
+
+        seed.clear();
+        if (!(stream >> text) || (text != "-" && text.size() % 2))
+          return false;
+        if (text == "-")
+          return true;
+
+        for (triton::usize index = 0; index < text.size(); index += 2) {
+          std::istringstream byte(text.substr(index, 2));
+          triton::uint32 value = 0;
+          if (!(byte >> std::hex >> value))
+            return false;
+          seed.push_back(static_cast<triton::uint8>(value));
+        }
+
+        return true;
+      }
+
+
+      void GenerationalSearch::saveState(std::ostream& stream) const {
+        stream << "runs " << this->runs << " " << this->queries << std::endl;
+
+        for (const auto& branch : this->coverage.getBranches())
+          stream << "branch " << branch.first << " " << branch.second << std::endl;
+
+        for (auto prefix : this->prefixes)
+          stream << "prefix " << prefix << std::endl;
+
+        for (const auto& seed : this->seeds) {
+          stream << "seed ";
+          saveSeed(stream, seed);
+          stream << std::endl;
+        }
+
+        for (const auto& node : this->nodes) {
+          stream << "node " << node.bound << " " << node.generation << " " << node.newBranches << " " << node.executed << " ";
+          saveSeed(stream, node.seed);
+          stream << std::endl;
+
+          for (const auto& child : node.children) {
+            stream << "child " << child.second << " ";
+            saveSeed(stream, child.first);
+            stream << std::endl;
+          }
+        }
+      }
+
+
+      void GenerationalSearch::loadState(std::istream& stream) {
+        SearchNode node;
+        bool hasNode = false;
+        std::string kind;
+
+        this->nodes.clear();
+        this->prefixes.clear();
+        this->coverage.clear();
+        this->seeds.clear();
+        this->runs    = 0;
+        this->queries = 0;
+        this->nextId  = 0;
+
+        while (stream >> kind) {
+          bool valid = false;
+
+          if (kind == "runs") {
+            valid = static_cast<bool>(stream >> this->runs >> this->queries);
+          }
+          else if (kind == "branch") {
+            triton::uint64 srcAddr = 0, dstAddr = 0;
+            valid = static_cast<bool>(stream >> srcAddr >> dstAddr);
+            this->coverage.cover(srcAddr, dstAddr);
+          }
+          else if (kind == "prefix") {
+            triton::uint64 prefix = 0;
+            valid = static_cast<bool>(stream >> prefix);
+            this->prefixes.insert(prefix);
+          }
+          else if (kind == "seed") {
+            Seed seed;
+            valid = loadSeed(stream, seed);
+            this->seeds.push_back(seed);
+          }
+          else if (kind == "node") {
+            /* A node is pushed once all its children are read */
+            if (hasNode)
+              this->push(node);
+            node    = SearchNode();
+            valid   = (stream >> node.bound >> node.generation >> node.newBranches >> node.executed) && loadSeed(stream, node.seed);
+            valid   = valid && (node.seed.size() == this->inputs.size());
+            hasNode = valid;
+          }
+          else if (kind == "child") {
+            std::pair<Seed, triton::usize> child;
+            valid = hasNode && (stream >> child.second) && loadSeed(stream, child.first);
+            valid = valid && (child.first.size() == this->inputs.size());
+            node.children.push_back(child);
+          }
+
+          if (!valid)
+            throw triton::exceptions::Exploration("GenerationalSearch::loadState(): Invalid state.");
+        }
+
+        if (hasNode)
+          this->push(node);
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
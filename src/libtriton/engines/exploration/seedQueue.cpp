@@ -0,0 +1,117 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <exceptions.hpp>
+#include <seedQueue.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      SeedQueue::SeedQueue(triton::usize workers) {
+        if (workers == 0)
+          throw triton::exceptions::Exploration("SeedQueue::SeedQueue(): The number of workers cannot be null.");
+
+        for (triton::usize index = 0; index < workers; index++)
+          this->deques.push_back(std::unique_ptr<Deque>(new Deque()));
+
+        this->available = 0;
+        this->pending   = 0;
+        this->closed    = false;
+      }
+
+
+      bool SeedQueue::take(triton::usize worker, Seed& seed) {
+        triton::usize size = this->deques.size();
+
+        /* The own deque first, from the back */
+        {
+          Deque& own = *this->deques[worker % size];
+          std::lock_guard<std::mutex> guard(own.lock);
+          if (!own.seeds.empty()) {
+            seed.swap(own.seeds.back());
+            own.seeds.pop_back();
+            this->available--;
+            return true;
+          }
+        }
+
+        /* Then steal the oldest seed of another worker */
+        for (triton::usize index = 1; index < size; index++) {
+          Deque& victim = *this->deques[(worker + index) % size];
+          std::lock_guard<std::mutex> guard(victim.lock);
+          if (!victim.seeds.empty()) {
+            seed.swap(victim.seeds.front());
+            victim.seeds.pop_front();
+            this->available--;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      void SeedQueue::push(triton::usize worker, const Seed& seed) {
+        Deque& own = *this->deques[worker % this->deques.size()];
+
+        this->pending++;
+
+        /*
+         * Counted under the idle lock, so a worker going idle cannot miss it, and before the
+         * seed is visible, so a thief taking it cannot decrement the counter below zero.
+         */
+        {
+          std::lock_guard<std::mutex> guard(this->idleLock);
+          this->available++;
+        }
+
+        {
+          std::lock_guard<std::mutex> guard(own.lock);
+          own.seeds.push_back(seed);
+        }
+        this->idle.notify_one();
+      }
+
+
+      bool SeedQueue::pop(triton::usize worker, Seed& seed) {
+        while (true) {
+          if (this->take(worker, seed))
+            return true;
+
+          std::unique_lock<std::mutex> guard(this->idleLock);
+          if (this->closed || this->pending == 0)
+            return false;
+          if (this->available == 0)
+            this->idle.wait(guard);
+        }
+      }
+
+
+      void SeedQueue::done(void) {
+        std::lock_guard<std::mutex> guard(this->idleLock);
+        if (--this->pending == 0)
+          this->idle.notify_all();
+      }
+
+
+      void SeedQueue::close(void) {
+        std::lock_guard<std::mutex> guard(this->idleLock);
+        this->closed = true;
+        this->idle.notify_all();
+      }
+
+
+      triton::usize SeedQueue::size(void) const {
+        return this->available;
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
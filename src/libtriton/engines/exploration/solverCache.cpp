@@ -0,0 +1,47 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <solverCache.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      bool SolverCache::find(const triton::uint512& key, std::map<triton::uint32, triton::engines::solver::SolverModel>& model) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        auto it = this->models.find(key);
+
+        if (it == this->models.end())
+          return false;
+
+        model = it->second;
+        return true;
+      }
+
+
+      void SolverCache::insert(const triton::uint512& key, const std::map<triton::uint32, triton::engines::solver::SolverModel>& model) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->models[key] = model;
+      }
+
+
+      triton::usize SolverCache::size(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->models.size();
+      }
+
+
+      void SolverCache::clear(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->models.clear();
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,246 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+  #include <x86intrin.h>
+#endif
+
+#include <exceptions.hpp>
+#include <profiler.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace profiling {
+
+      Profiler::Profiler() {
+        this->reset();
+        this->tracing = false;
+      }
+
+
+      bool Profiler::isAvailable(void) {
+        #if defined(TRITON_PROFILING)
+          return true;
+        #else
+          return false;
+        #endif
+      }
+
+
+      triton::uint64 Profiler::cycles(void) {
+        #if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+          return __rdtsc();
+        #else
+          return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        #endif
+      }
+
+
+      const char* Profiler::getStageName(stage_e stage) {
+        switch (stage) {
+          case STAGE_PROCESSING:      return "processing";
+          case STAGE_DISASSEMBLY:     return "disassembly";
+          case STAGE_FAST_FORWARD:    return "fastForward";
+          case STAGE_SEMANTICS:       return "semantics";
+          case STAGE_SIMPLIFICATION:  return "simplification";
+          case STAGE_AST_RECORDING:   return "astRecording";
+          case STAGE_TAINT:           return "taint";
+          case STAGE_POST_IR:         return "postIr";
+          default:
+            throw triton::exceptions::Profiler("Profiler::getStageName(): Invalid stage.");
+        }
+      }
+
+
+      triton::uint64 Profiler::enter(stage_e stage) {
+        triton::uint64 now = Profiler::cycles();
+
+        if (!this->active.empty())
+          this->stages[this->active.back()].cycles += now - this->last;
+
+        this->active.push_back(stage);
+        this->stages[stage].calls++;
+        this->last = now;
+
+        return now;
+      }
+
+
+      void Profiler::leave(stage_e stage, triton::uint64 start) {
+        triton::uint64 now = Profiler::cycles();
+
+        this->stages[stage].cycles      += now - this->last;
+        this->stages[stage].totalCycles += now - std::max(start, this->originCycles);
+        this->active.pop_back();
+        this->last = now;
+
+        if (this->tracing)
+          this->record(stage, start, now, 0, 0);
+      }
+
+
+      void Profiler::leave(const triton::arch::Instruction& inst, triton::uint64 start, triton::usize nodes, triton::usize expressions) {
+        triton::uint64 now = Profiler::cycles();
+
+        this->stages[STAGE_PROCESSING].cycles      += now - this->last;
+        this->stages[STAGE_PROCESSING].totalCycles += now - std::max(start, this->originCycles);
+        this->active.pop_back();
+        this->last = now;
+
+        /* An instruction which cannot be decoded has no opcode, nor any counter if a reset occurred meanwhile */
+        if (inst.getType() != 0 && start >= this->originCycles) {
+          OpcodeProfile& opcode = this->opcodes[inst.getType()];
+          opcode.count++;
+          opcode.nodes       += this->nodes - nodes;
+          opcode.expressions += this->expressions - expressions;
+          opcode.cycles      += now - start;
+        }
+
+        if (this->tracing)
+          this->record(STAGE_PROCESSING, start, now, inst.getAddress(), inst.getType());
+      }
+
+
+      void Profiler::record(stage_e stage, triton::uint64 start, triton::uint64 end, triton::uint64 address, triton::uint32 type) {
+        if (this->events.size() >= TRACE_MAX_EVENTS) {
+          this->dropped++;
+          return;
+        }
+
+        TraceEvent event;
+        event.stage   = stage;
+        event.start   = start;
+        event.end     = end;
+        event.address = address;
+        event.type    = type;
+        this->events.push_back(event);
+      }
+
+
+      void Profiler::recordNode(void) {
+        this->nodes++;
+      }
+
+
+      void Profiler::recordExpression(void) {
+        this->expressions++;
+      }
+
+
+      void Profiler::recordVariable(void) {
+        this->variables++;
+      }
+
+
+      const StageProfile& Profiler::getStage(stage_e stage) const {
+        if (stage >= STAGE_LAST_ITEM)
+          throw triton::exceptions::Profiler("Profiler::getStage(): Invalid stage.");
+        return this->stages[stage];
+      }
+
+
+      const std::map<triton::uint32, OpcodeProfile>& Profiler::getOpcodes(void) const {
+        return this->opcodes;
+      }
+
+
+      triton::usize Profiler::getNodes(void) const {
+        return this->nodes;
+      }
+
+
+      triton::usize Profiler::getExpressions(void) const {
+        return this->expressions;
+      }
+
+
+      triton::usize Profiler::getVariables(void) const {
+        return this->variables;
+      }
+
+
+      std::map<std::string, triton::uint64> Profiler::getStats(void) const {
+        std::map<std::string, triton::uint64> stats;
+
+        for (triton::uint32 stage = 0; stage < STAGE_LAST_ITEM; stage++) {
+          std::string name = Profiler::getStageName(static_cast<stage_e>(stage));
+          stats[name + ".calls"]       = this->stages[stage].calls;
+          stats[name + ".cycles"]      = this->stages[stage].cycles;
+          stats[name + ".totalCycles"] = this->stages[stage].totalCycles;
+        }
+
+        stats["droppedEvents"] = this->dropped;
+        stats["events"]        = this->events.size();
+        stats["expressions"]   = this->expressions;
+        stats["nodes"]         = this->nodes;
+        stats["opcodes"]       = this->opcodes.size();
+        stats["variables"]     = this->variables;
+
+        return stats;
+      }
+
+
+      void Profiler::enableTrace(bool flag) {
+        this->tracing = flag;
+      }
+
+
+      bool Profiler::isTraceEnabled(void) const {
+        return this->tracing;
+      }
+
+
+      void Profiler::exportTrace(std::ostream& out) const {
+        double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - this->originTime).count();
+        triton::uint64 ticks = Profiler::cycles() - this->originCycles;
+
+        /* The events are timed in cycles, the trace-event format expects microseconds */
+        double perMicro = (elapsed > 0 && ticks > 0) ? ticks / elapsed : 1;
+
+        bool first = true;
+
+        out << "{\"traceEvents\": [";
+        for (auto it = this->events.begin(); it != this->events.end(); it++) {
+          /* Stages entered before a reset are not exported */
+          if (it->start < this->originCycles)
+            continue;
+          out << (first ? "\n" : ",\n");
+          first = false;
+          out << "{\"name\": \"" << Profiler::getStageName(it->stage) << "\", \"cat\": \"triton\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0";
+          out << ", \"ts\": " << static_cast<double>(it->start - this->originCycles) / perMicro;
+          out << ", \"dur\": " << static_cast<double>(it->end - it->start) / perMicro;
+          if (it->stage == STAGE_PROCESSING)
+            out << ", \"args\": {\"address\": " << it->address << ", \"opcode\": " << it->type << "}";
+          out << "}";
+        }
+        out << "\n], \"displayTimeUnit\": \"ns\"}\n";
+      }
+
+
+      void Profiler::reset(void) {
+        std::memset(this->stages, 0x00, sizeof(this->stages));
+        this->opcodes.clear();
+        this->events.clear();
+        this->dropped      = 0;
+        this->expressions  = 0;
+        this->nodes        = 0;
+        this->variables    = 0;
+        this->originCycles = Profiler::cycles();
+        this->originTime   = std::chrono::steady_clock::now();
+        this->last         = this->originCycles;
+      }
+
+    }; /* profiling namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
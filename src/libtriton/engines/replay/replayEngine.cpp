@@ -0,0 +1,60 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <exceptions.hpp>
+#include <replayEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace replay {
+
+      ReplayEngine::ReplayEngine(triton::API& ctx)
+        : ctx(ctx) {
+      }
+
+
+      void ReplayEngine::setCallback(const InstructionCallback& callback) {
+        this->callback = callback;
+      }
+
+
+      triton::usize ReplayEngine::replay(const std::string& path, triton::usize maxInstructions) {
+        triton::format::trace::TraceReader reader(path);
+        return this->replay(reader, maxInstructions);
+      }
+
+
+      triton::usize ReplayEngine::replay(triton::format::trace::TraceReader& reader, triton::usize maxInstructions) {
+        triton::API::Scope scope(this->ctx);
+        triton::usize count = 0;
+
+        if (!this->ctx.isArchitectureValid())
+          this->ctx.setArchitecture(reader.getArchitecture());
+        else if (this->ctx.getArchitecture() != reader.getArchitecture())
+          throw triton::exceptions::Replay("ReplayEngine::replay(): The architecture of the trace differs from the one of the context.");
+
+        while (maxInstructions == 0 || count < maxInstructions) {
+          triton::arch::Instruction inst;
+
+          if (!reader.next(inst))
+            break;
+
+          this->ctx.processing(inst);
+          if (this->callback)
+            this->callback(this->ctx, inst);
+
+          count++;
+        }
+
+        return count;
+      }
+
+    }; /* replay namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
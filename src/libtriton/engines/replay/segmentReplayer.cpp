@@ -0,0 +1,123 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include <segmentReplayer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace replay {
+
+      SegmentReplayer::SegmentReplayer(const std::string& tracePath, const triton::format::trace::TraceIndex& index)
+        : index(index) {
+        this->tracePath = tracePath;
+        this->workers   = 0;
+      }
+
+
+      void SegmentReplayer::setBeginCallback(const SegmentCallback& begin) {
+        this->begin = begin;
+      }
+
+
+      void SegmentReplayer::setEndCallback(const SegmentCallback& end) {
+        this->end = end;
+      }
+
+
+      void SegmentReplayer::setInstructionCallback(const ReplayEngine::InstructionCallback& callback) {
+        this->callback = callback;
+      }
+
+
+      void SegmentReplayer::setWorkers(triton::usize workers) {
+        this->workers = workers;
+      }
+
+
+      std::vector<TraceSegment> SegmentReplayer::getSegments(void) const {
+        const auto& checkpoints = this->index.getCheckpoints();
+        std::vector<TraceSegment> segments;
+
+        for (triton::usize index = 0; index < checkpoints.size(); index++) {
+          TraceSegment segment;
+          triton::usize last = (index + 1 < checkpoints.size()) ? checkpoints[index + 1].instruction : this->index.getInstructionCount();
+          segment.index = index;
+          segment.first = checkpoints[index].instruction;
+          segment.count = last - segment.first;
+          segments.push_back(segment);
+        }
+
+        return segments;
+      }
+
+
+      void SegmentReplayer::run(void) {
+        std::vector<TraceSegment> segments = this->getSegments();
+        std::atomic<triton::usize> next(0);
+        std::vector<std::thread> threads;
+        std::exception_ptr error;
+        std::mutex errorLock;
+        triton::usize count = this->workers;
+
+        if (count == 0)
+          count = std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+        count = std::min<triton::usize>(count, std::max<triton::usize>(segments.size(), 1));
+
+        for (triton::usize worker = 0; worker < count; worker++) {
+          threads.push_back(std::thread([&]() {
+            try {
+              triton::API ctx;
+              triton::API::Scope scope(ctx);
+              triton::format::trace::TraceReader reader(this->tracePath);
+              ReplayEngine replay(ctx);
+
+              replay.setCallback(this->callback);
+
+              for (triton::usize index = next++; index < segments.size(); index = next++) {
+                const TraceSegment& segment = segments[index];
+
+                /* A fresh state for each segment */
+                ctx.setArchitecture(this->index.getArchitecture());
+                this->index.restore(ctx, segment.index);
+                this->index.seek(reader, segment.index);
+
+                if (this->begin)
+                  this->begin(ctx, segment);
+                if (segment.count)
+                  replay.replay(reader, segment.count);
+                if (this->end)
+                  this->end(ctx, segment);
+              }
+            }
+            /* The first failure stops the other workers once their segment is done */
+            catch (...) {
+              std::lock_guard<std::mutex> guard(errorLock);
+              if (!error)
+                error = std::current_exception();
+              next = segments.size();
+            }
+          }));
+        }
+
+        for (auto& thread : threads)
+          thread.join();
+
+        if (error)
+          std::rethrow_exception(error);
+      }
+
+    }; /* replay namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,110 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <exceptions.hpp>
+#include <snapshotEngine.hpp>
+
+
+
+/*! \page engine_snapshot_page Snapshot Engine
+    \brief [**internal**] All information about the snapshot engine.
+
+\tableofcontents
+
+\section engine_snapshot_description Description
+<hr>
+
+The snapshot engine allows you to save and restore the concrete, symbolic and taint states. Taking a snapshot
+does not copy these states, it only records marks. From the first snapshot, each component journals the previous
+value of what it modifies (concrete memory cells and registers, memory references, tainted addresses, ASTs replaced
+by symbolic variables, cleared path constraints and newly allocated AST nodes). Restoring a snapshot unwinds these
+journals in reverse order, deletes symbolic expressions and variables created after the snapshot and frees their
+nodes. Thus, taking a snapshot costs O(1) and restoring it costs O(number of changes since the snapshot).
+
+Snapshots are stacked. Restoring the snapshot `id` keeps it alive (it may be restored again) but discards all
+snapshots taken after it. Note that symbolic expression and variable ids are never reused after a restore.
+
+*/
+
+
+
+namespace triton {
+  namespace engines {
+    namespace snapshot {
+
+      SnapshotEngine::SnapshotEngine(triton::arch::Architecture* architecture,
+                                     triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                     triton::engines::taint::TaintEngine* taintEngine,
+                                     triton::ast::AstGarbageCollector* astGarbageCollector) {
+        if (architecture == nullptr || symbolicEngine == nullptr || taintEngine == nullptr || astGarbageCollector == nullptr)
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::SnapshotEngine(): The engines cannot be null.");
+
+        this->architecture        = architecture;
+        this->symbolicEngine      = symbolicEngine;
+        this->taintEngine         = taintEngine;
+        this->astGarbageCollector = astGarbageCollector;
+        this->numberOfSnapshots   = 0;
+      }
+
+
+      SnapshotEngine::~SnapshotEngine() {
+        this->removeAllSnapshots();
+      }
+
+
+      triton::usize SnapshotEngine::takeSnapshot(void) {
+        this->architecture->takeSnapshot();
+        this->symbolicEngine->takeSnapshot();
+        this->taintEngine->takeSnapshot();
+        this->astGarbageCollector->takeSnapshot();
+        return this->numberOfSnapshots++;
+      }
+
+
+      void SnapshotEngine::restoreSnapshot(triton::usize id) {
+        if (!this->isSnapshotExists(id))
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::restoreSnapshot(): Invalid snapshot id.");
+
+        /* Expressions must be deleted before their nodes */
+        this->symbolicEngine->restoreSnapshot(id);
+        this->astGarbageCollector->restoreSnapshot(id);
+        this->taintEngine->restoreSnapshot(id);
+        this->architecture->restoreSnapshot(id);
+        this->numberOfSnapshots = id + 1;
+      }
+
+
+      void SnapshotEngine::removeSnapshot(triton::usize id) {
+        if (!this->isSnapshotExists(id))
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::removeSnapshot(): Invalid snapshot id.");
+
+        this->architecture->discardSnapshots(id);
+        this->symbolicEngine->discardSnapshots(id);
+        this->taintEngine->discardSnapshots(id);
+        this->astGarbageCollector->discardSnapshots(id);
+        this->numberOfSnapshots = id;
+      }
+
+
+      void SnapshotEngine::removeAllSnapshots(void) {
+        if (this->numberOfSnapshots)
+          this->removeSnapshot(0);
+      }
+
+
+      bool SnapshotEngine::isSnapshotExists(triton::usize id) const {
+        return (id < this->numberOfSnapshots);
+      }
+
+
+      triton::usize SnapshotEngine::getNumberOfSnapshots(void) const {
+        return this->numberOfSnapshots;
+      }
+
+    }; /* snapshot namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <api.hpp>
 #include <ast.hpp>
 #include <astRepresentation.hpp>
 #include <exceptions.hpp>
@@ -121,13 +122,13 @@ namespace triton {
         std::ostringstream formula;
         z3::context ctx;
         z3::solver solver(ctx);
-        triton::uint32 representationMode = triton::ast::representations::astRepresentation.getMode();
+        triton::uint32 representationMode = triton::API::getCurrent().getAstRepresentationMode();
 
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
         /* Switch into the SMT mode */
-        triton::ast::representations::astRepresentation.setMode(triton::ast::representations::SMT_REPRESENTATION);
+        triton::API::getCurrent().setAstRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
 
         /* First, set the QF_AUFBV flag  */
         formula << "(set-logic QF_BV)";
@@ -198,7 +199,7 @@ namespace triton {
         }
 
         /* Restore the representation mode */
-        triton::ast::representations::astRepresentation.setMode(representationMode);
+        triton::API::getCurrent().setAstRepresentationMode(representationMode);
 
         return ret;
       }
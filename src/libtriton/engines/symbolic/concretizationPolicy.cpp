@@ -0,0 +1,146 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <concretizationPolicy.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      ConcretizationPolicy::ConcretizationPolicy() {
+        this->instructionIndex = 0;
+      }
+
+
+      ConcretizationPolicy::ConcretizationPolicy(const ConcretizationPolicy& copy) {
+        this->copy(copy);
+      }
+
+
+      ConcretizationPolicy::~ConcretizationPolicy() {
+      }
+
+
+      void ConcretizationPolicy::copy(const ConcretizationPolicy& other) {
+        this->events            = other.events;
+        this->instructionIndex  = other.instructionIndex;
+        this->limits            = other.limits;
+        this->memoryAges        = other.memoryAges;
+        this->ranges            = other.ranges;
+        this->registerAges      = other.registerAges;
+      }
+
+
+      bool ConcretizationPolicy::isConcretizationPolicyEnabled(void) const {
+        return (!this->limits.empty() || !this->ranges.empty());
+      }
+
+
+      triton::uint64 ConcretizationPolicy::getConcretizationLimit(triton::engines::symbolic::concretization_e kind) const {
+        std::map<triton::engines::symbolic::concretization_e, triton::uint64>::const_iterator it = this->limits.find(kind);
+
+        if (kind == triton::engines::symbolic::ADDRESS_RANGE)
+          throw triton::exceptions::ConcretizationPolicy("ConcretizationPolicy::getConcretizationLimit(): ADDRESS_RANGE is not a limit.");
+
+        if (it == this->limits.end())
+          return 0;
+        return it->second;
+      }
+
+
+      void ConcretizationPolicy::setConcretizationLimit(triton::engines::symbolic::concretization_e kind, triton::uint64 limit) {
+        switch (kind) {
+          case triton::engines::symbolic::MAX_AGE:
+          case triton::engines::symbolic::MAX_DEPTH:
+          case triton::engines::symbolic::MAX_NODES:
+            break;
+          default:
+            throw triton::exceptions::ConcretizationPolicy("ConcretizationPolicy::setConcretizationLimit(): Invalid kind of limit.");
+        }
+
+        if (limit == 0)
+          this->limits.erase(kind);
+        else
+          this->limits[kind] = limit;
+      }
+
+
+      void ConcretizationPolicy::addConcretizationRange(triton::uint64 start, triton::uint64 end) {
+        if (start > end)
+          throw triton::exceptions::ConcretizationPolicy("ConcretizationPolicy::addConcretizationRange(): start must be lower or equal to end.");
+        this->ranges.push_back(std::make_pair(start, end));
+      }
+
+
+      void ConcretizationPolicy::clearConcretizationRanges(void) {
+        this->ranges.clear();
+      }
+
+
+      const std::vector<triton::engines::symbolic::ConcretizationEvent>& ConcretizationPolicy::getConcretizationEvents(void) const {
+        return this->events;
+      }
+
+
+      void ConcretizationPolicy::clearConcretizationEvents(void) {
+        this->events.clear();
+      }
+
+
+      bool ConcretizationPolicy::isLimitExceeded(const triton::ast::AbstractNode* node, triton::uint64 age, triton::engines::symbolic::concretization_e& reason) const {
+        std::map<triton::engines::symbolic::concretization_e, triton::uint64>::const_iterator it;
+
+        for (it = this->limits.begin(); it != this->limits.end(); it++) {
+          switch (it->first) {
+            case triton::engines::symbolic::MAX_AGE:
+              if (age <= it->second)
+                continue;
+              break;
+            case triton::engines::symbolic::MAX_DEPTH:
+              if (node->getDepth() <= it->second)
+                continue;
+              break;
+            case triton::engines::symbolic::MAX_NODES:
+              if (node->getNumberOfNodes() <= it->second)
+                continue;
+              break;
+            default:
+              continue;
+          }
+          reason = it->first;
+          return true;
+        }
+
+        return false;
+      }
+
+
+      bool ConcretizationPolicy::isInConcretizationRange(triton::uint64 addr, triton::uint32 size) const {
+        std::list<std::pair<triton::uint64, triton::uint64>>::const_iterator it;
+
+        if (size == 0)
+          return false;
+
+        for (it = this->ranges.begin(); it != this->ranges.end(); it++) {
+          if (addr <= it->second && it->first <= addr + (size - 1))
+            return true;
+        }
+
+        return false;
+      }
+
+
+      void ConcretizationPolicy::operator=(const ConcretizationPolicy& other) {
+        this->copy(other);
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
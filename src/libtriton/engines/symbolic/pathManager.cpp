@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+
 #include <exceptions.hpp>
 #include <pathManager.hpp>
 #include <symbolicEnums.hpp>
@@ -16,11 +18,13 @@ namespace triton {
     namespace symbolic {
 
       PathManager::PathManager() {
+        this->pathConstraintsJournaling = false;
       }
 
 
       PathManager::PathManager(const PathManager& copy)
         : triton::engines::symbolic::SymbolicOptimization(copy) {
+        this->pathConstraintsJournaling = false;
         this->copy(copy);
       }
 
@@ -123,6 +127,8 @@ namespace triton {
 
 
       void PathManager::clearPathConstraints(void) {
+        if (this->pathConstraintsJournaling)
+          this->pathConstraintsJournal.push_back(std::move(this->pathConstraints));
         this->pathConstraints.clear();
       }
 
@@ -0,0 +1,519 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <exceptions.hpp>
+#include <semanticsTemplate.hpp>
+#include <symbolicEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      bool SemanticsTemplate::isRebuildable(triton::ast::kind_e kind, triton::usize params, triton::usize childs) {
+        switch (kind) {
+          case triton::ast::BV_NODE:
+            return (params == 2 && childs == 0);
+
+          case triton::ast::EXTRACT_NODE:
+            return (params == 2 && childs == 1);
+
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            return (params == 1 && childs == 1);
+
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE:
+            return ((params == 1 && childs == 1) || (params == 0 && childs == 2));
+
+          case triton::ast::CONCAT_NODE:
+            return (params == 0 && childs >= 1);
+
+          case triton::ast::ITE_NODE:
+            return (params == 0 && childs == 3);
+
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::LNOT_NODE:
+            return (params == 0 && childs == 1);
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+          case triton::ast::BVUREM_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+            return (params == 0 && childs == 2);
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool SemanticsTemplate::match(const triton::arch::Instruction& inst) const {
+        if (inst.getSize() != this->opcodes.size())
+          return false;
+        return (std::memcmp(inst.getOpcodes(), this->opcodes.data(), this->opcodes.size()) == 0);
+      }
+
+
+      triton::arch::Register& SemanticsTemplate::getRegister(triton::arch::Instruction& inst, const Step& step, triton::arch::Register& standalone) const {
+        switch (step.source) {
+          case OPERAND:         return inst.operands[step.operand].getRegister();
+          case OPERAND_BASE:    return inst.operands[step.operand].getMemory().getBaseRegister();
+          case OPERAND_INDEX:   return inst.operands[step.operand].getMemory().getIndexRegister();
+          case OPERAND_SEGMENT: return inst.operands[step.operand].getMemory().getSegmentRegister();
+          case STANDALONE:
+            standalone = step.reg;
+            return standalone;
+          default:
+            throw triton::exceptions::SymbolicEngine("SemanticsTemplate::getRegister(): Invalid source.");
+        }
+      }
+
+
+      triton::arch::Immediate& SemanticsTemplate::getImmediate(triton::arch::Instruction& inst, const Step& step, triton::arch::Immediate& standalone) const {
+        switch (step.source) {
+          case OPERAND:       return inst.operands[step.operand].getImmediate();
+          case OPERAND_DISP:  return inst.operands[step.operand].getMemory().getDisplacement();
+          case OPERAND_SCALE: return inst.operands[step.operand].getMemory().getScale();
+          case STANDALONE:
+            standalone = step.imm;
+            return standalone;
+          default:
+            throw triton::exceptions::SymbolicEngine("SemanticsTemplate::getImmediate(): Invalid source.");
+        }
+      }
+
+
+      triton::ast::AbstractNode* SemanticsTemplate::buildNode(const Node& node,
+                                                              const std::vector<triton::ast::AbstractNode*>& nodes,
+                                                              const std::vector<triton::ast::AbstractNode*>& leaves,
+                                                              const std::vector<SymbolicExpression*>& expressions) const {
+        switch (node.origin) {
+          case LEAF:        return leaves[node.step];
+          case REFERENCE:   return triton::ast::reference(expressions[node.step]->getId());
+          case EXPRESSION:  return expressions[node.step]->getAst();
+          default:
+            break;
+        }
+
+        #define CHILD(n) nodes[node.childs[n]]
+        #define PARAM(n) node.params[n].convert_to<triton::uint32>()
+
+        switch (node.kind) {
+          case triton::ast::BV_NODE:        return triton::ast::bv(node.params[0], PARAM(1));
+          case triton::ast::EXTRACT_NODE:   return triton::ast::extract(PARAM(0), PARAM(1), CHILD(0));
+          case triton::ast::SX_NODE:        return triton::ast::sx(PARAM(0), CHILD(0));
+          case triton::ast::ZX_NODE:        return triton::ast::zx(PARAM(0), CHILD(0));
+          case triton::ast::ITE_NODE:       return triton::ast::ite(CHILD(0), CHILD(1), CHILD(2));
+          case triton::ast::BVNEG_NODE:     return triton::ast::bvneg(CHILD(0));
+          case triton::ast::BVNOT_NODE:     return triton::ast::bvnot(CHILD(0));
+          case triton::ast::LNOT_NODE:      return triton::ast::lnot(CHILD(0));
+          case triton::ast::BVADD_NODE:     return triton::ast::bvadd(CHILD(0), CHILD(1));
+          case triton::ast::BVAND_NODE:     return triton::ast::bvand(CHILD(0), CHILD(1));
+          case triton::ast::BVASHR_NODE:    return triton::ast::bvashr(CHILD(0), CHILD(1));
+          case triton::ast::BVLSHR_NODE:    return triton::ast::bvlshr(CHILD(0), CHILD(1));
+          case triton::ast::BVMUL_NODE:     return triton::ast::bvmul(CHILD(0), CHILD(1));
+          case triton::ast::BVNAND_NODE:    return triton::ast::bvnand(CHILD(0), CHILD(1));
+          case triton::ast::BVNOR_NODE:     return triton::ast::bvnor(CHILD(0), CHILD(1));
+          case triton::ast::BVOR_NODE:      return triton::ast::bvor(CHILD(0), CHILD(1));
+          case triton::ast::BVSDIV_NODE:    return triton::ast::bvsdiv(CHILD(0), CHILD(1));
+          case triton::ast::BVSGE_NODE:     return triton::ast::bvsge(CHILD(0), CHILD(1));
+          case triton::ast::BVSGT_NODE:     return triton::ast::bvsgt(CHILD(0), CHILD(1));
+          case triton::ast::BVSHL_NODE:     return triton::ast::bvshl(CHILD(0), CHILD(1));
+          case triton::ast::BVSLE_NODE:     return triton::ast::bvsle(CHILD(0), CHILD(1));
+          case triton::ast::BVSLT_NODE:     return triton::ast::bvslt(CHILD(0), CHILD(1));
+          case triton::ast::BVSMOD_NODE:    return triton::ast::bvsmod(CHILD(0), CHILD(1));
+          case triton::ast::BVSREM_NODE:    return triton::ast::bvsrem(CHILD(0), CHILD(1));
+          case triton::ast::BVSUB_NODE:     return triton::ast::bvsub(CHILD(0), CHILD(1));
+          case triton::ast::BVUDIV_NODE:    return triton::ast::bvudiv(CHILD(0), CHILD(1));
+          case triton::ast::BVUGE_NODE:     return triton::ast::bvuge(CHILD(0), CHILD(1));
+          case triton::ast::BVUGT_NODE:     return triton::ast::bvugt(CHILD(0), CHILD(1));
+          case triton::ast::BVULE_NODE:     return triton::ast::bvule(CHILD(0), CHILD(1));
+          case triton::ast::BVULT_NODE:     return triton::ast::bvult(CHILD(0), CHILD(1));
+          case triton::ast::BVUREM_NODE:    return triton::ast::bvurem(CHILD(0), CHILD(1));
+          case triton::ast::BVXNOR_NODE:    return triton::ast::bvxnor(CHILD(0), CHILD(1));
+          case triton::ast::BVXOR_NODE:     return triton::ast::bvxor(CHILD(0), CHILD(1));
+          case triton::ast::DISTINCT_NODE:  return triton::ast::distinct(CHILD(0), CHILD(1));
+          case triton::ast::EQUAL_NODE:     return triton::ast::equal(CHILD(0), CHILD(1));
+          case triton::ast::LAND_NODE:      return triton::ast::land(CHILD(0), CHILD(1));
+          case triton::ast::LOR_NODE:       return triton::ast::lor(CHILD(0), CHILD(1));
+
+          case triton::ast::BVROL_NODE:
+            if (node.params.size() == 1)
+              return triton::ast::bvrol(PARAM(0), CHILD(0));
+            return triton::ast::bvrol(CHILD(0), CHILD(1));
+
+          case triton::ast::BVROR_NODE:
+            if (node.params.size() == 1)
+              return triton::ast::bvror(PARAM(0), CHILD(0));
+            return triton::ast::bvror(CHILD(0), CHILD(1));
+
+          case triton::ast::CONCAT_NODE: {
+            std::vector<triton::ast::AbstractNode*> exprs;
+            exprs.reserve(node.childs.size());
+            for (triton::usize index = 0; index < node.childs.size(); index++)
+              exprs.push_back(CHILD(index));
+            return triton::ast::concat(exprs);
+          }
+
+          default:
+            throw triton::exceptions::SymbolicEngine("SemanticsTemplate::buildNode(): Invalid kind of node.");
+        }
+
+        #undef CHILD
+        #undef PARAM
+      }
+
+
+      void SemanticsTemplate::instantiate(triton::arch::Instruction& inst, SymbolicEngine* engine) const {
+        std::vector<triton::ast::AbstractNode*> nodes;
+        std::vector<triton::ast::AbstractNode*> leaves(this->steps.size(), nullptr);
+        std::vector<SymbolicExpression*> expressions(this->steps.size(), nullptr);
+        triton::arch::Immediate imm;
+        triton::arch::Register reg;
+
+        nodes.reserve(this->nodes.size());
+
+        for (triton::usize index = 0; index < this->steps.size(); index++) {
+          const Step& step = this->steps[index];
+
+          /* Rebuild the nodes needed by an expression */
+          if (step.kind >= FLAG_EXPRESSION) {
+            while (nodes.size() <= step.node)
+              nodes.push_back(this->buildNode(this->nodes[nodes.size()], nodes, leaves, expressions));
+          }
+
+          switch (step.kind) {
+            case LEAF_IMMEDIATE: {
+              triton::arch::Immediate& leaf = this->getImmediate(inst, step, imm);
+              leaves[index] = step.input ? engine->buildSymbolicImmediate(inst, leaf) : engine->buildSymbolicImmediate(leaf);
+              break;
+            }
+
+            case LEAF_MEMORY: {
+              triton::arch::MemoryAccess& leaf = inst.operands[step.operand].getMemory();
+              leaves[index] = step.input ? engine->buildSymbolicMemory(inst, leaf) : engine->buildSymbolicMemory(leaf);
+              break;
+            }
+
+            case LEAF_REGISTER: {
+              triton::arch::Register& leaf = this->getRegister(inst, step, reg);
+              leaves[index] = step.input ? engine->buildSymbolicRegister(inst, leaf) : engine->buildSymbolicRegister(leaf);
+              break;
+            }
+
+            case FLAG_EXPRESSION:
+              expressions[index] = engine->createSymbolicFlagExpression(inst, nodes[step.node], this->getRegister(inst, step, reg), step.comment);
+              break;
+
+            case MEMORY_EXPRESSION:
+              expressions[index] = engine->createSymbolicMemoryExpression(inst, nodes[step.node], inst.operands[step.operand].getMemory(), step.comment);
+              break;
+
+            case REGISTER_EXPRESSION:
+              expressions[index] = engine->createSymbolicRegisterExpression(inst, nodes[step.node], this->getRegister(inst, step, reg), step.comment);
+              break;
+
+            case VOLATILE_EXPRESSION:
+              expressions[index] = engine->createSymbolicVolatileExpression(inst, nodes[step.node], step.comment);
+              break;
+          }
+        }
+      }
+
+
+      SemanticsRecorder::SemanticsRecorder(triton::arch::Instruction& inst) {
+        this->inst  = &inst;
+        this->valid = true;
+        this->depth = 0;
+        this->result.opcodes.assign(inst.getOpcodes(), inst.getOpcodes() + inst.getSize());
+      }
+
+
+      bool SemanticsRecorder::isValid(void) const {
+        return this->valid;
+      }
+
+
+      const SemanticsTemplate& SemanticsRecorder::getTemplate(void) const {
+        return this->result;
+      }
+
+
+      SemanticsTemplate::source_e SemanticsRecorder::findSource(const void* object, triton::uint32& operand) const {
+        for (triton::uint32 index = 0; index < this->inst->operands.size(); index++) {
+          triton::arch::OperandWrapper& op = this->inst->operands[index];
+          triton::arch::MemoryAccess& mem  = op.getMemory();
+
+          operand = index;
+          if (object == &op.getImmediate() || object == &op.getMemory() || object == &op.getRegister())
+            return SemanticsTemplate::OPERAND;
+          if (object == &mem.getBaseRegister())
+            return SemanticsTemplate::OPERAND_BASE;
+          if (object == &mem.getIndexRegister())
+            return SemanticsTemplate::OPERAND_INDEX;
+          if (object == &mem.getSegmentRegister())
+            return SemanticsTemplate::OPERAND_SEGMENT;
+          if (object == &mem.getDisplacement())
+            return SemanticsTemplate::OPERAND_DISP;
+          if (object == &mem.getScale())
+            return SemanticsTemplate::OPERAND_SCALE;
+        }
+
+        operand = 0;
+        return SemanticsTemplate::STANDALONE;
+      }
+
+
+      triton::usize SemanticsRecorder::addNode(triton::ast::AbstractNode* node) {
+        SemanticsTemplate::Node entry;
+
+        auto it = this->nodeIndexes.find(node);
+        if (it != this->nodeIndexes.end())
+          return it->second;
+
+        auto ast = this->expressionAsts.find(node);
+        if (ast != this->expressionAsts.end()) {
+          entry.origin = SemanticsTemplate::EXPRESSION;
+          entry.step   = ast->second;
+        }
+
+        else if (node->getKind() == triton::ast::REFERENCE_NODE) {
+          auto expr = this->expressionSteps.find(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+          /* A reference to an expression of another instruction cannot be replayed */
+          if (expr == this->expressionSteps.end()) {
+            this->valid = false;
+            return 0;
+          }
+          entry.origin = SemanticsTemplate::REFERENCE;
+          entry.step   = expr->second;
+        }
+
+        else {
+          entry.origin = SemanticsTemplate::BUILT;
+          entry.kind   = node->getKind();
+          entry.step   = 0;
+
+          for (triton::ast::AbstractNode* child : node->getChilds()) {
+            if (child->getKind() == triton::ast::DECIMAL_NODE) {
+              entry.params.push_back(reinterpret_cast<triton::ast::DecimalNode*>(child)->getValue());
+              continue;
+            }
+            triton::usize index = this->addNode(child);
+            if (!this->valid)
+              return 0;
+            entry.childs.push_back(index);
+          }
+
+          if (!SemanticsTemplate::isRebuildable(entry.kind, entry.params.size(), entry.childs.size())) {
+            this->valid = false;
+            return 0;
+          }
+        }
+
+        this->result.nodes.push_back(entry);
+        this->nodeIndexes[node] = this->result.nodes.size() - 1;
+
+        return this->result.nodes.size() - 1;
+      }
+
+
+      void SemanticsRecorder::addLeaf(SemanticsTemplate::Step& step, triton::ast::AbstractNode* node) {
+        SemanticsTemplate::Node entry;
+
+        entry.origin = SemanticsTemplate::LEAF;
+        entry.kind   = triton::ast::UNDEFINED_NODE;
+        entry.step   = this->result.steps.size();
+
+        this->result.steps.push_back(step);
+        this->result.nodes.push_back(entry);
+        this->nodeIndexes[node] = this->result.nodes.size() - 1;
+      }
+
+
+      triton::usize SemanticsRecorder::addExpression(SemanticsTemplate::Step& step, triton::ast::AbstractNode* node, const std::string& comment) {
+        step.node    = this->addNode(node);
+        step.comment = comment;
+        this->result.steps.push_back(step);
+        return this->result.steps.size() - 1;
+      }
+
+
+      SemanticsRecorder::Scope::Scope(SemanticsRecorder* recorder) {
+        this->recorder  = recorder;
+        this->outermost = false;
+        this->step      = 0;
+
+        if (this->recorder != nullptr) {
+          this->outermost = (this->recorder->depth == 0 && this->recorder->valid);
+          this->recorder->depth++;
+        }
+      }
+
+
+      SemanticsRecorder::Scope::~Scope() {
+        if (this->recorder != nullptr)
+          this->recorder->depth--;
+      }
+
+
+      void SemanticsRecorder::Scope::recordImmediate(const triton::arch::Immediate& imm, triton::ast::AbstractNode* node, bool input) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::LEAF_IMMEDIATE;
+        step.source = this->recorder->findSource(&imm, step.operand);
+        step.input  = input;
+        step.imm    = imm;
+        step.node   = 0;
+
+        this->recorder->addLeaf(step, node);
+      }
+
+
+      void SemanticsRecorder::Scope::recordMemory(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node, bool input) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::LEAF_MEMORY;
+        step.source = this->recorder->findSource(&mem, step.operand);
+        step.input  = input;
+        step.node   = 0;
+
+        /* Only the memory operands are computed again from the instruction */
+        if (step.source != SemanticsTemplate::OPERAND) {
+          this->recorder->valid = false;
+          return;
+        }
+
+        this->recorder->addLeaf(step, node);
+      }
+
+
+      void SemanticsRecorder::Scope::recordRegister(const triton::arch::Register& reg, triton::ast::AbstractNode* node, bool input) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::LEAF_REGISTER;
+        step.source = this->recorder->findSource(&reg, step.operand);
+        step.input  = input;
+        step.reg    = reg;
+        step.node   = 0;
+
+        this->recorder->addLeaf(step, node);
+      }
+
+
+      void SemanticsRecorder::Scope::recordFlagExpression(triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::FLAG_EXPRESSION;
+        step.source = this->recorder->findSource(&flag, step.operand);
+        step.input  = false;
+        step.reg    = flag;
+
+        this->step = this->recorder->addExpression(step, node, comment);
+      }
+
+
+      void SemanticsRecorder::Scope::recordMemoryExpression(triton::ast::AbstractNode* node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::MEMORY_EXPRESSION;
+        step.source = this->recorder->findSource(&mem, step.operand);
+        step.input  = false;
+
+        if (step.source != SemanticsTemplate::OPERAND) {
+          this->recorder->valid = false;
+          return;
+        }
+
+        this->step = this->recorder->addExpression(step, node, comment);
+      }
+
+
+      void SemanticsRecorder::Scope::recordRegisterExpression(triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::REGISTER_EXPRESSION;
+        step.source = this->recorder->findSource(&reg, step.operand);
+        step.input  = false;
+        step.reg    = reg;
+
+        this->step = this->recorder->addExpression(step, node, comment);
+      }
+
+
+      void SemanticsRecorder::Scope::recordVolatileExpression(triton::ast::AbstractNode* node, const std::string& comment) {
+        SemanticsTemplate::Step step;
+
+        if (!this->outermost || !this->recorder->valid)
+          return;
+
+        step.kind   = SemanticsTemplate::VOLATILE_EXPRESSION;
+        step.source = SemanticsTemplate::STANDALONE;
+        step.input  = false;
+
+        this->step = this->recorder->addExpression(step, node, comment);
+      }
+
+
+      SymbolicExpression* SemanticsRecorder::Scope::setExpression(SymbolicExpression* expr) {
+        if (this->outermost && this->recorder->valid && expr != nullptr) {
+          this->recorder->expressionSteps[expr->getId()]  = this->step;
+          this->recorder->expressionAsts[expr->getAst()]  = this->step;
+        }
+        return expr;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
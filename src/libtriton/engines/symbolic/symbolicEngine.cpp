@@ -5,9 +5,12 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <new>
+#include <utility>
 
+#include <api.hpp>
 #include <exceptions.hpp>
 #include <coreUtils.hpp>
 #include <symbolicEngine.hpp>
@@ -85,6 +88,7 @@ namespace triton {
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
         this->callbacks       = callbacks;
+        this->recorder        = nullptr;
         this->backupFlag      = isBackup;
         this->enableFlag      = true;
         this->uniqueSymExprId = 0;
@@ -105,6 +109,7 @@ namespace triton {
          */
         this->arch                        = other.arch;
         this->callbacks                   = other.callbacks;
+        this->recorder                    = nullptr;
         this->backupFlag                  = true;
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->enableFlag                  = other.enableFlag;
@@ -118,6 +123,7 @@ namespace triton {
 
       SymbolicEngine::SymbolicEngine(const SymbolicEngine& copy)
         : triton::ast::AstDictionaries(copy),
+          triton::engines::symbolic::ConcretizationPolicy(copy),
           triton::engines::symbolic::SymbolicOptimization(copy),
           triton::engines::symbolic::SymbolicSimplification(copy),
           triton::engines::symbolic::PathManager(copy) {
@@ -127,6 +133,7 @@ namespace triton {
 
       void SymbolicEngine::operator=(const SymbolicEngine& other) {
         triton::ast::AstDictionaries::operator=(other);
+        triton::engines::symbolic::ConcretizationPolicy::operator=(other);
         triton::engines::symbolic::SymbolicOptimization::operator=(other);
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
@@ -168,6 +175,10 @@ namespace triton {
           /* Delete all symbolic variables */
           for (; it2 != this->symbolicVariables.end(); ++it2)
             delete it2->second;
+
+          /* Delete symbolic expressions kept alive by snapshots */
+          for (triton::usize i = 0; i < this->removedExpressions.size(); i++)
+            delete this->removedExpressions[i];
         }
 
         /* Delete all symbolic register */
@@ -187,6 +198,7 @@ namespace triton {
           return;
 
         this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
+        this->registerAges.erase(parentId);
       }
 
 
@@ -194,6 +206,7 @@ namespace triton {
       void SymbolicEngine::concretizeAllRegister(void) {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
+        this->registerAges.clear();
       }
 
 
@@ -217,7 +230,9 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
+        this->journalMemoryReference(addr);
         this->memoryReference.erase(addr);
+        this->memoryAges.erase(addr);
         if (this->isOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
           this->removeAlignedMemory(addr, BYTE_SIZE);
       }
@@ -225,11 +240,107 @@ namespace triton {
 
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
+        if (!this->snapshots.empty()) {
+          std::map<triton::uint64, triton::usize>::iterator it;
+          for (it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+            this->memoryReferenceJournal.push_back(*it);
+        }
         this->memoryReference.clear();
+        this->memoryAges.clear();
         this->alignedMemoryReference.clear();
       }
 
 
+      /* Applies the concretization policy on the registers and memory written by an instruction */
+      void SymbolicEngine::applyConcretizationPolicy(const triton::arch::Instruction& inst) {
+        triton::uint64 index = this->instructionIndex++;
+        triton::engines::symbolic::ConcretizationEvent event;
+
+        if (!this->isConcretizationPolicyEnabled())
+          return;
+
+        event.address = inst.getAddress();
+        event.index   = index;
+
+        /* Registers (flags included) */
+        const auto& regs = inst.getWrittenRegisters();
+        for (auto it = regs.begin(); it != regs.end(); it++) {
+          triton::uint32 parentId = it->first.getParent().getId();
+
+          if (!this->arch->isRegisterValid(parentId))
+            continue;
+
+          auto expr = this->symbolicExpressions.find(this->symbolicReg[parentId]);
+          if (expr == this->symbolicExpressions.end() || !expr->second->getAst()->isSymbolized()) {
+            this->registerAges.erase(parentId);
+            continue;
+          }
+
+          triton::ast::AbstractNode* node = expr->second->getAst();
+          triton::uint64 age = index - this->registerAges.insert(std::make_pair(parentId, index)).first->second;
+
+          if (!this->isLimitExceeded(node, age, event.reason))
+            continue;
+
+          event.kind   = triton::engines::symbolic::REG;
+          event.reg    = it->first.getParent();
+          event.mem    = triton::arch::MemoryAccess();
+          event.exprId = expr->first;
+          event.depth  = node->getDepth();
+          event.nodes  = node->getNumberOfNodes();
+          event.age    = age;
+          this->events.push_back(event);
+
+          this->concretizeRegister(it->first);
+        }
+
+        /* Memory, each byte holds its own reference */
+        const auto& stores = inst.getStoreAccess();
+        for (auto it = stores.begin(); it != stores.end(); it++) {
+          triton::uint64 addr             = it->first.getAddress();
+          triton::uint32 size             = it->first.getSize();
+          triton::ast::AbstractNode* node = nullptr;
+          triton::usize exprId            = triton::engines::symbolic::UNSET;
+          triton::uint64 age              = 0;
+
+          for (triton::uint32 i = 0; i < size; i++) {
+            auto ref = this->memoryReference.find(addr + i);
+            auto expr = (ref == this->memoryReference.end()) ? this->symbolicExpressions.end() : this->symbolicExpressions.find(ref->second);
+
+            if (expr == this->symbolicExpressions.end() || !expr->second->getAst()->isSymbolized()) {
+              this->memoryAges.erase(addr + i);
+              continue;
+            }
+
+            age = std::max(age, index - this->memoryAges.insert(std::make_pair(addr + i, index)).first->second);
+            if (node == nullptr) {
+              node   = expr->second->getAst();
+              exprId = expr->first;
+            }
+          }
+
+          if (node == nullptr)
+            continue;
+
+          if (this->isInConcretizationRange(addr, size))
+            event.reason = triton::engines::symbolic::ADDRESS_RANGE;
+          else if (!this->isLimitExceeded(node, age, event.reason))
+            continue;
+
+          event.kind   = triton::engines::symbolic::MEM;
+          event.reg    = triton::arch::Register();
+          event.mem    = it->first;
+          event.exprId = exprId;
+          event.depth  = node->getDepth();
+          event.nodes  = node->getNumberOfNodes();
+          event.age    = age;
+          this->events.push_back(event);
+
+          this->concretizeMemory(it->first);
+        }
+      }
+
+
       /* Gets an aligned entry. */
       triton::ast::AbstractNode* SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
         if (this->isAlignedMemory(address, size))
@@ -365,6 +476,12 @@ namespace triton {
       }
 
 
+      /* Reports the calls of the semantics handler to a recorder */
+      void SymbolicEngine::setSemanticsRecorder(SemanticsRecorder* recorder) {
+        this->recorder = recorder;
+      }
+
+
       /* Creates a new symbolic expression */
       /* Get an unique id.
        * Mainly used when a new symbolic expression is created */
@@ -385,21 +502,118 @@ namespace triton {
       SymbolicExpression* SymbolicEngine::newSymbolicExpression(triton::ast::AbstractNode* node, triton::engines::symbolic::symkind_e kind, const std::string& comment) {
         triton::usize id = this->getUniqueSymExprId();
         node = this->processSimplification(node);
+        if (this->isOptimizationEnabled(triton::engines::symbolic::CONSTANT_FOLDING))
+          node = this->foldConcreteSubtrees(node);
         SymbolicExpression* expr = new(std::nothrow) SymbolicExpression(node, id, kind, comment);
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
         this->symbolicExpressions[id] = expr;
+        TRITON_PROFILE_COUNT(triton::API::getCurrent().getProfiler().recordExpression());
         return expr;
       }
 
 
+      /* [private method] Returns true if the node is a bitvector term which may be replaced by a bv node */
+      bool SymbolicEngine::isFoldableAstNode(triton::ast::AbstractNode* node) const {
+        switch (node->getKind()) {
+          /* Boolean sorts */
+          case triton::ast::ASSERT_NODE:
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LNOT_NODE:
+          case triton::ast::LOR_NODE:
+          /* Not terms */
+          case triton::ast::BVDECL_NODE:
+          case triton::ast::COMPOUND_NODE:
+          case triton::ast::DECIMAL_NODE:
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::FUNCTION_NODE:
+          case triton::ast::PARAM_NODE:
+          case triton::ast::STRING_NODE:
+          case triton::ast::UNDEFINED_NODE:
+          /* Already a constant */
+          case triton::ast::BV_NODE:
+            return false;
+          default:
+            return (node->getBitvectorSize() != 0);
+        }
+      }
+
+
+      /* [private method] Replaces all non-symbolized subtrees by their concrete value */
+      triton::ast::AbstractNode* SymbolicEngine::foldConcreteSubtrees(triton::ast::AbstractNode* node) {
+        std::list<triton::ast::AbstractNode*> worklist;
+        std::set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> touched;
+
+        if (!node->isSymbolized()) {
+          if (this->isFoldableAstNode(node))
+            return triton::ast::bv(node->evaluate(), node->getBitvectorSize());
+          return node;
+        }
+
+        /*
+         * With AST_DICTIONARIES, nodes are indexed by their childs and must not be
+         * modified. While a snapshot is alive, old nodes (e.g. from ALIGNED_MEMORY)
+         * must not point to new nodes which are freed on restore. In both cases,
+         * only the root is folded.
+         */
+        if (this->isOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES) || !this->snapshots.empty())
+          return node;
+
+        /* Childs are replaced in place, the new bv nodes have the same value and size */
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.front();
+          bool folded = false;
+          worklist.pop_front();
+
+          if (visited.find(current) != visited.end())
+            continue;
+          visited.insert(current);
+
+          std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++) {
+            triton::ast::AbstractNode* child = childs[index];
+            if (child->isSymbolized())
+              worklist.push_back(child);
+            else if (this->isFoldableAstNode(child)) {
+              current->setChild(index, triton::ast::bv(child->evaluate(), child->getBitvectorSize()));
+              folded = true;
+            }
+          }
+
+          if (folded)
+            touched.push_back(current);
+        }
+
+        /* The depth and the number of nodes of the touched nodes and of their parents have changed */
+        for (auto it = touched.rbegin(); it != touched.rend(); it++)
+          (*it)->init();
+
+        return node;
+      }
+
+
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
         std::map<triton::uint64, triton::usize>::iterator it;
 
         if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
-          /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
+          /* Delete and remove the pointer. Keep it alive if a snapshot refers to it. */
+          if (!this->snapshots.empty() && symExprId < this->snapshots.back().uniqueSymExprId)
+            this->removedExpressions.push_back(this->symbolicExpressions[symExprId]);
+          else
+            delete this->symbolicExpressions[symExprId];
           this->symbolicExpressions.erase(symExprId);
 
           /* Concretize the register if it exists */
@@ -463,33 +677,36 @@ namespace triton {
       }
 
 
-      /* [private method] Slices all expressions from a given node */
-      void SymbolicEngine::sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
-
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            if (exprs.find(id) == exprs.end()) {
-              SymbolicExpression* expr = this->getSymbolicExpressionFromId(id);
-              exprs[id] = expr;
-              this->sliceExpressions(expr->getAst(), exprs);
-            }
-          }
-          this->sliceExpressions(childs[index], exprs);
-        }
-      }
-
-
       /* Slices all expressions from a given one */
-      std::map<triton::usize, SymbolicExpression*> SymbolicEngine::sliceExpressions(SymbolicExpression* expr) {
+      std::map<triton::usize, SymbolicExpression*> SymbolicEngine::sliceExpressions(SymbolicExpression* expr, triton::usize depth) {
         std::map<triton::usize, SymbolicExpression*> exprs;
+        std::vector<SymbolicExpression*> current;
+        std::vector<SymbolicExpression*> next;
 
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
 
         exprs[expr->getId()] = expr;
-        this->sliceExpressions(expr->getAst(), exprs);
+        current.push_back(expr);
+
+        /* Breadth-first walk over the dependency graph, one level per iteration */
+        for (triton::usize level = 0; level < depth && !current.empty(); level++) {
+          for (triton::usize i = 0; i < current.size(); i++) {
+            const std::vector<triton::usize>& deps = current[i]->getDependencies();
+            for (triton::usize j = 0; j < deps.size(); j++) {
+              if (exprs.find(deps[j]) != exprs.end())
+                continue;
+              /* The expression may have been removed (e.g. ONLY_ON_SYMBOLIZED) */
+              std::map<triton::usize, SymbolicExpression*>::const_iterator it = this->symbolicExpressions.find(deps[j]);
+              if (it == this->symbolicExpressions.end())
+                continue;
+              exprs[deps[j]] = it->second;
+              next.push_back(it->second);
+            }
+          }
+          current.swap(next);
+          next.clear();
+        }
 
         return exprs;
       }
@@ -508,6 +725,25 @@ namespace triton {
       }
 
 
+      /* Returns the list of the symbolic variables a node depends on */
+      std::list<SymbolicVariable*> SymbolicEngine::getSymbolicVariablesFromAst(triton::ast::AbstractNode* node) const {
+        std::list<SymbolicVariable*> symVars;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariablesFromAst(): node cannot be null.");
+
+        const std::vector<triton::usize>& ids = node->getSymbolicVariableIds();
+        for (triton::usize i = 0; i < ids.size(); i++) {
+          /* The variable may have been dropped by a snapshot restore */
+          SymbolicVariable* symVar = this->getSymbolicVariableFromId(ids[i]);
+          if (symVar != nullptr)
+            symVars.push_back(symVar);
+        }
+
+        return symVars;
+      }
+
+
       /* Returns the list of the symbolic variables declared in the trace */
       std::string SymbolicEngine::getVariablesDeclaration(void) const {
         std::map<triton::usize, SymbolicVariable*>::const_iterator it;
@@ -565,6 +801,7 @@ namespace triton {
 
         tmp = triton::ast::variable(*symVar);
         tmp->setParent(expression->getAst()->getParents());
+        this->journalAst(expression);
         expression->setAst(tmp);
         tmp->init();
 
@@ -606,6 +843,7 @@ namespace triton {
           else {
             se = this->getSymbolicExpressionFromId(memSymId);
             tmp->setParent(se->getAst()->getParents());
+            this->journalAst(se);
             se->setAst(tmp);
             tmp->init();
             se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
@@ -657,6 +895,7 @@ namespace triton {
           triton::ast::AbstractNode* tmp = triton::ast::variable(*symVar);
           /* Set the AST node */
           tmp->setParent(expression->getAst()->getParents());
+          this->journalAst(expression);
           expression->setAst(tmp);
           tmp->init();
         }
@@ -674,6 +913,7 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
         this->symbolicVariables[uniqueId] = symVar;
+        TRITON_PROFILE_COUNT(triton::API::getCurrent().getProfiler().recordVariable());
         return symVar;
       }
 
@@ -704,21 +944,26 @@ namespace triton {
 
       /* Returns a symbolic immediate */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
+        SemanticsRecorder::Scope scope(this->recorder);
         triton::ast::AbstractNode* node = triton::ast::bv(imm.getValue(), imm.getBitSize());
+        scope.recordImmediate(imm, node, false);
         return node;
       }
 
 
       /* Returns a symbolic immediate and defines the immediate as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicImmediate(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+        SemanticsRecorder::Scope scope(this->recorder);
         triton::ast::AbstractNode* node = this->buildSymbolicImmediate(imm);
         inst.setReadImmediate(imm, node);
+        scope.recordImmediate(imm, node, true);
         return node;
       }
 
 
       /* Returns a symbolic memory */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
+        SemanticsRecorder::Scope scope(this->recorder);
         std::list<triton::ast::AbstractNode*> opVec;
 
         triton::ast::AbstractNode* tmp            = nullptr;
@@ -734,8 +979,11 @@ namespace triton {
          * Symbolic optimization
          * If the memory access is aligned, don't split the memory.
          */
-        if (this->isOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
-          return this->getAlignedMemory(address, size);
+        if (this->isOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY) && this->isAlignedMemory(address, size)) {
+          tmp = this->getAlignedMemory(address, size);
+          scope.recordMemory(mem, tmp, false);
+          return tmp;
+        }
 
         /* Iterate on every memory cells to use their symbolic or concrete values */
         while (size) {
@@ -768,21 +1016,25 @@ namespace triton {
             break;
         }
 
+        scope.recordMemory(mem, tmp, false);
         return tmp;
       }
 
 
       /* Returns a symbolic memory and defines the memory as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+        SemanticsRecorder::Scope scope(this->recorder);
         triton::ast::AbstractNode* node = this->buildSymbolicMemory(mem);
         mem.setConcreteValue(node->evaluate());
         inst.setLoadAccess(mem, node);
+        scope.recordMemory(mem, node, true);
         return node;
       }
 
 
       /* Returns a symbolic register */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicRegister(const triton::arch::Register& reg) {
+        SemanticsRecorder::Scope scope(this->recorder);
         triton::ast::AbstractNode* op = nullptr;
         triton::usize symReg          = this->getSymbolicRegisterId(reg);
         triton::uint32 bvSize         = reg.getBitSize();
@@ -797,15 +1049,18 @@ namespace triton {
         else
           op = triton::ast::bv(this->arch->getConcreteRegisterValue(reg), bvSize);
 
+        scope.recordRegister(reg, op, false);
         return op;
       }
 
 
       /* Returns a symbolic register and defines the register as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+        SemanticsRecorder::Scope scope(this->recorder);
         triton::ast::AbstractNode* node = this->buildSymbolicRegister(reg);
         reg.setConcreteValue(node->evaluate());
         inst.setReadRegister(reg, node);
+        scope.recordRegister(reg, node, true);
         return node;
       }
 
@@ -831,6 +1086,9 @@ namespace triton {
         triton::uint64 address   = mem.getAddress();
         triton::uint32 writeSize = mem.getSize();
 
+        SemanticsRecorder::Scope scope(this->recorder);
+        scope.recordMemoryExpression(node, mem, comment);
+
         /* Record the aligned memory for a symbolic optimization */
         if (this->isOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
@@ -860,7 +1118,7 @@ namespace triton {
           this->arch->setConcreteMemoryValue(mem);
           /* Define the memory store */
           inst.setStoreAccess(mem, tmp);
-          return se;
+          return scope.setExpression(se);
         }
 
         /* Otherwise, we return the concatenation of all symbolic expressions */
@@ -878,7 +1136,7 @@ namespace triton {
         /* Define the memory store */
         inst.setStoreAccess(mem, tmp);
         inst.addSymbolicExpression(se);
-        return se;
+        return scope.setExpression(se);
       }
 
 
@@ -892,6 +1150,9 @@ namespace triton {
         if (reg.isFlag())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicRegisterExpression(): The register cannot be a flag.");
 
+        SemanticsRecorder::Scope scope(this->recorder);
+        scope.recordRegisterExpression(node, reg, comment);
+
         if (regSize == BYTE_SIZE || regSize == WORD_SIZE)
           origReg = this->buildSymbolicRegister(parentReg);
 
@@ -934,7 +1195,7 @@ namespace triton {
         inst.addSymbolicExpression(se);
         inst.setWrittenRegister(reg, node);
 
-        return se;
+        return scope.setExpression(se);
       }
 
 
@@ -943,26 +1204,32 @@ namespace triton {
         if (!flag.isFlag())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicFlagExpression(): The register must be a flag.");
 
+        SemanticsRecorder::Scope scope(this->recorder);
+        scope.recordFlagExpression(node, flag, comment);
+
         flag.setConcreteValue(node->evaluate());
         triton::engines::symbolic::SymbolicExpression *se = this->newSymbolicExpression(node, triton::engines::symbolic::REG, comment);
         this->assignSymbolicExpressionToRegister(se, flag);
         inst.addSymbolicExpression(se);
         inst.setWrittenRegister(flag, node);
 
-        return se;
+        return scope.setExpression(se);
       }
 
 
       /* Returns the new symbolic volatile expression */
       SymbolicExpression* SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment) {
+        SemanticsRecorder::Scope scope(this->recorder);
+        scope.recordVolatileExpression(node, comment);
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
         inst.addSymbolicExpression(se);
-        return se;
+        return scope.setExpression(se);
       }
 
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id) {
+        this->journalMemoryReference(mem);
         this->memoryReference[mem] = id;
       }
 
@@ -1083,6 +1350,118 @@ namespace triton {
         this->enableFlag = flag;
       }
 
+
+      void SymbolicEngine::journalMemoryReference(triton::uint64 addr) {
+        if (!this->snapshots.empty())
+          this->memoryReferenceJournal.push_back(std::make_pair(addr, this->getSymbolicMemoryId(addr)));
+      }
+
+
+      void SymbolicEngine::journalAst(SymbolicExpression* expr) {
+        if (!this->snapshots.empty())
+          this->astJournal.push_back(std::make_pair(expr->getId(), expr->getAst()));
+      }
+
+
+      void SymbolicEngine::takeSnapshot(void) {
+        SymbolicSnapshot snapshot;
+
+        snapshot.symbolicReg.assign(this->symbolicReg, this->symbolicReg + this->numberOfRegisters);
+        snapshot.uniqueSymExprId            = this->uniqueSymExprId;
+        snapshot.uniqueSymVarId             = this->uniqueSymVarId;
+        snapshot.numberOfPathConstraints    = this->pathConstraints.size();
+        snapshot.pathConstraintsJournalSize = this->pathConstraintsJournal.size();
+        snapshot.memoryReferenceJournalSize = this->memoryReferenceJournal.size();
+        snapshot.astJournalSize             = this->astJournal.size();
+        snapshot.removedExpressionsSize     = this->removedExpressions.size();
+
+        this->snapshots.push_back(snapshot);
+        this->pathConstraintsJournaling = true;
+      }
+
+
+      void SymbolicEngine::restoreSnapshot(triton::usize index) {
+        if (index >= this->snapshots.size())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::restoreSnapshot(): Invalid snapshot index.");
+
+        const SymbolicSnapshot& snapshot = this->snapshots[index];
+
+        /* Re-insert removed expressions */
+        while (this->removedExpressions.size() > snapshot.removedExpressionsSize) {
+          SymbolicExpression* expr = this->removedExpressions.back();
+          this->symbolicExpressions[expr->getId()] = expr;
+          this->removedExpressions.pop_back();
+        }
+
+        /* Unwind the AST journal */
+        while (this->astJournal.size() > snapshot.astJournalSize) {
+          const std::pair<triton::usize, triton::ast::AbstractNode*>& entry = this->astJournal.back();
+          std::map<triton::usize, SymbolicExpression*>::iterator it = this->symbolicExpressions.find(entry.first);
+          if (it != this->symbolicExpressions.end())
+            it->second->setAst(entry.second);
+          this->astJournal.pop_back();
+        }
+
+        /* Unwind the memory reference journal */
+        while (this->memoryReferenceJournal.size() > snapshot.memoryReferenceJournalSize) {
+          const std::pair<triton::uint64, triton::usize>& entry = this->memoryReferenceJournal.back();
+          if (entry.second == triton::engines::symbolic::UNSET)
+            this->memoryReference.erase(entry.first);
+          else
+            this->memoryReference[entry.first] = entry.second;
+          this->memoryReferenceJournal.pop_back();
+        }
+
+        /* Unwind the path constraints */
+        while (this->pathConstraintsJournal.size() > snapshot.pathConstraintsJournalSize) {
+          this->pathConstraints = std::move(this->pathConstraintsJournal.back());
+          this->pathConstraintsJournal.pop_back();
+        }
+        this->pathConstraints.resize(snapshot.numberOfPathConstraints);
+
+        /* Delete symbolic expressions created after the snapshot */
+        std::map<triton::usize, SymbolicExpression*>::iterator it1 = this->symbolicExpressions.lower_bound(snapshot.uniqueSymExprId);
+        for (std::map<triton::usize, SymbolicExpression*>::iterator it = it1; it != this->symbolicExpressions.end(); it++)
+          delete it->second;
+        this->symbolicExpressions.erase(it1, this->symbolicExpressions.end());
+
+        /* Delete symbolic variables created after the snapshot */
+        std::map<triton::usize, SymbolicVariable*>::iterator it2 = this->symbolicVariables.lower_bound(snapshot.uniqueSymVarId);
+        for (std::map<triton::usize, SymbolicVariable*>::iterator it = it2; it != this->symbolicVariables.end(); it++)
+          delete it->second;
+        this->symbolicVariables.erase(it2, this->symbolicVariables.end());
+
+        /*
+         * Restore the register state. Note that unique ids are not rewound,
+         * thus ids are never reused (AST dictionaries may still hold nodes
+         * which refer to them).
+         */
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
+          this->symbolicReg[i] = snapshot.symbolicReg[i];
+
+        /* The aligned memory is only a cache, it will be rebuilt on demand */
+        this->alignedMemoryReference.clear();
+
+        this->snapshots.resize(index + 1);
+      }
+
+
+      void SymbolicEngine::discardSnapshots(triton::usize index) {
+        if (index >= this->snapshots.size())
+          return;
+
+        this->snapshots.resize(index);
+        if (this->snapshots.empty()) {
+          for (triton::usize i = 0; i < this->removedExpressions.size(); i++)
+            delete this->removedExpressions[i];
+          this->removedExpressions.clear();
+          this->memoryReferenceJournal.clear();
+          this->astJournal.clear();
+          this->pathConstraintsJournal.clear();
+          this->pathConstraintsJournaling = false;
+        }
+      }
+
     }; /* symbolic namespace */
   }; /* engines namespace */
 }; /*triton namespace */
@@ -5,6 +5,10 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <set>
+
+#include <api.hpp>
 #include <exceptions.hpp>
 #include <astRepresentation.hpp>
 #include <symbolicExpression.hpp>
@@ -21,6 +25,7 @@ namespace triton {
         this->id            = id;
         this->isTainted     = false;
         this->kind          = kind;
+        this->initDependencies();
       }
 
 
@@ -53,10 +58,10 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        if (triton::API::getCurrent().getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (triton::API::getCurrent().getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "ref_" + std::to_string(this->id);
 
         else
@@ -68,10 +73,10 @@ namespace triton {
         if (this->getComment().empty())
           return "";
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (triton::API::getCurrent().getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
           return "; " + this->getComment();
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (triton::API::getCurrent().getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "# " + this->getComment();
 
         else
@@ -94,10 +99,52 @@ namespace triton {
       }
 
 
+      const std::vector<triton::usize>& SymbolicExpression::getDependencies(void) const {
+        return this->dependencies;
+      }
+
+
+      const std::vector<triton::usize>& SymbolicExpression::getSymbolicVariableIds(void) const {
+        return this->getAst()->getSymbolicVariableIds();
+      }
+
+
+      void SymbolicExpression::initDependencies(void) {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::set<triton::ast::AbstractNode*> visited;
+
+        this->dependencies.clear();
+        if (this->ast == nullptr)
+          return;
+
+        /* References are leaves, the walk never goes through other expressions */
+        worklist.push_back(this->ast);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(node).second == false)
+            continue;
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            this->dependencies.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+            continue;
+          }
+
+          std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+          worklist.insert(worklist.end(), childs.begin(), childs.end());
+        }
+
+        std::sort(this->dependencies.begin(), this->dependencies.end());
+        this->dependencies.erase(std::unique(this->dependencies.begin(), this->dependencies.end()), this->dependencies.end());
+      }
+
+
       void SymbolicExpression::setAst(triton::ast::AbstractNode* node) {
         node->setParent(this->ast->getParents());
         this->ast = node;
         this->ast->init();
+        this->initDependencies();
       }
 
 
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <api.hpp>
 #include <exceptions.hpp>
 #include <symbolicSimplification.hpp>
 
@@ -180,6 +181,8 @@ namespace triton {
 
 
       triton::ast::AbstractNode* SymbolicSimplification::processSimplification(triton::ast::AbstractNode* node) const {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_SIMPLIFICATION);
+
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processSimplification(): node cannot be null.");
 
@@ -91,7 +91,7 @@ namespace triton {
 
 
       void SymbolicVariable::setConcreteValue(triton::uint512 value) {
-        triton::ast::AbstractNode* node = triton::api.getAstVariableNode(this->getName());
+        triton::ast::AbstractNode* node = triton::API::getCurrent().getAstVariableNode(this->getName());
 
         this->concreteValue = value;
         if (node)
@@ -0,0 +1,281 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <new>
+
+#include <exceptions.hpp>
+#include <taintBitmap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the mask of the bits [lo:hi[ of a bitmap word */
+      static inline triton::uint64 bitRange(triton::uint32 lo, triton::uint32 hi) {
+        triton::uint64 upper = (hi == 64) ? static_cast<triton::uint64>(-1) : ((1ULL << hi) - 1);
+        return upper & ~((1ULL << lo) - 1);
+      }
+
+
+      /* Returns the number of bits set in a bitmap word */
+      static inline triton::uint32 bitCount(triton::uint64 word) {
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<triton::uint32>((word * 0x0101010101010101ULL) >> 56);
+      }
+
+
+      TaintBitmap::TaintBitmap() {
+        this->count      = 0;
+        this->lastNumber = 0;
+        this->lastPage   = nullptr;
+      }
+
+
+      TaintBitmap::TaintBitmap(const TaintBitmap& other) {
+        this->count      = 0;
+        this->lastNumber = 0;
+        this->lastPage   = nullptr;
+        *this = other;
+      }
+
+
+      TaintBitmap::~TaintBitmap() {
+        this->clear();
+      }
+
+
+      TaintBitmap& TaintBitmap::operator=(const TaintBitmap& other) {
+        if (this == &other)
+          return *this;
+
+        this->clear();
+        for (auto it = other.pages.begin(); it != other.pages.end(); it++) {
+          Page* page = new(std::nothrow) Page(*it->second);
+          if (page == nullptr)
+            throw triton::exceptions::TaintEngine("TaintBitmap::operator=(): Not enough memory.");
+          this->pages[it->first] = page;
+        }
+        this->count = other.count;
+
+        return *this;
+      }
+
+
+      void TaintBitmap::clear(void) {
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+          delete it->second;
+        this->pages.clear();
+        this->count    = 0;
+        this->lastPage = nullptr;
+      }
+
+
+      bool TaintBitmap::empty(void) const {
+        return (this->count == 0);
+      }
+
+
+      triton::usize TaintBitmap::size(void) const {
+        return this->count;
+      }
+
+
+      TaintBitmap::Page* TaintBitmap::findPage(triton::uint64 addr) const {
+        triton::uint64 number = (addr >> PAGE_SHIFT);
+
+        if (this->lastPage != nullptr && this->lastNumber == number)
+          return this->lastPage;
+
+        auto it = this->pages.find(number);
+        if (it == this->pages.end())
+          return nullptr;
+
+        this->lastNumber = number;
+        this->lastPage   = it->second;
+
+        return it->second;
+      }
+
+
+      TaintBitmap::Page* TaintBitmap::getPage(triton::uint64 addr) {
+        Page* page = this->findPage(addr);
+
+        if (page == nullptr) {
+          page = new(std::nothrow) Page();
+          if (page == nullptr)
+            throw triton::exceptions::TaintEngine("TaintBitmap::getPage(): Not enough memory.");
+          this->pages[addr >> PAGE_SHIFT] = page;
+          this->lastNumber = (addr >> PAGE_SHIFT);
+          this->lastPage   = page;
+        }
+
+        return page;
+      }
+
+
+      void TaintBitmap::freePage(triton::uint64 number) {
+        auto it = this->pages.find(number);
+
+        if (it == this->pages.end())
+          return;
+
+        if (this->lastPage == it->second)
+          this->lastPage = nullptr;
+
+        delete it->second;
+        this->pages.erase(it);
+      }
+
+
+      bool TaintBitmap::isSet(triton::uint64 addr) const {
+        const Page* page      = this->findPage(addr);
+        triton::uint64 offset = (addr & (PAGE_SIZE - 1));
+
+        if (page == nullptr)
+          return false;
+
+        return ((page->bits[offset / 64] >> (offset % 64)) & 1);
+      }
+
+
+      bool TaintBitmap::isAnySet(triton::uint64 baseAddr, triton::usize size) const {
+        if (this->count == 0)
+          return false;
+
+        while (size) {
+          triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+          const Page* page      = this->findPage(baseAddr);
+
+          if (page != nullptr) {
+            for (triton::uint32 bit = offset; bit < offset + chunk;) {
+              triton::uint32 word = bit / 64;
+              triton::uint32 end  = std::min<triton::uint32>(offset + chunk, (word + 1) * 64);
+              if (page->bits[word] & bitRange(bit % 64, end - word * 64))
+                return true;
+              bit = end;
+            }
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+
+        return false;
+      }
+
+
+      void TaintBitmap::set(triton::uint64 baseAddr, triton::usize size) {
+        while (size) {
+          triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+          Page* page            = this->getPage(baseAddr);
+
+          for (triton::uint32 bit = offset; bit < offset + chunk;) {
+            triton::uint32 word  = bit / 64;
+            triton::uint32 end   = std::min<triton::uint32>(offset + chunk, (word + 1) * 64);
+            triton::uint64 mask  = bitRange(bit % 64, end - word * 64);
+            triton::uint32 added = bitCount(mask & ~page->bits[word]);
+            page->bits[word] |= mask;
+            page->count      += added;
+            this->count      += added;
+            bit = end;
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      void TaintBitmap::unset(triton::uint64 baseAddr, triton::usize size) {
+        while (size && this->count) {
+          triton::uint64 offset = (baseAddr & (PAGE_SIZE - 1));
+          triton::usize chunk   = static_cast<triton::usize>(std::min<triton::uint64>(size, PAGE_SIZE - offset));
+          Page* page            = this->findPage(baseAddr);
+
+          if (page != nullptr) {
+            for (triton::uint32 bit = offset; bit < offset + chunk;) {
+              triton::uint32 word    = bit / 64;
+              triton::uint32 end     = std::min<triton::uint32>(offset + chunk, (word + 1) * 64);
+              triton::uint64 mask    = bitRange(bit % 64, end - word * 64);
+              triton::uint32 removed = bitCount(mask & page->bits[word]);
+              page->bits[word] &= ~mask;
+              page->count      -= removed;
+              this->count      -= removed;
+              bit = end;
+            }
+
+            if (page->count == 0)
+              this->freePage(baseAddr >> PAGE_SHIFT);
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintBitmap::getAreas(void) const {
+        std::vector<std::pair<triton::uint64, triton::usize>> areas;
+        std::vector<triton::uint64> numbers;
+
+        /* Extends the last area if the bytes are contiguous */
+        auto append = [&areas](triton::uint64 addr, triton::usize size) {
+          if (!areas.empty() && areas.back().first + areas.back().second == addr)
+            areas.back().second += size;
+          else
+            areas.push_back(std::make_pair(addr, size));
+        };
+
+        numbers.reserve(this->pages.size());
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+          numbers.push_back(it->first);
+        std::sort(numbers.begin(), numbers.end());
+
+        for (auto number = numbers.begin(); number != numbers.end(); number++) {
+          const Page* page = this->pages.find(*number)->second;
+
+          for (triton::uint32 word = 0; word < PAGE_WORDS; word++) {
+            triton::uint64 bits = page->bits[word];
+            triton::uint64 addr = ((*number) << PAGE_SHIFT) + word * 64;
+
+            if (bits == static_cast<triton::uint64>(-1)) {
+              append(addr, 64);
+              continue;
+            }
+
+            for (triton::uint32 bit = 0; bits; bit++, bits >>= 1) {
+              if (bits & 1)
+                append(addr + bit, 1);
+            }
+          }
+        }
+
+        return areas;
+      }
+
+
+      std::set<triton::uint64> TaintBitmap::getAddresses(void) const {
+        std::set<triton::uint64> addresses;
+
+        for (const auto& area : this->getAreas()) {
+          for (triton::usize index = 0; index < area.second; index++)
+            addresses.insert(addresses.end(), area.first + index);
+        }
+
+        return addresses;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <api.hpp>
 #include <exceptions.hpp>
 #include <taintEngine.hpp>
 
@@ -81,6 +82,15 @@ That's why Triton uses **symbolic execution for precision** and an over-approxim
 tainting to know if we can ask a model to the SMT solver - Asking a model means that
 the symbolic variables are controllable by the user input.
 
+\section engine_Taint_labels Taint Labels
+<hr>
+
+The taint is binary by default. Labelling an input (`labelMemory()`, `labelRegister()`) taints it and
+switches the engine into a labelled mode where each tainted byte and register also holds a label set
+id. The sets are stored once in a TaintLabels table and their unions are memoized, so spreading the
+labels costs a lookup per operand. One run then answers which inputs reach each location, which would
+otherwise take one binary run per input. The binary taint, and so `Instruction::isTainted`, is unchanged.
+
 */
 
 
@@ -95,6 +105,7 @@ namespace triton {
 
         this->symbolicEngine = symbolicEngine;
         this->enableFlag     = true;
+        this->labelled       = false;
       }
 
 
@@ -103,6 +114,10 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+        this->labelled         = other.labelled;
+        this->memoryLabels     = other.memoryLabels;
+        this->registerLabels   = other.registerLabels;
       }
 
 
@@ -131,8 +146,19 @@ namespace triton {
 
 
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.getAddresses();
+      }
+
+
+      /* Returns the tainted memory areas */
+      std::vector<std::pair<triton::uint64, triton::usize>> TaintEngine::getTaintedMemoryAreas(void) const {
+        return this->taintedMemory.getAreas();
+      }
+
+
+      bool TaintEngine::hasTaintedMemory(void) const {
+        return !this->taintedMemory.empty();
       }
 
 
@@ -142,28 +168,105 @@ namespace triton {
       }
 
 
-      /* Returns true of false if the memory address is currently tainted */
-      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+      triton::uint32 TaintEngine::getMemoryLabelSet(triton::uint64 addr, triton::usize size) const {
+        triton::uint32 id = NO_LABELS;
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
+        if (this->memoryLabels.empty())
+          return NO_LABELS;
+
+        for (triton::usize index = 0; index < size; index++) {
+          auto it = this->memoryLabels.find(addr + index);
+          if (it != this->memoryLabels.end())
+            id = this->labels.unite(id, it->second);
         }
 
-        return !TAINTED;
+        return id;
       }
 
 
-      /* Returns true of false if the address is currently tainted */
-      bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
+      triton::uint32 TaintEngine::getRegisterLabelSet(const triton::arch::Register& reg) const {
+        auto it = this->registerLabels.find(reg.getParent().getId());
+
+        if (it == this->registerLabels.end())
+          return NO_LABELS;
+
+        return it->second;
+      }
+
+
+      void TaintEngine::setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 id) {
+        for (triton::usize index = 0; index < size; index++) {
+          auto it = this->memoryLabels.find(addr + index);
+          triton::uint32 previous = (it == this->memoryLabels.end()) ? NO_LABELS : it->second;
+
+          if (previous == id)
+            continue;
+
+          /* Only the addresses which change are journaled */
+          if (!this->snapshots.empty())
+            this->labelJournal.push_back(std::make_pair(addr + index, previous));
+
+          if (id == NO_LABELS)
+            this->memoryLabels.erase(it);
+          else
+            this->memoryLabels[addr + index] = id;
         }
+      }
 
-        return !TAINTED;
+
+      void TaintEngine::uniteMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 id) {
+        if (id == NO_LABELS)
+          return;
+
+        for (triton::usize index = 0; index < size; index++)
+          this->setMemoryLabelSet(addr + index, 1, this->labels.unite(this->getMemoryLabelSet(addr + index), id));
+      }
+
+
+      void TaintEngine::setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 id) {
+        if (id == NO_LABELS)
+          this->registerLabels.erase(reg.getParent().getId());
+        else
+          this->registerLabels[reg.getParent().getId()] = id;
+      }
+
+
+      void TaintEngine::uniteRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 id) {
+        if (id == NO_LABELS)
+          return;
+        this->setRegisterLabelSet(reg, this->labels.unite(this->getRegisterLabelSet(reg), id));
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getMemoryLabels(triton::uint64 addr) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(addr));
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getMemoryLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(mem.getAddress(), mem.getSize()));
+      }
+
+
+      std::vector<triton::uint32> TaintEngine::getRegisterLabels(const triton::arch::Register& reg) const {
+        return this->labels.getLabels(this->getRegisterLabelSet(reg));
+      }
+
+
+      bool TaintEngine::isLabelled(void) const {
+        return this->labelled;
+      }
+
+
+      /* Returns true of false if the memory address is currently tainted */
+      bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
+        return this->taintedMemory.isAnySet(mem.getAddress(), mem.getSize());
+      }
+
+
+      /* Returns true of false if the address is currently tainted */
+      bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
+        return this->taintedMemory.isAnySet(addr, size);
       }
 
 
@@ -210,6 +313,9 @@ namespace triton {
           return this->isRegisterTainted(parent);
         this->taintedRegisters.erase(parent);
 
+        if (this->labelled)
+          this->setRegisterLabelSet(parent, NO_LABELS);
+
         return !TAINTED;
       }
 
@@ -228,6 +334,8 @@ namespace triton {
 
       /* Sets the flag (taint or untaint) to a memory. */
       bool TaintEngine::setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag) {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_TAINT);
+
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
@@ -243,6 +351,8 @@ namespace triton {
 
       /* Sets the flag (taint or untaint) to a register. */
       bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag) {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_TAINT);
+
         triton::arch::Register parent = reg.getParent();
 
         if (!this->isEnabled())
@@ -258,6 +368,33 @@ namespace triton {
       }
 
 
+      void TaintEngine::insertTaintedMemory(triton::uint64 addr, triton::usize size) {
+        /* Only the addresses which change are journaled */
+        if (!this->snapshots.empty()) {
+          for (triton::usize index = 0; index < size; index++) {
+            if (!this->taintedMemory.isSet(addr + index))
+              this->memoryJournal.push_back(std::make_pair(addr + index, !TAINTED));
+          }
+        }
+        this->taintedMemory.set(addr, size);
+      }
+
+
+      void TaintEngine::eraseTaintedMemory(triton::uint64 addr, triton::usize size) {
+        /* Only the addresses which change are journaled */
+        if (!this->snapshots.empty()) {
+          for (triton::usize index = 0; index < size; index++) {
+            if (this->taintedMemory.isSet(addr + index))
+              this->memoryJournal.push_back(std::make_pair(addr + index, TAINTED));
+          }
+        }
+        this->taintedMemory.unset(addr, size);
+
+        if (this->labelled)
+          this->setMemoryLabelSet(addr, size, NO_LABELS);
+      }
+
+
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
         triton::uint64 addr = mem.getAddress();
@@ -266,8 +403,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->insertTaintedMemory(addr, size);
 
         return TAINTED;
       }
@@ -277,7 +413,48 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->insertTaintedMemory(addr);
+        return TAINTED;
+      }
+
+
+      /* Taint the memory and add a label */
+      bool TaintEngine::labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+
+        this->labelled = true;
+        this->insertTaintedMemory(mem.getAddress(), mem.getSize());
+        this->uniteMemoryLabelSet(mem.getAddress(), mem.getSize(), this->labels.getLabelSet(label));
+
+        return TAINTED;
+      }
+
+
+      /* Taint the address and add a label */
+      bool TaintEngine::labelMemory(triton::uint64 addr, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(addr);
+
+        this->labelled = true;
+        this->insertTaintedMemory(addr);
+        this->uniteMemoryLabelSet(addr, 1, this->labels.getLabelSet(label));
+
+        return TAINTED;
+      }
+
+
+      /* Taint the register and add a label */
+      bool TaintEngine::labelRegister(const triton::arch::Register& reg, triton::uint32 label) {
+        triton::arch::Register parent = reg.getParent();
+
+        if (!this->isEnabled())
+          return this->isRegisterTainted(parent);
+
+        this->labelled = true;
+        this->taintedRegisters.insert(parent);
+        this->uniteRegisterLabelSet(parent, this->labels.getLabelSet(label));
+
         return TAINTED;
       }
 
@@ -290,8 +467,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+        this->eraseTaintedMemory(addr, size);
 
         return !TAINTED;
       }
@@ -301,13 +477,15 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->eraseTaintedMemory(addr);
         return !TAINTED;
       }
 
 
       /* Abstract union tainting */
       bool TaintEngine::taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_TAINT);
+
         triton::uint32 t1 = op1.getType();
         triton::uint32 t2 = op2.getType();
 
@@ -335,6 +513,8 @@ namespace triton {
 
       /* Abstract assignment tainting */
       bool TaintEngine::taintAssignment(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+        TRITON_PROFILE_STAGE(triton::API::getCurrent().getProfiler(), triton::engines::profiling::STAGE_TAINT);
+
         triton::uint32 t1 = op1.getType();
         triton::uint32 t2 = op2.getType();
 
@@ -361,63 +541,17 @@ namespace triton {
 
 
       bool TaintEngine::taintUnionMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->unionMemoryImmediate(memDst);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          triton::usize byteId = this->symbolicEngine->getSymbolicMemoryId(memAddrDst + i);
-          if (byteId == triton::engines::symbolic::UNSET)
-            continue;
-          triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
-        }
-
-        return flag;
+        return this->unionMemoryImmediate(memDst);
       }
 
 
       bool TaintEngine::taintUnionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint64 memAddrSrc = memSrc.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->unionMemoryMemory(memDst, memSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          triton::usize byteId = this->symbolicEngine->getSymbolicMemoryId(memAddrDst + i);
-          if (byteId == triton::engines::symbolic::UNSET)
-            continue;
-          triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
-        }
-
-        return flag;
+        return this->unionMemoryMemory(memDst, memSrc);
       }
 
 
       bool TaintEngine::taintUnionMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->unionMemoryRegister(memDst, regSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          triton::usize byteId = this->symbolicEngine->getSymbolicMemoryId(memAddrDst + i);
-          if (byteId == triton::engines::symbolic::UNSET)
-            continue;
-          triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
-        }
-
-        return flag;
+        return this->unionMemoryRegister(memDst, regSrc);
       }
 
 
@@ -437,63 +571,17 @@ namespace triton {
 
 
       bool TaintEngine::taintAssignmentMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->assignmentMemoryImmediate(memDst);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          triton::usize byteId = this->symbolicEngine->getSymbolicMemoryId(memAddrDst + i);
-          if (byteId == triton::engines::symbolic::UNSET)
-            continue;
-          triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
-        }
-
-        return flag;
+        return this->assignmentMemoryImmediate(memDst);
       }
 
 
       bool TaintEngine::taintAssignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint64 memAddrSrc = memSrc.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->assignmentMemoryMemory(memDst, memSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          triton::usize byteId = this->symbolicEngine->getSymbolicMemoryId(memAddrDst + i);
-          if (byteId == triton::engines::symbolic::UNSET)
-            continue;
-          triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
-        }
-
-        return flag;
+        return this->assignmentMemoryMemory(memDst, memSrc);
       }
 
 
       bool TaintEngine::taintAssignmentMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->assignmentMemoryRegister(memDst, regSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          triton::usize byteId = this->symbolicEngine->getSymbolicMemoryId(memAddrDst + i);
-          if (byteId == triton::engines::symbolic::UNSET)
-            continue;
-          triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
-        }
-
-        return flag;
+        return this->assignmentMemoryRegister(memDst, regSrc);
       }
 
 
@@ -519,6 +607,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->labelled)
+            this->setRegisterLabelSet(regDst, this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -543,6 +633,8 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->labelled)
+            this->setRegisterLabelSet(regDst, this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           return TAINTED;
         }
 
@@ -564,6 +656,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (this->labelled)
+              this->setMemoryLabelSet(addrDst+offset, 1, this->getMemoryLabelSet(addrSrc+offset));
             isTainted = TAINTED;
           }
         }
@@ -589,6 +683,8 @@ namespace triton {
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->labelled)
+            this->setMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -613,6 +709,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->labelled)
+            this->uniteRegisterLabelSet(regDst, this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -634,6 +732,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < writeSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (this->labelled)
+              this->uniteMemoryLabelSet(addrDst+offset, 1, this->getMemoryLabelSet(addrSrc+offset));
             tainted = TAINTED;
           }
         }
@@ -654,6 +754,8 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->labelled)
+            this->uniteRegisterLabelSet(regDst, this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           return TAINTED;
         }
 
@@ -681,6 +783,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->labelled)
+            this->uniteMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -690,6 +794,62 @@ namespace triton {
         return !TAINTED;
       }
 
+
+      void TaintEngine::takeSnapshot(void) {
+        Snapshot mark;
+
+        mark.memoryJournal    = this->memoryJournal.size();
+        mark.labelJournal     = this->labelJournal.size();
+        mark.taintedRegisters = this->taintedRegisters;
+        mark.registerLabels   = this->registerLabels;
+
+        this->snapshots.push_back(mark);
+      }
+
+
+      void TaintEngine::restoreSnapshot(triton::usize index) {
+        if (index >= this->snapshots.size())
+          throw triton::exceptions::TaintEngine("TaintEngine::restoreSnapshot(): Invalid snapshot index.");
+
+        const Snapshot& mark = this->snapshots[index];
+
+        /* Unwind the memory journal */
+        while (this->memoryJournal.size() > mark.memoryJournal) {
+          const std::pair<triton::uint64, bool>& entry = this->memoryJournal.back();
+          if (entry.second == TAINTED)
+            this->taintedMemory.set(entry.first, 1);
+          else
+            this->taintedMemory.unset(entry.first, 1);
+          this->memoryJournal.pop_back();
+        }
+
+        /* Unwind the label journal */
+        while (this->labelJournal.size() > mark.labelJournal) {
+          const std::pair<triton::uint64, triton::uint32>& entry = this->labelJournal.back();
+          if (entry.second == NO_LABELS)
+            this->memoryLabels.erase(entry.first);
+          else
+            this->memoryLabels[entry.first] = entry.second;
+          this->labelJournal.pop_back();
+        }
+
+        this->taintedRegisters = mark.taintedRegisters;
+        this->registerLabels   = mark.registerLabels;
+        this->snapshots.resize(index + 1);
+      }
+
+
+      void TaintEngine::discardSnapshots(triton::usize index) {
+        if (index >= this->snapshots.size())
+          return;
+
+        this->snapshots.resize(index);
+        if (this->snapshots.empty()) {
+          this->memoryJournal.clear();
+          this->labelJournal.clear();
+        }
+      }
+
     }; /* taint namespace */
   }; /* engines namespace */
 }; /* triton namespace */
@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <exceptions.hpp>
+#include <taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      std::size_t TaintLabels::LabelsHash::operator()(const std::vector<triton::uint32>& labels) const {
+        triton::uint64 hash = 0xcbf29ce484222325ULL;
+
+        for (triton::uint32 label : labels) {
+          hash ^= label;
+          hash *= 0x100000001b3ULL;
+        }
+
+        return static_cast<std::size_t>(hash);
+      }
+
+
+      TaintLabels::TaintLabels() {
+        this->clear();
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->sets.clear();
+        this->ids.clear();
+        this->unions.clear();
+
+        /* The id 0 is the empty set */
+        this->sets.push_back(std::vector<triton::uint32>());
+        this->ids[this->sets.back()] = NO_LABELS;
+      }
+
+
+      triton::usize TaintLabels::size(void) const {
+        return this->sets.size();
+      }
+
+
+      triton::uint32 TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        auto it = this->ids.find(labels);
+
+        if (it != this->ids.end())
+          return it->second;
+
+        triton::uint32 id = static_cast<triton::uint32>(this->sets.size());
+        this->sets.push_back(labels);
+        this->ids[labels] = id;
+
+        return id;
+      }
+
+
+      triton::uint32 TaintLabels::getLabelSet(triton::uint32 label) {
+        return this->intern(std::vector<triton::uint32>(1, label));
+      }
+
+
+      const std::vector<triton::uint32>& TaintLabels::getLabels(triton::uint32 id) const {
+        if (id >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::getLabels(): Invalid label set.");
+        return this->sets[id];
+      }
+
+
+      triton::uint32 TaintLabels::unite(triton::uint32 id1, triton::uint32 id2) {
+        if (id1 >= this->sets.size() || id2 >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::unite(): Invalid label set.");
+
+        if (id1 == id2 || id2 == NO_LABELS)
+          return id1;
+
+        if (id1 == NO_LABELS)
+          return id2;
+
+        /* The union is commutative, the key is ordered */
+        if (id1 > id2)
+          std::swap(id1, id2);
+
+        triton::uint64 key = (static_cast<triton::uint64>(id1) << 32) | id2;
+        auto it = this->unions.find(key);
+        if (it != this->unions.end())
+          return it->second;
+
+        std::vector<triton::uint32> labels;
+        labels.reserve(this->sets[id1].size() + this->sets[id2].size());
+        std::set_union(this->sets[id1].begin(), this->sets[id1].end(),
+                       this->sets[id2].begin(), this->sets[id2].end(),
+                       std::back_inserter(labels));
+
+        triton::uint32 id = this->intern(labels);
+        this->unions[key] = id;
+
+        return id;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,182 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <exceptions.hpp>
+#include <traceFormat.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      /* The number of entries of the match table of the compressor */
+      static const triton::uint32 HASH_BITS = 12;
+
+
+      /* The minimum length of a match */
+      static const triton::usize MIN_MATCH = 4;
+
+
+      /* Returns the slot of the 4 bytes at `data` in the match table */
+      static inline triton::uint32 hashBytes(const triton::uint8* data) {
+        triton::uint32 value = 0;
+        std::memcpy(&value, data, sizeof(value));
+        return (value * 2654435761U) >> (32 - HASH_BITS);
+      }
+
+
+      void writeVarint(std::vector<triton::uint8>& buffer, triton::uint64 value) {
+        while (value >= 0x80) {
+          buffer.push_back(static_cast<triton::uint8>(value | 0x80));
+          value >>= 7;
+        }
+        buffer.push_back(static_cast<triton::uint8>(value));
+      }
+
+
+      triton::uint64 readVarint(const std::vector<triton::uint8>& buffer, triton::usize& offset) {
+        triton::uint64 value = 0;
+
+        for (triton::uint32 shift = 0; shift < 64; shift += 7) {
+          if (offset >= buffer.size())
+            throw triton::exceptions::Trace("readVarint(): Unexpected end of the buffer.");
+          triton::uint8 byte = buffer[offset++];
+          value |= static_cast<triton::uint64>(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0)
+            return value;
+        }
+
+        throw triton::exceptions::Trace("readVarint(): Invalid varint.");
+      }
+
+
+      void writeSignedVarint(std::vector<triton::uint8>& buffer, triton::sint64 value) {
+        writeVarint(buffer, (static_cast<triton::uint64>(value) << 1) ^ static_cast<triton::uint64>(value >> 63));
+      }
+
+
+      triton::sint64 readSignedVarint(const std::vector<triton::uint8>& buffer, triton::usize& offset) {
+        triton::uint64 value = readVarint(buffer, offset);
+        return static_cast<triton::sint64>((value >> 1) ^ (~(value & 1) + 1));
+      }
+
+
+      void writeValue(std::vector<triton::uint8>& buffer, triton::uint512 value) {
+        triton::uint8 bytes[64];
+        triton::uint8 size = 0;
+
+        while (value != 0 && size < sizeof(bytes)) {
+          bytes[size++] = static_cast<triton::uint8>(value & 0xff);
+          value >>= 8;
+        }
+
+        buffer.push_back(size);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+      }
+
+
+      triton::uint512 readValue(const std::vector<triton::uint8>& buffer, triton::usize& offset) {
+        triton::uint512 value = 0;
+        triton::uint8 size    = 0;
+
+        if (offset >= buffer.size() || buffer[offset] > 64 || buffer.size() - offset - 1 < buffer[offset])
+          throw triton::exceptions::Trace("readValue(): Unexpected end of the buffer.");
+
+        size = buffer[offset++];
+        for (triton::uint32 index = size; index > 0; index--)
+          value = (value << 8) | buffer[offset + index - 1];
+        offset += size;
+
+        return value;
+      }
+
+
+      /*
+       * The compressed payload is a list of sequences: a varint number of literals, the literals,
+       * then a varint match length and a varint match offset. A null match length ends the payload.
+       */
+      std::vector<triton::uint8> compressBlock(const std::vector<triton::uint8>& input) {
+        std::vector<triton::uint8> output;
+        std::vector<triton::usize> table(1 << HASH_BITS, 0);
+        const triton::uint8* data = input.data();
+        triton::usize anchor      = 0;
+        triton::usize pos         = 0;
+
+        output.reserve(input.size() / 2);
+
+        while (input.size() >= MIN_MATCH && pos <= input.size() - MIN_MATCH) {
+          triton::uint32 slot     = hashBytes(data + pos);
+          triton::usize candidate = table[slot];
+
+          /* The table keeps positions plus one, zero is an empty slot */
+          table[slot] = pos + 1;
+          if (candidate == 0 || std::memcmp(data + candidate - 1, data + pos, MIN_MATCH) != 0) {
+            pos++;
+            continue;
+          }
+          candidate--;
+
+          triton::usize length = MIN_MATCH;
+          while (pos + length < input.size() && data[candidate + length] == data[pos + length])
+            length++;
+
+          writeVarint(output, pos - anchor);
+          output.insert(output.end(), data + anchor, data + pos);
+          writeVarint(output, length);
+          writeVarint(output, pos - candidate);
+
+          pos   += length;
+          anchor = pos;
+        }
+
+        writeVarint(output, input.size() - anchor);
+        output.insert(output.end(), data + anchor, data + input.size());
+        writeVarint(output, 0);
+
+        return output;
+      }
+
+
+      std::vector<triton::uint8> decompressBlock(const std::vector<triton::uint8>& input, triton::usize size) {
+        std::vector<triton::uint8> output;
+        triton::usize offset = 0;
+
+        output.reserve(size);
+
+        while (true) {
+          triton::uint64 literals = readVarint(input, offset);
+          if (literals > input.size() - offset || literals > size - output.size())
+            throw triton::exceptions::Trace("decompressBlock(): Corrupted block.");
+          output.insert(output.end(), input.begin() + offset, input.begin() + offset + literals);
+          offset += literals;
+
+          triton::uint64 length = readVarint(input, offset);
+          if (length == 0)
+            break;
+
+          triton::uint64 distance = readVarint(input, offset);
+          if (distance == 0 || distance > output.size() || length > size - output.size())
+            throw triton::exceptions::Trace("decompressBlock(): Corrupted block.");
+
+          /* The match may overlap the bytes it produces */
+          triton::usize from = output.size() - distance;
+          for (triton::uint64 index = 0; index < length; index++)
+            output.push_back(output[from + index]);
+        }
+
+        if (output.size() != size)
+          throw triton::exceptions::Trace("decompressBlock(): Corrupted block.");
+
+        return output;
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
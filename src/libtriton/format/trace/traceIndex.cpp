@@ -0,0 +1,302 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+#include <exceptions.hpp>
+#include <pagedMemory.hpp>
+#include <traceIndex.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      /* The magic number of an index file */
+      static const char INDEX_MAGIC[] = "TRITONIX";
+
+
+      /* The version of the index format */
+      static const triton::uint8 INDEX_VERSION = 1;
+
+
+      TraceIndex::TraceIndex() {
+        this->architecture = triton::arch::ARCH_INVALID;
+        this->interval     = 0;
+        this->count        = 0;
+      }
+
+
+      void TraceIndex::capture(triton::API& ctx, triton::usize instruction, triton::uint64 offset) {
+        TraceCheckpoint checkpoint;
+
+        checkpoint.instruction = instruction;
+        checkpoint.offset      = offset;
+
+        for (const auto* reg : ctx.getAllRegisters()) {
+          if (reg->getParent().getId() == reg->getId())
+            checkpoint.registers.push_back(std::make_pair(reg->getId(), ctx.getConcreteRegisterValue(*reg, false)));
+        }
+
+        /* The mapped areas of each page changed since the previous checkpoint */
+        for (auto base : ctx.getDirtyMemoryPages()) {
+          TracePage page;
+          page.base = base;
+
+          if (ctx.isMemoryMapped(base, triton::arch::PAGE_SIZE)) {
+            page.areas.push_back(std::make_pair(base, ctx.getConcreteMemoryAreaValue(base, triton::arch::PAGE_SIZE, false)));
+          }
+          else {
+            for (triton::uint64 addr = base; addr < base + triton::arch::PAGE_SIZE;) {
+              triton::uint64 end = addr;
+              while (end < base + triton::arch::PAGE_SIZE && ctx.isMemoryMapped(end))
+                end++;
+              if (end != addr)
+                page.areas.push_back(std::make_pair(addr, ctx.getConcreteMemoryAreaValue(addr, end - addr, false)));
+              addr = end + 1;
+            }
+          }
+
+          checkpoint.pages.push_back(page);
+        }
+
+        ctx.clearDirtyMemoryPages();
+        this->checkpoints.push_back(checkpoint);
+      }
+
+
+      void TraceIndex::build(triton::API& ctx, const std::string& tracePath, triton::usize interval) {
+        triton::API::Scope scope(ctx);
+        TraceReader reader(tracePath);
+        triton::usize last = 0;
+
+        if (interval == 0)
+          throw triton::exceptions::Trace("TraceIndex::build(): The interval cannot be null.");
+
+        if (!ctx.isArchitectureValid())
+          ctx.setArchitecture(reader.getArchitecture());
+        else if (ctx.getArchitecture() != reader.getArchitecture())
+          throw triton::exceptions::Trace("TraceIndex::build(): The architecture of the trace differs from the one of the context.");
+
+        this->architecture = reader.getArchitecture();
+        this->interval     = interval;
+        this->checkpoints.clear();
+
+        this->capture(ctx, 0, reader.tell());
+
+        while (true) {
+          triton::arch::Instruction inst;
+
+          if (reader.isBlockBoundary() && reader.getCount() - last >= interval) {
+            last = reader.getCount();
+            this->capture(ctx, last, reader.tell());
+          }
+
+          if (!reader.next(inst))
+            break;
+
+          ctx.processing(inst);
+        }
+
+        /* A checkpoint at the end of the trace starts an empty segment */
+        this->count = reader.getCount();
+        if (this->checkpoints.size() > 1 && this->checkpoints.back().instruction == this->count)
+          this->checkpoints.pop_back();
+      }
+
+
+      void TraceIndex::save(const std::string& path) const {
+        std::vector<triton::uint8> buffer(INDEX_MAGIC, INDEX_MAGIC + 8);
+        FILE* fd = nullptr;
+
+        buffer.push_back(INDEX_VERSION);
+        buffer.push_back(static_cast<triton::uint8>(this->architecture));
+        writeVarint(buffer, this->interval);
+        writeVarint(buffer, this->count);
+        writeVarint(buffer, this->checkpoints.size());
+
+        for (const auto& checkpoint : this->checkpoints) {
+          writeVarint(buffer, checkpoint.instruction);
+          writeVarint(buffer, checkpoint.offset);
+
+          writeVarint(buffer, checkpoint.registers.size());
+          for (const auto& reg : checkpoint.registers) {
+            writeVarint(buffer, reg.first);
+            writeValue(buffer, reg.second);
+          }
+
+          writeVarint(buffer, checkpoint.pages.size());
+          for (const auto& page : checkpoint.pages) {
+            writeVarint(buffer, page.base);
+            writeVarint(buffer, page.areas.size());
+            for (const auto& area : page.areas) {
+              writeVarint(buffer, area.first - page.base);
+              writeVarint(buffer, area.second.size());
+              buffer.insert(buffer.end(), area.second.begin(), area.second.end());
+            }
+          }
+        }
+
+        fd = fopen(path.c_str(), "wb");
+        if (fd == nullptr)
+          throw triton::exceptions::Trace("TraceIndex::save(): Cannot create the index file.");
+
+        bool written = (fwrite(buffer.data(), 1, buffer.size(), fd) == buffer.size());
+        if (fclose(fd) != 0 || !written)
+          throw triton::exceptions::Trace("TraceIndex::save(): Cannot write the index file.");
+      }
+
+
+      void TraceIndex::load(const std::string& path) {
+        std::vector<triton::uint8> buffer;
+        triton::usize offset = 10;
+        triton::uint8 chunk[0x1000];
+        FILE* fd = nullptr;
+
+        fd = fopen(path.c_str(), "rb");
+        if (fd == nullptr)
+          throw triton::exceptions::Trace("TraceIndex::load(): Cannot open the index file.");
+
+        for (triton::usize size = 0; (size = fread(chunk, 1, sizeof(chunk), fd)) > 0;)
+          buffer.insert(buffer.end(), chunk, chunk + size);
+        fclose(fd);
+
+        if (buffer.size() < offset || std::memcmp(buffer.data(), INDEX_MAGIC, 8) != 0 || buffer[8] != INDEX_VERSION)
+          throw triton::exceptions::Trace("TraceIndex::load(): Invalid index file.");
+
+        std::vector<TraceCheckpoint> checkpoints;
+        triton::uint32 architecture = buffer[9];
+        triton::usize interval      = readVarint(buffer, offset);
+        triton::usize count         = readVarint(buffer, offset);
+        triton::uint64 number       = readVarint(buffer, offset);
+
+        for (triton::uint64 index = 0; index < number; index++) {
+          TraceCheckpoint checkpoint;
+
+          checkpoint.instruction = readVarint(buffer, offset);
+          checkpoint.offset      = readVarint(buffer, offset);
+
+          triton::uint64 registers = readVarint(buffer, offset);
+          for (triton::uint64 reg = 0; reg < registers; reg++) {
+            triton::uint32 regId  = static_cast<triton::uint32>(readVarint(buffer, offset));
+            triton::uint512 value = readValue(buffer, offset);
+            checkpoint.registers.push_back(std::make_pair(regId, value));
+          }
+
+          triton::uint64 pages = readVarint(buffer, offset);
+          for (triton::uint64 p = 0; p < pages; p++) {
+            TracePage page;
+            page.base = readVarint(buffer, offset);
+
+            triton::uint64 areas = readVarint(buffer, offset);
+            for (triton::uint64 area = 0; area < areas; area++) {
+              triton::uint64 addr = page.base + readVarint(buffer, offset);
+              triton::uint64 size = readVarint(buffer, offset);
+              if (size > triton::arch::PAGE_SIZE || size > buffer.size() - offset)
+                throw triton::exceptions::Trace("TraceIndex::load(): Corrupted index file.");
+              page.areas.push_back(std::make_pair(addr, std::vector<triton::uint8>(buffer.begin() + offset, buffer.begin() + offset + size)));
+              offset += size;
+            }
+
+            checkpoint.pages.push_back(page);
+          }
+
+          checkpoints.push_back(checkpoint);
+        }
+
+        if (checkpoints.empty())
+          throw triton::exceptions::Trace("TraceIndex::load(): Corrupted index file.");
+
+        this->architecture = architecture;
+        this->interval     = interval;
+        this->count        = count;
+        this->checkpoints.swap(checkpoints);
+      }
+
+
+      triton::uint32 TraceIndex::getArchitecture(void) const {
+        return this->architecture;
+      }
+
+
+      triton::usize TraceIndex::getInstructionCount(void) const {
+        return this->count;
+      }
+
+
+      const std::vector<TraceCheckpoint>& TraceIndex::getCheckpoints(void) const {
+        return this->checkpoints;
+      }
+
+
+      triton::usize TraceIndex::findCheckpoint(triton::usize instruction) const {
+        triton::usize lo = 0;
+        triton::usize hi = this->checkpoints.size();
+
+        if (hi == 0)
+          throw triton::exceptions::Trace("TraceIndex::findCheckpoint(): The index is empty.");
+
+        /* The last checkpoint whose instruction is lower or equal */
+        while (hi - lo > 1) {
+          triton::usize mid = (lo + hi) / 2;
+          if (this->checkpoints[mid].instruction <= instruction)
+            lo = mid;
+          else
+            hi = mid;
+        }
+
+        return lo;
+      }
+
+
+      void TraceIndex::restore(triton::API& ctx, triton::usize checkpoint) const {
+        std::map<triton::uint64, const TracePage*> pages;
+        triton::API::Scope scope(ctx);
+
+        if (checkpoint >= this->checkpoints.size())
+          throw triton::exceptions::Trace("TraceIndex::restore(): Invalid checkpoint.");
+
+        if (!ctx.isArchitectureValid())
+          ctx.setArchitecture(this->architecture);
+        else if (ctx.getArchitecture() != this->architecture)
+          throw triton::exceptions::Trace("TraceIndex::restore(): The architecture of the trace differs from the one of the context.");
+
+        /* The last version of each page up to the checkpoint */
+        for (triton::usize index = 0; index <= checkpoint; index++) {
+          for (const auto& page : this->checkpoints[index].pages)
+            pages[page.base] = &page;
+        }
+
+        /* The pages changed in the context but absent from the checkpoint were not mapped at the checkpoint */
+        for (auto base : ctx.getDirtyMemoryPages()) {
+          if (pages.find(base) == pages.end())
+            ctx.unmapMemory(base, triton::arch::PAGE_SIZE);
+        }
+
+        for (const auto& page : pages) {
+          ctx.unmapMemory(page.first, triton::arch::PAGE_SIZE);
+          for (const auto& area : page.second->areas)
+            ctx.setConcreteMemoryAreaValue(area.first, area.second);
+        }
+
+        for (const auto& reg : this->checkpoints[checkpoint].registers)
+          ctx.setConcreteRegisterValue(triton::arch::Register(reg.first, reg.second));
+      }
+
+
+      void TraceIndex::seek(TraceReader& reader, triton::usize checkpoint) const {
+        if (checkpoint >= this->checkpoints.size())
+          throw triton::exceptions::Trace("TraceIndex::seek(): Invalid checkpoint.");
+        reader.seek(this->checkpoints[checkpoint].offset, this->checkpoints[checkpoint].instruction);
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
@@ -0,0 +1,242 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <exceptions.hpp>
+#include <traceReader.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      /* Moves in the trace file, which may be larger than 2 GiB */
+      static inline bool fileSeek(FILE* fd, triton::uint64 offset) {
+        #if defined(_WIN32)
+        return (_fseeki64(fd, static_cast<__int64>(offset), SEEK_SET) == 0);
+        #else
+        return (fseeko(fd, static_cast<off_t>(offset), SEEK_SET) == 0);
+        #endif
+      }
+
+
+      /* Returns the position in the trace file */
+      static inline triton::uint64 fileTell(FILE* fd) {
+        #if defined(_WIN32)
+        return static_cast<triton::uint64>(_ftelli64(fd));
+        #else
+        return static_cast<triton::uint64>(ftello(fd));
+        #endif
+      }
+
+
+      TraceReader::TraceReader(const std::string& path) {
+        this->path = path;
+        this->fd   = fopen(path.c_str(), "rb");
+
+        if (this->fd == nullptr)
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot open the trace file.");
+
+        try {
+          this->rewind();
+        }
+        catch (const triton::exceptions::Exception&) {
+          fclose(this->fd);
+          throw;
+        }
+      }
+
+
+      TraceReader::~TraceReader() {
+        fclose(this->fd);
+      }
+
+
+      bool TraceReader::readRaw(triton::uint8* data, triton::usize size) {
+        return (fread(data, 1, size, this->fd) == size);
+      }
+
+
+      triton::uint64 TraceReader::readFileVarint(void) {
+        triton::uint64 value = 0;
+        triton::uint8 byte   = 0;
+
+        for (triton::uint32 shift = 0; shift < 64; shift += 7) {
+          if (!this->readRaw(&byte, 1))
+            throw triton::exceptions::Trace("TraceReader::readFileVarint(): Unexpected end of the trace file.");
+          value |= static_cast<triton::uint64>(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0)
+            return value;
+        }
+
+        throw triton::exceptions::Trace("TraceReader::readFileVarint(): Invalid varint.");
+      }
+
+
+      bool TraceReader::loadBlock(void) {
+        std::vector<triton::uint8> payload;
+        triton::uint8 flags = 0;
+
+        if (!this->readRaw(&flags, 1))
+          return false;
+
+        triton::uint64 records = this->readFileVarint();
+        triton::uint64 rawSize = this->readFileVarint();
+        triton::uint64 size    = this->readFileVarint();
+
+        if (rawSize > TRACE_MAX_BLOCK_SIZE || size > TRACE_MAX_BLOCK_SIZE || (flags & ~TRACE_COMPRESSED))
+          throw triton::exceptions::Trace("TraceReader::loadBlock(): Corrupted block header.");
+
+        payload.resize(size);
+        if (!this->readRaw(payload.data(), size))
+          throw triton::exceptions::Trace("TraceReader::loadBlock(): Unexpected end of the trace file.");
+
+        if (flags & TRACE_COMPRESSED)
+          this->block = decompressBlock(payload, rawSize);
+        else
+          this->block.swap(payload);
+
+        this->offset      = 0;
+        this->blockCount  = records;
+        this->nextAddress = 0;
+        this->lastMemory  = 0;
+        this->threadId    = 0;
+        this->opcodes.clear();
+
+        return true;
+      }
+
+
+      triton::uint32 TraceReader::getArchitecture(void) const {
+        return this->architecture;
+      }
+
+
+      bool TraceReader::isCompressed(void) const {
+        return this->compressed;
+      }
+
+
+      triton::usize TraceReader::getCount(void) const {
+        return this->count;
+      }
+
+
+      bool TraceReader::next(triton::arch::Instruction& inst) {
+        while (this->blockCount == 0) {
+          if (!this->loadBlock())
+            return false;
+        }
+
+        const std::vector<triton::uint8>& data = this->block;
+        if (this->offset >= data.size())
+          throw triton::exceptions::Trace("TraceReader::next(): Unexpected end of the block.");
+
+        triton::uint8 flags    = data[this->offset++];
+        triton::uint64 address = this->nextAddress + static_cast<triton::uint64>(readSignedVarint(data, this->offset));
+
+        if (flags & RECORD_THREAD)
+          this->threadId = static_cast<triton::uint32>(readVarint(data, this->offset));
+
+        if (flags & RECORD_OPCODES) {
+          if (this->offset >= data.size() || data.size() - this->offset - 1 < data[this->offset])
+            throw triton::exceptions::Trace("TraceReader::next(): Unexpected end of the block.");
+          triton::uint8 size = data[this->offset++];
+          this->opcodes[address].assign(data.begin() + this->offset, data.begin() + this->offset + size);
+          this->offset += size;
+        }
+
+        auto opcodes = this->opcodes.find(address);
+        if (opcodes == this->opcodes.end())
+          throw triton::exceptions::Trace("TraceReader::next(): Missing opcodes.");
+
+        inst.memoryAccess.clear();
+        inst.registerState.clear();
+        inst.setAddress(address);
+        inst.setThreadId(this->threadId);
+        inst.setOpcodes(opcodes->second.data(), static_cast<triton::uint32>(opcodes->second.size()));
+
+        triton::uint64 registers = readVarint(data, this->offset);
+        for (triton::uint64 index = 0; index < registers; index++) {
+          triton::uint32 regId  = static_cast<triton::uint32>(readVarint(data, this->offset));
+          triton::uint512 value = readValue(data, this->offset);
+          inst.updateContext(triton::arch::Register(regId, value));
+        }
+
+        triton::uint64 accesses = readVarint(data, this->offset);
+        for (triton::uint64 index = 0; index < accesses; index++) {
+          this->lastMemory += static_cast<triton::uint64>(readSignedVarint(data, this->offset));
+          if (this->offset >= data.size())
+            throw triton::exceptions::Trace("TraceReader::next(): Unexpected end of the block.");
+          triton::uint32 size   = data[this->offset++];
+          triton::uint512 value = readValue(data, this->offset);
+          inst.updateContext(triton::arch::MemoryAccess(this->lastMemory, size, value));
+        }
+
+        this->nextAddress = address + opcodes->second.size();
+        this->blockCount--;
+        this->count++;
+
+        return true;
+      }
+
+
+      void TraceReader::rewind(void) {
+        triton::uint8 header[TRACE_HEADER_SIZE] = {0};
+
+        if (!fileSeek(this->fd, 0) || !this->readRaw(header, sizeof(header)))
+          throw triton::exceptions::Trace("TraceReader::rewind(): Cannot read the trace header.");
+
+        if (std::memcmp(header, TRACE_MAGIC, 8) != 0)
+          throw triton::exceptions::Trace("TraceReader::rewind(): Invalid trace file.");
+
+        if (header[8] != TRACE_VERSION)
+          throw triton::exceptions::Trace("TraceReader::rewind(): Unsupported trace version.");
+
+        this->architecture = header[9];
+        this->compressed   = (header[10] & TRACE_COMPRESSED) != 0;
+        this->offset       = 0;
+        this->blockCount   = 0;
+        this->count        = 0;
+        this->nextAddress  = 0;
+        this->lastMemory   = 0;
+        this->threadId     = 0;
+        this->block.clear();
+        this->opcodes.clear();
+      }
+
+      bool TraceReader::isBlockBoundary(void) const {
+        return (this->blockCount == 0);
+      }
+
+
+      triton::uint64 TraceReader::tell(void) const {
+        if (this->blockCount != 0)
+          throw triton::exceptions::Trace("TraceReader::tell(): Not on a block boundary.");
+        return fileTell(this->fd);
+      }
+
+
+      void TraceReader::seek(triton::uint64 offset, triton::usize count) {
+        if (offset < TRACE_HEADER_SIZE || !fileSeek(this->fd, offset))
+          throw triton::exceptions::Trace("TraceReader::seek(): Invalid offset.");
+
+        this->offset      = 0;
+        this->blockCount  = 0;
+        this->count       = count;
+        this->nextAddress = 0;
+        this->lastMemory  = 0;
+        this->threadId    = 0;
+        this->block.clear();
+        this->opcodes.clear();
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
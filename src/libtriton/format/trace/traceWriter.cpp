@@ -0,0 +1,178 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <exceptions.hpp>
+#include <traceWriter.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      TraceWriter::TraceWriter(const std::string& path, triton::uint32 arch, bool compressed) {
+        triton::uint8 header[TRACE_HEADER_SIZE] = {0};
+
+        this->compressed = compressed;
+        this->blockCount = 0;
+        this->count      = 0;
+        this->resetDeltas();
+
+        this->fd = fopen(path.c_str(), "wb");
+        if (this->fd == nullptr)
+          throw triton::exceptions::Trace("TraceWriter::TraceWriter(): Cannot create the trace file.");
+
+        std::memcpy(header, TRACE_MAGIC, 8);
+        header[8]  = TRACE_VERSION;
+        header[9]  = static_cast<triton::uint8>(arch);
+        header[10] = (compressed ? TRACE_COMPRESSED : 0);
+        this->writeRaw(header, sizeof(header));
+      }
+
+
+      TraceWriter::~TraceWriter() {
+        /* A destructor must not throw, a failed write is lost */
+        try {
+          this->close();
+        }
+        catch (const triton::exceptions::Exception&) {
+        }
+      }
+
+
+      void TraceWriter::writeRaw(const triton::uint8* data, triton::usize size) {
+        if (fwrite(data, 1, size, this->fd) != size)
+          throw triton::exceptions::Trace("TraceWriter::writeRaw(): Cannot write the trace file.");
+      }
+
+
+      void TraceWriter::resetDeltas(void) {
+        this->nextAddress = 0;
+        this->lastMemory  = 0;
+        this->threadId    = 0;
+        this->registers.clear();
+        this->opcodes.clear();
+      }
+
+
+      void TraceWriter::write(const triton::arch::Instruction& inst) {
+        std::map<triton::uint32, triton::uint512> registers;
+        std::vector<triton::uint8> opcodes(inst.getOpcodes(), inst.getOpcodes() + inst.getSize());
+        triton::uint8 flags = 0;
+
+        if (this->fd == nullptr)
+          throw triton::exceptions::Trace("TraceWriter::write(): The trace is closed.");
+
+        if (inst.getThreadId() != this->threadId)
+          flags |= RECORD_THREAD;
+
+        auto cached = this->opcodes.find(inst.getAddress());
+        if (cached == this->opcodes.end() || cached->second != opcodes) {
+          flags |= RECORD_OPCODES;
+          this->opcodes[inst.getAddress()] = opcodes;
+        }
+
+        this->block.push_back(flags);
+        writeSignedVarint(this->block, static_cast<triton::sint64>(inst.getAddress() - this->nextAddress));
+
+        if (flags & RECORD_THREAD)
+          writeVarint(this->block, inst.getThreadId());
+
+        if (flags & RECORD_OPCODES) {
+          this->block.push_back(static_cast<triton::uint8>(opcodes.size()));
+          this->block.insert(this->block.end(), opcodes.begin(), opcodes.end());
+        }
+
+        /* Only the registers which differ from the previous record */
+        for (const auto& reg : inst.registerState)
+          registers[reg.getId()] = reg.getConcreteValue();
+
+        std::vector<triton::uint8> changes;
+        triton::usize changed = 0;
+        for (const auto& reg : registers) {
+          auto previous = this->registers.find(reg.first);
+          if (previous != this->registers.end() && previous->second == reg.second)
+            continue;
+          writeVarint(changes, reg.first);
+          writeValue(changes, reg.second);
+          changed++;
+        }
+        writeVarint(this->block, changed);
+        this->block.insert(this->block.end(), changes.begin(), changes.end());
+
+        writeVarint(this->block, inst.memoryAccess.size());
+        for (const auto& mem : inst.memoryAccess) {
+          writeSignedVarint(this->block, static_cast<triton::sint64>(mem.getAddress() - this->lastMemory));
+          this->block.push_back(static_cast<triton::uint8>(mem.getSize()));
+          writeValue(this->block, mem.getConcreteValue());
+          this->lastMemory = mem.getAddress();
+        }
+
+        this->nextAddress = inst.getAddress() + inst.getSize();
+        this->threadId    = inst.getThreadId();
+        this->registers.swap(registers);
+        this->blockCount++;
+        this->count++;
+
+        if (this->block.size() >= TRACE_BLOCK_SIZE)
+          this->flush();
+      }
+
+
+      void TraceWriter::flush(void) {
+        std::vector<triton::uint8> header;
+        std::vector<triton::uint8> payload;
+        triton::uint8 flags = 0;
+
+        if (this->fd == nullptr || this->blockCount == 0)
+          return;
+
+        /* The block is stored raw if the compression does not help */
+        if (this->compressed) {
+          payload = compressBlock(this->block);
+          if (payload.size() < this->block.size())
+            flags = TRACE_COMPRESSED;
+        }
+        if (flags == 0)
+          payload.swap(this->block);
+
+        header.push_back(flags);
+        writeVarint(header, this->blockCount);
+        writeVarint(header, (flags == 0) ? payload.size() : this->block.size());
+        writeVarint(header, payload.size());
+
+        this->writeRaw(header.data(), header.size());
+        this->writeRaw(payload.data(), payload.size());
+
+        this->block.clear();
+        this->blockCount = 0;
+        this->resetDeltas();
+      }
+
+
+      void TraceWriter::close(void) {
+        if (this->fd == nullptr)
+          return;
+
+        this->flush();
+        if (fclose(this->fd) != 0) {
+          this->fd = nullptr;
+          throw triton::exceptions::Trace("TraceWriter::close(): Cannot write the trace file.");
+        }
+        this->fd = nullptr;
+      }
+
+
+      triton::usize TraceWriter::getCount(void) const {
+        return this->count;
+      }
+
+    }; /* trace namespace */
+  }; /* format namespace */
+}; /* triton namespace */
@@ -18,8 +18,10 @@
 #include "irBuilder.hpp"
 #include "memoryAccess.hpp"
 #include "operandWrapper.hpp"
+#include "profiler.hpp"
 #include "register.hpp"
 #include "registerSpecification.hpp"
+#include "snapshotEngine.hpp"
 #include "solverEngine.hpp"
 #include "symbolicEngine.hpp"
 #include "taintEngine.hpp"
@@ -40,7 +42,13 @@ namespace triton {
  */
 
     /*! \class API
-     *  \brief This is used as C++ API. */
+     *  \brief This is used as C++ API.
+     *
+     *  \description
+     *  An API instance is a context: it owns its CPU, engines, AST dictionaries and AST representation,
+     *  and several contexts may live in the same process. The AST builders, registers and memory accesses
+     *  work on the current context of the calling thread, which is `triton::api` unless an API::Scope
+     *  makes another one current. */
     class API {
 
       protected:
@@ -68,14 +76,47 @@ namespace triton {
         //! The Z3 interface between Triton and Z3
         triton::ast::Z3Interface* z3Interface;
 
+        //! The snapshot engine.
+        triton::engines::snapshot::SnapshotEngine* snapshot;
+
+        //! The AST representation.
+        triton::ast::representations::AstRepresentation astRepresentation;
+
+        //! The hot-path instrumentation, updated by the const methods too.
+        mutable triton::engines::profiling::Profiler profiler;
+
+        //! Processes the instructions from `addr` until a stop condition. If `block` is true, stops after a control flow instruction too. Runs under the scope of run() or processBlock().
+        triton::usize runInstructions(triton::uint64 addr, triton::usize maxInstructions, const std::set<triton::uint64>& stopAddresses, bool block);
+
 
       public:
+        /*! \class Scope
+         *  \brief Makes a context current for the calling thread during the lifetime of the scope.
+         *
+         *  \details Every public method which reaches the engines installs a scope on its own
+         *  context, so the AST nodes it builds belong to it whatever the calling thread is. */
+        class Scope {
+          private:
+            //! The context which was current before the scope.
+            API* previous;
+
+          public:
+            //! Constructor. Makes `api` the current context.
+            Scope(const API& api);
+
+            //! Destructor. Restores the previous context.
+            ~Scope();
+        };
+
         //! Constructor of the API.
         API();
 
         //! Destructor of the API.
         virtual ~API();
 
+        //! Returns the current context of the calling thread, `triton::api` if none has been set.
+        static API& getCurrent(void);
+
 
 
         /* Architecture API ============================================================================== */
@@ -117,7 +158,7 @@ namespace triton {
         triton::uint32 cpuNumberOfRegisters(void) const;
 
         //! [**architecture api**] - Returns all information about the register.
-        triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
+        const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 regId) const;
 
         //! [**architecture api**] - Returns all registers. \sa triton::arch::x86::registers_e.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
@@ -183,9 +224,24 @@ namespace triton {
         //! [**architecture api**] - Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
 
+        //! [**architecture api**] - Returns the sorted base addresses of the memory pages written or unmapped since the last clearDirtyMemoryPages().
+        std::vector<triton::uint64> getDirtyMemoryPages(void) const;
+
+        //! [**architecture api**] - Marks all memory pages as clean. \sa getDirtyMemoryPages().
+        void clearDirtyMemoryPages(void);
+
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! [**architecture api**] - Removes the decoded instructions which overlap the range `[baseAddr:size]` from the disassembly cache.
+        void invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size);
+
+        //! [**architecture api**] - Removes all decoded instructions from the disassembly cache.
+        void clearDisassemblyCache(void);
+
+        //! [**architecture api**] - Returns the statistics of the disassembly cache (entries, hits and misses).
+        std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
+
 
 
         /* Processing API ================================================================================ */
@@ -193,6 +249,18 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Processes the instructions from `addr` and follows the program counter. Returns the number of instructions processed.
+         *
+         * \description The opcodes are fetched from the concrete memory. The run stops before an unmapped address or
+         * an address of `stopAddresses` (except `addr`, so that a run may be resumed), after `maxInstructions`
+         * instructions (0 if unlimited) or after an unsupported instruction. The callbacks are called as with processing().
+         */
+        triton::usize run(triton::uint64 addr, triton::usize maxInstructions=0, const std::set<triton::uint64>& stopAddresses=std::set<triton::uint64>());
+
+        //! [**proccesing api**] - Processes the basic block at `addr`, up to its first control flow instruction. Returns the number of instructions processed. \sa run().
+        triton::usize processBlock(triton::uint64 addr, triton::usize maxInstructions=0, const std::set<triton::uint64>& stopAddresses=std::set<triton::uint64>());
+
         //! [**proccesing api**] - Initialize everything.
         void initEngines(void);
 
@@ -212,6 +280,30 @@ namespace triton {
         //! [**IR builder api**] - Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before. \sa processing().
         bool buildSemantics(triton::arch::Instruction& inst);
 
+        //! [**IR builder api**] - Enables or disables the fast-forward mode. The instructions are executed on the concrete state only, without symbolic expressions.
+        void enableFastForward(bool flag);
+
+        //! [**IR builder api**] - Returns true if the fast-forward mode is enabled. The mode is disabled when a symbolized or tainted operand is touched.
+        bool isFastForwardEnabled(void) const;
+
+        //! [**IR builder api**] - Stops the fast-forward mode when the instruction at `addr` is reached.
+        void addFastForwardStop(triton::uint64 addr);
+
+        //! [**IR builder api**] - Removes all addresses which stop the fast-forward mode.
+        void clearFastForwardStops(void);
+
+        //! [**IR builder api**] - Stops the fast-forward mode after `limit` instructions (0 if unlimited).
+        void setFastForwardLimit(triton::usize limit);
+
+        //! [**IR builder api**] - Returns the number of instructions processed in fast-forward mode.
+        triton::usize getFastForwardCount(void) const;
+
+        //! [**IR builder api**] - Clears the semantics templates. \sa triton::engines::symbolic::SEMANTICS_TEMPLATES.
+        void clearSemanticsTemplates(void);
+
+        //! [**IR builder api**] - Returns the statistics of the semantics templates (entries, hits and misses).
+        std::map<std::string, triton::usize> getSemanticsTemplatesStats(void) const;
+
 
 
         /* AST Garbage Collector API ===================================================================== */
@@ -259,6 +351,9 @@ namespace triton {
         //! [**AST representation api**] - Sets the AST representation mode.
         void setAstRepresentationMode(triton::uint32 mode);
 
+        //! [**AST representation api**] - Displays the node according to the representation mode.
+        std::ostream& printAstRepresentation(std::ostream& stream, triton::ast::AbstractNode* node);
+
 
 
         /* Callbacks API ================================================================================= */
@@ -266,6 +361,12 @@ namespace triton {
         //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_VALUE callback.
         void addCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
+        //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_PAGE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! [**callbacks api**] - Adds a GET_CONCRETE_REGISTER_VALUE callback.
         void addCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
@@ -283,6 +384,12 @@ namespace triton {
         //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
+        //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_PAGE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! [**callbacks api**] - Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
@@ -466,6 +573,24 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a specific symbolic register reference.
         void concretizeRegister(const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Returns a limit of the concretization policy (0 means disabled).
+        triton::uint64 getConcretizationLimit(enum triton::engines::symbolic::concretization_e kind) const;
+
+        //! [**symbolic api**] - Sets a limit of the concretization policy. 0 disables the limit.
+        void setConcretizationLimit(enum triton::engines::symbolic::concretization_e kind, triton::uint64 limit);
+
+        //! [**symbolic api**] - Adds a concretization range [start, end]. Symbolic stores which overlap it are concretized.
+        void addConcretizationRange(triton::uint64 start, triton::uint64 end);
+
+        //! [**symbolic api**] - Removes all concretization ranges.
+        void clearConcretizationRanges(void);
+
+        //! [**symbolic api**] - Returns the log of the concretizations applied by the concretization policy.
+        const std::vector<triton::engines::symbolic::ConcretizationEvent>& getConcretizationEvents(void) const;
+
+        //! [**symbolic api**] - Clears the log of the concretizations applied by the concretization policy.
+        void clearConcretizationEvents(void);
+
         //! [**symbolic api**] - Returns the partial AST from a symbolic expression id.
         triton::ast::AbstractNode* getAstFromId(triton::usize symExprId);
 
@@ -475,12 +600,15 @@ namespace triton {
         //! [**symbolic api**] - Returns the full AST from a symbolic expression id.
         triton::ast::AbstractNode* getFullAstFromId(triton::usize symExprId);
 
-        //! [**symbolic api**] - Slices all expressions from a given one.
-        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr);
+        //! [**symbolic api**] - Slices all expressions from a given one. The `depth` bounds the number of dependency levels followed (UNSET means unbounded).
+        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr, triton::usize depth=triton::engines::symbolic::UNSET);
 
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
+        //! [**symbolic api**] - Returns the list of the symbolic variables a node depends on.
+        std::list<triton::engines::symbolic::SymbolicVariable*> getSymbolicVariablesFromAst(triton::ast::AbstractNode* node) const;
+
         //! [**symbolic api**] - Returns all symbolic expressions as a map of <SymExprId : SymExpr>
         const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& getSymbolicExpressions(void) const;
 
@@ -527,6 +655,59 @@ namespace triton {
 
 
 
+        /* Snapshot engine API =========================================================================== */
+
+        //! [**snapshot api**] - Raises an exception if the snapshot engine is not initialized.
+        void checkSnapshot(void) const;
+
+        //! [**snapshot api**] - Returns the instance of the snapshot engine.
+        triton::engines::snapshot::SnapshotEngine* getSnapshotEngine(void);
+
+        //! [**snapshot api**] - Takes a snapshot of the concrete, symbolic and taint states. Returns the snapshot id.
+        triton::usize takeSnapshot(void);
+
+        //! [**snapshot api**] - Restores the states at the snapshot `id`. All snapshots taken after it are discarded.
+        void restoreSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Removes the snapshot `id` and all snapshots taken after it.
+        void removeSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Removes all snapshots.
+        void removeAllSnapshots(void);
+
+        //! [**snapshot api**] - Returns true if the snapshot `id` exists.
+        bool isSnapshotExists(triton::usize id) const;
+
+        //! [**snapshot api**] - Returns the number of snapshots alive.
+        triton::usize getNumberOfSnapshots(void) const;
+
+
+
+        /* Profiling API ================================================================================= */
+
+        //! [**profiling api**] - Returns true if the library has been built with the profiling hooks (`TRITON_PROFILING`).
+        bool isProfilingAvailable(void) const;
+
+        //! [**profiling api**] - Returns the profiler of the context.
+        triton::engines::profiling::Profiler& getProfiler(void);
+
+        //! [**profiling api**] - Returns the profiling counters as <name, value>. \sa triton::engines::profiling::Profiler::getStats().
+        std::map<std::string, triton::uint64> getProfilingStats(void) const;
+
+        //! [**profiling api**] - Returns the profiling counters of each opcode as <opcode, counters>.
+        const std::map<triton::uint32, triton::engines::profiling::OpcodeProfile>& getProfilingOpcodesStats(void) const;
+
+        //! [**profiling api**] - Resets all profiling counters and drops the recorded events.
+        void resetProfiling(void);
+
+        //! [**profiling api**] - Enables or disables the recording of the events for the trace-event export.
+        void enableProfilingTrace(bool flag);
+
+        //! [**profiling api**] - Writes the recorded events into `path` in the Chrome trace-event JSON format.
+        void saveProfilingTrace(const std::string& path) const;
+
+
+
         /* Taint engine API ============================================================================== */
 
         //! [**taint api**] - Raises an exception if the taint engine is not initialized.
@@ -535,12 +716,24 @@ namespace triton {
         //! [**taint api**] - Returns the instance of the taint engine.
         triton::engines::taint::TaintEngine* getTaintEngine(void);
 
-        //! [**taint api**] - Returns the tainted addresses.
-        const std::set<triton::uint64>& getTaintedMemory(void) const;
+        //! [**taint api**] - Returns the tainted addresses. This copies the whole shadow memory, prefer getTaintedMemoryAreas().
+        std::set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Returns the tainted memory areas as sorted and disjoint <base address, size>.
+        std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryAreas(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
 
+        //! [**taint api**] - Returns the labels of an address.
+        std::vector<triton::uint32> getMemoryLabels(triton::uint64 addr) const;
+
+        //! [**taint api**] - Returns the union of the labels of a memory.
+        std::vector<triton::uint32> getMemoryLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the labels of a register.
+        std::vector<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Enables or disables the taint engine.
         void enableTaintEngine(bool flag);
 
@@ -568,6 +761,15 @@ namespace triton {
         //! [**taint api**] - Sets the flag (taint or untaint) to a register.
         bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
+        //! [**taint api**] - Taints an address and adds `label` to its labels. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+        bool labelMemory(triton::uint64 addr, triton::uint32 label);
+
+        //! [**taint api**] - Taints a memory and adds `label` to its labels. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+        bool labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register and adds `label` to its labels. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        bool labelRegister(const triton::arch::Register& reg, triton::uint32 label);
+
         //! [**taint api**] - Taints an address. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
         bool taintMemory(triton::uint64 addr);
 
@@ -629,7 +831,7 @@ namespace triton {
         bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
     };
 
-    //! The API can be accessed everywhere (WIP: will be removed).
+    //! The default context, used by the Python bindings and the tracers.
     extern triton::API api;
 
 /*! @} End of triton namespace */
@@ -8,7 +8,10 @@
 #ifndef TRITON_ARCHITECTURE_H
 #define TRITON_ARCHITECTURE_H
 
+#include <map>
 #include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "callbacks.hpp"
@@ -58,6 +61,21 @@ namespace triton {
         //! Instance to the real CPU class.
         triton::arch::CpuInterface* cpu;
 
+        //! The marks of each snapshot as (memory journal size, register journal size).
+        std::vector<std::pair<triton::usize, triton::usize>> snapshots;
+
+        //! The undo journal of the concrete memory as (address, previous value or -1 if the cell was not mapped).
+        std::vector<std::pair<triton::uint64, triton::sint32>> memoryJournal;
+
+        //! The undo journal of the concrete registers (previous register states).
+        std::vector<triton::arch::Register> registerJournal;
+
+        //! Records the previous concrete value of a memory area into the journal.
+        void journalMemory(triton::uint64 baseAddr, triton::usize size);
+
+        //! Records the previous concrete value of a register into the journal.
+        void journalRegister(const triton::arch::Register& reg);
+
       public:
         //! Constructor.
         Architecture(triton::callbacks::Callbacks* callbacks=nullptr);
@@ -99,7 +117,7 @@ namespace triton {
         void clearArchitecture(void);
 
         //! Returns all information about the register.
-        triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
+        const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 regId) const;
 
         //! Returns all registers.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
@@ -107,9 +125,21 @@ namespace triton {
         //! Returns all parent registers.
         std::set<triton::arch::Register*> getParentRegisters(void) const;
 
+        //! Returns the program counter register.
+        const triton::arch::Register& getProgramCounter(void) const;
+
         //! Disassembles the instruction according to the architecture.
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! Removes the decoded instructions which overlap the range `[baseAddr:size]` from the disassembly cache.
+        void invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size);
+
+        //! Removes all decoded instructions from the disassembly cache.
+        void clearDisassemblyCache(void);
+
+        //! Returns the statistics of the disassembly cache (entries, hits and misses).
+        std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
+
         //! Builds the instruction semantics according to the architecture. Returns true if the instruction is supported.
         bool buildSemantics(triton::arch::Instruction& inst);
 
@@ -170,6 +200,21 @@ namespace triton {
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Returns the sorted base addresses of the memory pages written or unmapped since the last clearDirtyMemoryPages().
+        std::vector<triton::uint64> getDirtyMemoryPages(void) const;
+
+        //! Marks all memory pages as clean.
+        void clearDirtyMemoryPages(void);
+
+        //! Takes a snapshot of the concrete state. From now on, all concrete writes are journaled.
+        void takeSnapshot(void);
+
+        //! Restores the concrete state at the snapshot `index` and discards all snapshots taken after it.
+        void restoreSnapshot(triton::usize index);
+
+        //! Discards all snapshots from `index`. The journal is released when no snapshot remains.
+        void discardSnapshots(triton::usize index);
     };
 
   /*! @} End of arch namespace */
@@ -10,6 +10,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -59,6 +60,21 @@ namespace triton {
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! The sorted ids of the symbolic variables the tree depends on. Nodes with the same set share it.
+        std::shared_ptr<const std::vector<triton::usize>> variables;
+
+        //! The depth of the tree, references included.
+        triton::uint32 depth;
+
+        //! The number of nodes of the unrolled tree (saturates).
+        triton::uint64 nodes;
+
+        //! Resets the information spread by the childs.
+        void initInformation(void);
+
+        //! Spreads the information (symbolic variables, depth, number of nodes) of a child into this node.
+        void spreadInformation(const AbstractNode* node);
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
@@ -87,6 +103,18 @@ namespace triton {
         //! Returns true if the tree contains a symbolic variable.
         bool isSymbolized(void) const;
 
+        //! Returns the sorted ids of the symbolic variables the tree depends on.
+        const std::vector<triton::usize>& getSymbolicVariableIds(void) const;
+
+        //! Returns true if the tree depends on the symbolic variable id.
+        bool isDependentOn(triton::usize symVarId) const;
+
+        //! Returns the depth of the tree. References are followed, a leaf has a depth of 1.
+        triton::uint32 getDepth(void) const;
+
+        //! Returns the number of nodes of the tree once references are unrolled. The count saturates.
+        triton::uint64 getNumberOfNodes(void) const;
+
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
@@ -10,6 +10,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "ast.hpp"
 #include "symbolicEngine.hpp"
@@ -46,6 +47,12 @@ namespace triton {
         //! This map maintains a link between symbolic variables and their nodes.
         std::map<std::string, triton::ast::AbstractNode*> variableNodes;
 
+        //! The marks of each snapshot (node journal size).
+        std::vector<triton::usize> snapshots;
+
+        //! The journal of nodes allocated since the first snapshot.
+        std::vector<triton::ast::AbstractNode*> nodeJournal;
+
       public:
         //! Constructor.
         AstGarbageCollector(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -82,6 +89,15 @@ namespace triton {
 
         //! Sets all variable nodes recorded.
         void setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes);
+
+        //! Takes a snapshot of the allocated nodes. From now on, all new nodes are journaled.
+        void takeSnapshot(void);
+
+        //! Frees all nodes allocated after the snapshot `index` and discards all snapshots taken after it.
+        void restoreSnapshot(triton::usize index);
+
+        //! Discards all snapshots from `index`. The journal is released when no snapshot remains.
+        void discardSnapshots(triton::usize index);
     };
 
   /*! @} End of ast namespace */
@@ -55,9 +55,6 @@ namespace triton {
         //! Returns the pair<high, low>
         std::pair<triton::uint32, triton::uint32> getPair(void) const;
 
-        //! Copy a BitsVector.
-        void operator=(const BitsVector& other);
-
         //! Sets the highest bit position
         void setHigh(triton::uint32 v);
 
@@ -72,12 +69,6 @@ namespace triton {
 
         //! Constructor.
         BitsVector(triton::uint32 high, triton::uint32 low);
-
-        //! Constructor by copy.
-        BitsVector(const triton::arch::BitsVector& copy);
-
-        //! Destructor.
-        virtual ~BitsVector();
     };
 
     //! Displays a BitsVector.
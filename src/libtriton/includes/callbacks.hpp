@@ -38,9 +38,11 @@ namespace triton {
 
     /*! Enumerates all kinds callbacks. */
     enum callback_e {
-      GET_CONCRETE_MEMORY_VALUE,    /*!< Get concrete memory value callback */
-      GET_CONCRETE_REGISTER_VALUE,  /*!< Get concrete register value callback */
-      SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_VALUE,      /*!< Get concrete memory value callback */
+      GET_CONCRETE_REGISTER_VALUE,    /*!< Get concrete register value callback */
+      SYMBOLIC_SIMPLIFICATION,        /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_AREA_VALUE, /*!< Get concrete memory area value callback */
+      GET_CONCRETE_MEMORY_PAGE,       /*!< Get concrete memory page callback */
     };
 
     /*! \brief The prototype of a GET_CONCRETE_MEMORY_VALUE callback.
@@ -50,6 +52,21 @@ namespace triton {
      */
     typedef void (*getConcreteMemoryValueCallback)(triton::arch::MemoryAccess& mem);
 
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+     *
+     * \description The callback takes as arguments the base address and the size of an area. Callbacks will
+     * be called once per memory read, whatever the size of the area, before the concrete value is read.
+     */
+    typedef void (*getConcreteMemoryAreaValueCallback)(triton::uint64 baseAddr, triton::usize size);
+
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_PAGE callback.
+     *
+     * \description The callback takes as unique argument the base address of a page (triton::arch::PAGE_SIZE bytes).
+     * Callbacks will be called the first time that a byte of the page is read, unless the page has been written before,
+     * and may fill the whole page.
+     */
+    typedef void (*getConcreteMemoryPageCallback)(triton::uint64 pageAddr);
+
     /*! \brief The prototype of a GET_CONCRETE_REGISTER_VALUE callback.
      *
      * \description The callback takes as unique argument a register. Callbacks will be
@@ -72,6 +89,12 @@ namespace triton {
         //! [python] Callbacks for all concrete memory needs.
         std::list<PyObject*> pyGetConcreteMemoryValueCallbacks;
 
+        //! [python] Callbacks for all concrete memory area needs.
+        std::list<PyObject*> pyGetConcreteMemoryAreaValueCallbacks;
+
+        //! [python] Callbacks for all concrete memory page needs.
+        std::list<PyObject*> pyGetConcreteMemoryPageCallbacks;
+
         //! [python] Callbacks for all concrete register needs.
         std::list<PyObject*> pyGetConcreteRegisterValueCallbacks;
 
@@ -82,6 +105,12 @@ namespace triton {
         //! [c++] Callbacks for all concrete memory needs.
         std::list<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
 
+        //! [c++] Callbacks for all concrete memory area needs.
+        std::list<triton::callbacks::getConcreteMemoryAreaValueCallback> getConcreteMemoryAreaValueCallbacks;
+
+        //! [c++] Callbacks for all concrete memory page needs.
+        std::list<triton::callbacks::getConcreteMemoryPageCallback> getConcreteMemoryPageCallbacks;
+
         //! [c++] Callbacks for all concrete register needs.
         std::list<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
 
@@ -110,6 +139,12 @@ namespace triton {
         //! Adds a GET_CONCRETE_MEMORY_VALUE callback.
         void addCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! Adds a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
+        //! Adds a GET_CONCRETE_MEMORY_PAGE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! Adds a GET_CONCRETE_REGISTER_VALUE callback.
         void addCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
@@ -127,6 +162,12 @@ namespace triton {
         //! Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! Deletes a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
+        //! Deletes a GET_CONCRETE_MEMORY_PAGE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
@@ -146,6 +187,15 @@ namespace triton {
 
         //! Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 pageAddr) const;
+
+        //! Returns true if there is at least one callback of this kind.
+        bool hasCallbacks(triton::callbacks::callback_e kind) const;
     };
 
   /*! @} End of callbacks namespace */
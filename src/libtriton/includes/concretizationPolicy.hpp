@@ -0,0 +1,161 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_CONCRETIZATIONPOLICY_H
+#define TRITON_CONCRETIZATIONPOLICY_H
+
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "memoryAccess.hpp"
+#include "register.hpp"
+#include "symbolicEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! A concretization applied by the concretization policy.
+      struct ConcretizationEvent {
+        //! The reason of the concretization.
+        triton::engines::symbolic::concretization_e reason;
+
+        //! The kind of the concretized location (`REG` or `MEM`).
+        triton::engines::symbolic::symkind_e kind;
+
+        //! The concretized register if `kind` is equal to `REG`.
+        triton::arch::Register reg;
+
+        //! The concretized memory if `kind` is equal to `MEM`.
+        triton::arch::MemoryAccess mem;
+
+        //! The address of the instruction which triggered the concretization.
+        triton::uint64 address;
+
+        //! The index of the instruction which triggered the concretization.
+        triton::uint64 index;
+
+        //! The id of the dropped symbolic expression.
+        triton::usize exprId;
+
+        //! The depth of the dropped expression.
+        triton::uint32 depth;
+
+        //! The number of unrolled nodes of the dropped expression.
+        triton::uint64 nodes;
+
+        //! The number of instructions the location was symbolized for.
+        triton::uint64 age;
+      };
+
+
+      /*! \class ConcretizationPolicy
+          \brief The concretization policy class.
+
+          \description
+          The policy bounds the symbolic state: once an instruction is processed, the registers and the
+          memory it wrote are concretized if their expression exceeds one of the limits, or if a store
+          lands in a registered address range. A limit set to 0 is disabled. Only symbolized expressions
+          are concerned, and each concretization is recorded as a `ConcretizationEvent`.
+      */
+      class ConcretizationPolicy {
+        protected:
+          //! The limits of the policy (0 means disabled).
+          std::map<triton::engines::symbolic::concretization_e, triton::uint64> limits;
+
+          //! The concretization ranges as <start, end> (inclusive).
+          std::list<std::pair<triton::uint64, triton::uint64>> ranges;
+
+          //! The log of concretizations.
+          std::vector<triton::engines::symbolic::ConcretizationEvent> events;
+
+          //! The index of the instruction since which each parent register is symbolized.
+          std::map<triton::uint32, triton::uint64> registerAges;
+
+          //! The index of the instruction since which each memory cell is symbolized.
+          std::map<triton::uint64, triton::uint64> memoryAges;
+
+          //! The number of instructions seen by the policy.
+          triton::uint64 instructionIndex;
+
+          //! Returns true if the node exceeds a limit. `reason` is set according to the first limit exceeded.
+          bool isLimitExceeded(const triton::ast::AbstractNode* node, triton::uint64 age, triton::engines::symbolic::concretization_e& reason) const;
+
+          //! Returns true if the memory area overlaps a concretization range.
+          bool isInConcretizationRange(triton::uint64 addr, triton::uint32 size) const;
+
+        public:
+          //! Constructor.
+          ConcretizationPolicy();
+
+          //! Constructor by copy.
+          ConcretizationPolicy(const ConcretizationPolicy& copy);
+
+          //! Destructor.
+          virtual ~ConcretizationPolicy();
+
+          //! Copies a ConcretizationPolicy.
+          void copy(const ConcretizationPolicy& other);
+
+          //! Returns true if at least one limit or range is defined.
+          bool isConcretizationPolicyEnabled(void) const;
+
+          //! Returns a limit of the policy.
+          triton::uint64 getConcretizationLimit(triton::engines::symbolic::concretization_e kind) const;
+
+          //! Sets a limit of the policy. 0 disables the limit.
+          void setConcretizationLimit(triton::engines::symbolic::concretization_e kind, triton::uint64 limit);
+
+          //! Adds a concretization range [start, end].
+          void addConcretizationRange(triton::uint64 start, triton::uint64 end);
+
+          //! Removes all concretization ranges.
+          void clearConcretizationRanges(void);
+
+          //! Returns the log of concretizations.
+          const std::vector<triton::engines::symbolic::ConcretizationEvent>& getConcretizationEvents(void) const;
+
+          //! Clears the log of concretizations.
+          void clearConcretizationEvents(void);
+
+          //! Copies a ConcretizationPolicy.
+          void operator=(const ConcretizationPolicy& other);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETIZATIONPOLICY_H */
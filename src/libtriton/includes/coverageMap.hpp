@@ -0,0 +1,115 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_COVERAGEMAP_HPP
+#define TRITON_COVERAGEMAP_HPP
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! A branch as <source address, destination address>.
+      typedef std::pair<triton::uint64, triton::uint64> Branch;
+
+      /*! \class CoverageMap
+       *  \brief The branches covered by all workers of an exploration.
+       *
+       *  \description
+       *  The branches are spread over independently locked shards, so the workers rarely wait on
+       *  each other. A branch is also marked once as targeted, so only one worker tries to reach it.
+       */
+      class CoverageMap {
+        private:
+          //! The number of shards.
+          static const triton::usize SHARDS = 64;
+
+          //! Hashes a branch.
+          struct BranchHash {
+            std::size_t operator()(const Branch& branch) const;
+          };
+
+          //! A shard of the map.
+          struct Shard {
+            //! The lock of the shard.
+            std::mutex lock;
+
+            //! The covered branches.
+            std::unordered_set<Branch, BranchHash> covered;
+
+            //! The branches already targeted.
+            std::unordered_set<Branch, BranchHash> targeted;
+          };
+
+          //! The shards.
+          mutable Shard shards[SHARDS];
+
+          //! The number of covered branches.
+          std::atomic<triton::usize> count;
+
+          //! Returns the shard of a branch.
+          Shard& getShard(const Branch& branch) const;
+
+        public:
+          //! Constructor.
+          CoverageMap();
+
+          //! Marks a branch as covered. Returns true if it was not covered yet.
+          bool cover(triton::uint64 srcAddr, triton::uint64 dstAddr);
+
+          //! Returns true if the branch is covered.
+          bool isCovered(triton::uint64 srcAddr, triton::uint64 dstAddr) const;
+
+          //! Marks a branch as targeted. Returns true if it was not covered nor targeted yet.
+          bool target(triton::uint64 srcAddr, triton::uint64 dstAddr);
+
+          //! Returns the number of covered branches.
+          triton::usize size(void) const;
+
+          //! Returns the covered branches.
+          std::vector<Branch> getBranches(void) const;
+
+          //! Clears the map.
+          void clear(void);
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_COVERAGEMAP_HPP */
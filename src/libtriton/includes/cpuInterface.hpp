@@ -8,7 +8,9 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "instruction.hpp"
@@ -66,7 +68,16 @@ namespace triton {
         virtual triton::uint32 numberOfRegisters(void) const = 0;
 
         //! Returns all information about a register id.
-        virtual triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const = 0;
+        virtual const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 regId) const = 0;
+
+        //! Returns the register of the CPU from its ID.
+        virtual triton::arch::Register& getRegister(triton::uint32 regId) = 0;
+
+        //! Returns the program counter of the CPU.
+        virtual triton::arch::Register& getProgramCounter(void) = 0;
+
+        //! Returns the stack pointer of the CPU.
+        virtual triton::arch::Register& getStackPointer(void) = 0;
 
         //! Returns all registers.
         virtual std::set<triton::arch::Register*> getAllRegisters(void) const = 0;
@@ -77,6 +88,15 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         virtual void disassembly(triton::arch::Instruction& inst) const = 0;
 
+        //! Removes the decoded instructions which overlap the range `[baseAddr:size]` from the disassembly cache.
+        virtual void invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size) = 0;
+
+        //! Removes all decoded instructions from the disassembly cache.
+        virtual void clearDisassemblyCache(void) = 0;
+
+        //! Returns the statistics of the disassembly cache (entries, hits and misses).
+        virtual std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const = 0;
+
         //! Returns the concrete value of a memory cell.
         virtual triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const = 0;
 
@@ -134,6 +154,12 @@ namespace triton {
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         virtual void unmapMemory(triton::uint64 baseAddr, triton::usize size=1) = 0;
+
+        //! Returns the sorted base addresses of the memory pages written or unmapped since the last clearDirtyMemoryPages().
+        virtual std::vector<triton::uint64> getDirtyMemoryPages(void) const = 0;
+
+        //! Marks all memory pages as clean.
+        virtual void clearDirtyMemoryPages(void) = 0;
     };
 
   /*! @} End of arch namespace */
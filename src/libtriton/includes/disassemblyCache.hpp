@@ -0,0 +1,108 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DISASSEMBLYCACHE_HPP
+#define TRITON_DISASSEMBLYCACHE_HPP
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "instruction.hpp"
+#include "operandWrapper.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class DisassemblyCache
+     *  \brief The cache of the decoded instructions of a CPU.
+     *
+     *  \description
+     *  Entries are indexed by address and keep the opcodes they were decoded from. A lookup hits
+     *  only if the instruction starts with the same opcodes, so a code modified after its decoding
+     *  is decoded again. Register operands are rebuilt from the instruction's register state.
+     */
+    class DisassemblyCache {
+      private:
+        //! A decoded instruction.
+        struct Entry {
+          //! The opcodes of the instruction.
+          std::vector<triton::uint8> opcodes;
+
+          //! The disassembly of the instruction.
+          std::string disassembly;
+
+          //! The type of the instruction.
+          triton::uint32 type;
+
+          //! The prefix of the instruction.
+          triton::uint32 prefix;
+
+          //! The operands of the instruction.
+          std::vector<triton::arch::OperandWrapper> operands;
+
+          //! True if the instruction is a branch.
+          bool branch;
+
+          //! True if the instruction modifies the control flow.
+          bool controlFlow;
+        };
+
+        //! The entries as <address, entry>.
+        std::unordered_map<triton::uint64, Entry> entries;
+
+        //! The size of the biggest instruction cached.
+        triton::uint32 maxSize;
+
+        //! The number of lookups which hit.
+        triton::usize hits;
+
+        //! The number of lookups which missed.
+        triton::usize misses;
+
+      public:
+        //! Constructor.
+        DisassemblyCache();
+
+        //! Fills `inst` from the cache. Returns false if the instruction is not cached.
+        bool load(triton::arch::Instruction& inst);
+
+        //! Caches a decoded instruction. Replaces the previous entry at the same address.
+        void store(const triton::arch::Instruction& inst);
+
+        //! Removes the entries which overlap the range `[baseAddr:size]`.
+        void invalidate(triton::uint64 baseAddr, triton::usize size);
+
+        //! Removes all entries and resets the statistics.
+        void clear(void);
+
+        //! Returns the statistics of the cache (entries, hits and misses).
+        std::map<std::string, triton::usize> getStats(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DISASSEMBLYCACHE_HPP */
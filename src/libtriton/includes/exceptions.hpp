@@ -155,6 +155,18 @@ namespace triton {
     };
 
 
+    /*! \class ConcretizationPolicy
+     *  \brief The exception class used by the concretization policy. */
+    class ConcretizationPolicy : public triton::exceptions::SymbolicEngine {
+      public:
+        //! Constructor.
+        ConcretizationPolicy(const char* message) : triton::exceptions::SymbolicEngine(message) {};
+
+        //! Constructor.
+        ConcretizationPolicy(const std::string& message) : triton::exceptions::SymbolicEngine(message) {};
+    };
+
+
     /*! \class TaintEngine
      *  \brief The exception class used by the taint engine. */
     class TaintEngine : public triton::exceptions::Engines {
@@ -167,6 +179,18 @@ namespace triton {
     };
 
 
+    /*! \class SnapshotEngine
+     *  \brief The exception class used by the snapshot engine. */
+    class SnapshotEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        SnapshotEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        SnapshotEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class SolverEngine
      *  \brief The exception class used by the solver engine. */
     class SolverEngine : public triton::exceptions::Engines {
@@ -191,6 +215,42 @@ namespace triton {
     };
 
 
+    /*! \class Exploration
+     *  \brief The exception class used by the exploration driver. */
+    class Exploration : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        Exploration(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        Exploration(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
+    /*! \class Replay
+     *  \brief The exception class used by the replay engine. */
+    class Replay : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        Replay(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        Replay(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
+    /*! \class Profiler
+     *  \brief The exception class used by the profiler. */
+    class Profiler : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        Profiler(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        Profiler(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class API
      *  \brief The exception class used by the Triton's API. */
     class API : public triton::exceptions::Exception {
@@ -419,6 +479,18 @@ namespace triton {
     };
 
 
+    /*! \class Trace
+     *  \brief The exception class used by the trace format. */
+    class Trace : public triton::exceptions::Format {
+      public:
+        //! Constructor.
+        Trace(const char* message) : triton::exceptions::Format(message) {};
+
+        //! Constructor.
+        Trace(const std::string& message) : triton::exceptions::Format(message) {};
+    };
+
+
     /*! \class Callbacks
      *  \brief The exception class used by callbacks. */
     class Callbacks : public triton::exceptions::Exception {
@@ -0,0 +1,201 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_EXPLORER_HPP
+#define TRITON_EXPLORER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "api.hpp"
+#include "coverageMap.hpp"
+#include "seedQueue.hpp"
+#include "solverCache.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! The statistics of an exploration.
+      struct ExplorerStats {
+        //! The number of runs.
+        triton::usize runs;
+
+        //! The number of runs which failed with an exception.
+        triton::usize errors;
+
+        //! The number of covered branches.
+        triton::usize branches;
+
+        //! The number of queries.
+        triton::usize queries;
+
+        //! The number of queries answered by the solver cache.
+        triton::usize cacheHits;
+
+        //! The number of seeds waiting to be run.
+        triton::usize pendingSeeds;
+
+        //! The number of seconds since the exploration started.
+        double elapsed;
+
+        //! The number of branches covered per second since the previous report.
+        double coveragePerSecond;
+      };
+
+      /*! \class Explorer
+       *  \brief The parallel exploration driver.
+       *
+       *  \description
+       *  Each worker thread owns an independent API context. For each seed, it calls the setup
+       *  callback, writes and symbolizes the input bytes, runs the code from the entry point and then
+       *  records the branches taken. Each branch not taken and not covered yet is targeted once: its
+       *  constraint is solved under the path prefix and the model gives a new seed. The workers share
+       *  the seed queue, the coverage map and the solver cache.
+       */
+      class Explorer {
+        public:
+          //! Prepares a context before each run: architecture, code, memory and registers.
+          typedef std::function<void(triton::API& ctx)> SetupCallback;
+
+          //! Receives the statistics at each report interval.
+          typedef std::function<void(const ExplorerStats& stats)> ReportCallback;
+
+        private:
+          //! The setup callback.
+          SetupCallback setup;
+
+          //! The report callback.
+          ReportCallback report;
+
+          //! The report interval.
+          std::chrono::milliseconds reportInterval;
+
+          //! The addresses of the symbolic input bytes.
+          std::vector<triton::uint64> inputs;
+
+          //! The entry point of each run.
+          triton::uint64 entry;
+
+          //! The addresses which stop a run.
+          std::set<triton::uint64> stopAddresses;
+
+          //! The maximum number of instructions of a run (0 if unlimited).
+          triton::usize maxInstructions;
+
+          //! The maximum number of runs (0 if unlimited).
+          triton::usize maxRuns;
+
+          //! The number of workers.
+          triton::usize workers;
+
+          //! The initial seeds.
+          std::vector<Seed> initialSeeds;
+
+          //! The seeds which have covered new branches.
+          std::vector<Seed> seeds;
+
+          //! The lock of the seeds.
+          mutable std::mutex seedsLock;
+
+          //! The coverage map.
+          CoverageMap coverage;
+
+          //! The solver cache.
+          SolverCache solverCache;
+
+          //! The number of runs.
+          std::atomic<triton::usize> runs;
+
+          //! The number of failed runs.
+          std::atomic<triton::usize> errors;
+
+          //! The number of queries.
+          std::atomic<triton::usize> queries;
+
+          //! The number of queries answered by the cache.
+          std::atomic<triton::usize> cacheHits;
+
+          //! Runs the seeds of a worker until the exploration is over.
+          void work(SeedQueue& queue, triton::usize worker);
+
+          //! Runs one seed and pushes the new seeds.
+          void run(triton::API& ctx, SeedQueue& queue, triton::usize worker, const Seed& seed);
+
+          //! Returns the model of a query, from the cache if possible.
+          std::map<triton::uint32, triton::engines::solver::SolverModel> solve(triton::API& ctx, triton::ast::AbstractNode* query);
+
+          //! Returns the current statistics.
+          ExplorerStats getStats(const SeedQueue& queue, std::chrono::steady_clock::time_point start) const;
+
+        public:
+          //! Constructor. `inputs` are the addresses of the symbolic input bytes.
+          Explorer(const SetupCallback& setup, const std::vector<triton::uint64>& inputs, triton::uint64 entry);
+
+          //! Adds an initial seed. Without any, the exploration starts from a zeroed input.
+          void addSeed(const Seed& seed);
+
+          //! Adds an address which stops the runs.
+          void addStopAddress(triton::uint64 addr);
+
+          //! Sets the maximum number of instructions of a run (0 if unlimited).
+          void setMaxInstructions(triton::usize limit);
+
+          //! Sets the maximum number of runs of the exploration (0 if unlimited).
+          void setMaxRuns(triton::usize limit);
+
+          //! Sets the number of workers (0 for the number of hardware threads).
+          void setWorkers(triton::usize workers);
+
+          //! Sets the report callback and its interval.
+          void setReportCallback(const ReportCallback& report, std::chrono::milliseconds interval=std::chrono::milliseconds(1000));
+
+          //! Explores until no seed is left or the maximum number of runs is reached. Returns the final statistics.
+          ExplorerStats explore(void);
+
+          //! Returns the covered branches.
+          std::vector<Branch> getCoverage(void) const;
+
+          //! Returns the seeds which have covered new branches, the initial ones included.
+          std::vector<Seed> getSeeds(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORER_HPP */
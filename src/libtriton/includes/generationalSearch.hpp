@@ -0,0 +1,198 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_GENERATIONALSEARCH_HPP
+#define TRITON_GENERATIONALSEARCH_HPP
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "api.hpp"
+#include "coverageMap.hpp"
+#include "seedQueue.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! A seed waiting to be expanded by a generational search.
+      struct SearchNode {
+        //! The seed.
+        Seed seed;
+
+        //! The index of the first symbolized branch which may be negated.
+        triton::usize bound;
+
+        //! The generation of the seed (0 for the initial seeds).
+        triton::usize generation;
+
+        //! The number of branches covered for the first time by the seed.
+        triton::usize newBranches;
+
+        //! True once the seed has run. Only the initial seeds wait for their expansion to run.
+        bool executed;
+
+        //! The seeds given by negating the branches of its run, with their bounds.
+        std::vector<std::pair<Seed, triton::usize>> children;
+
+        //! The score of the seed, the best one is expanded first.
+        double score;
+
+        //! The creation order of the node, the oldest one wins a tie.
+        triton::usize id;
+      };
+
+      /*! \class GenerationalSearch
+       *  \brief The generational search strategy.
+       *
+       *  \description
+       *  Expanding a seed runs it, then negates each symbolized branch of its path from its bound on,
+       *  one at a time, under the constraints of the branches taken before it. Each model gives a
+       *  child, whose bound is the index of the negated branch plus one, so the branches already
+       *  negated by its ancestors are never negated again. A path prefix is negated only once over the
+       *  whole search. Each seed runs exactly once: the run of a child scores it, by default by the
+       *  number of branches it covers first, and solves its own negated branches, whose models are
+       *  kept with it until it is expanded. The best scored seed is expanded next. The state can be
+       *  saved and loaded to resume a search.
+       */
+      class GenerationalSearch {
+        public:
+          //! Prepares the context before each run: architecture, code, memory and registers.
+          typedef std::function<void(triton::API& ctx)> SetupCallback;
+
+          //! Returns the score of a seed.
+          typedef std::function<double(const SearchNode& node)> ScoringCallback;
+
+        private:
+          //! The context of the runs.
+          triton::API& ctx;
+
+          //! The setup callback.
+          SetupCallback setup;
+
+          //! The scoring callback.
+          ScoringCallback scoring;
+
+          //! The addresses of the symbolic input bytes.
+          std::vector<triton::uint64> inputs;
+
+          //! The entry point of each run.
+          triton::uint64 entry;
+
+          //! The addresses which stop a run.
+          std::set<triton::uint64> stopAddresses;
+
+          //! The maximum number of instructions of a run (0 if unlimited).
+          triton::usize maxInstructions;
+
+          //! The seeds to expand, as a heap on their score.
+          std::vector<SearchNode> nodes;
+
+          //! The hashes of the path prefixes already negated.
+          std::unordered_set<triton::uint64> prefixes;
+
+          //! The covered branches.
+          CoverageMap coverage;
+
+          //! The seeds which have covered new branches.
+          std::vector<Seed> seeds;
+
+          //! The number of runs.
+          triton::usize runs;
+
+          //! The number of queries.
+          triton::usize queries;
+
+          //! The id of the next node.
+          triton::usize nextId;
+
+          //! Runs a node. Sets its number of new branches and its children.
+          void execute(SearchNode& node);
+
+          //! Scores a node and pushes it. The initial seeds get an infinite score.
+          void push(SearchNode& node);
+
+        public:
+          //! Constructor. `inputs` are the addresses of the symbolic input bytes.
+          GenerationalSearch(triton::API& ctx, const SetupCallback& setup, const std::vector<triton::uint64>& inputs, triton::uint64 entry);
+
+          //! Adds an initial seed, expanded before the generated ones. Without any, the search starts from a zeroed input.
+          void addSeed(const Seed& seed);
+
+          //! Adds an address which stops the runs.
+          void addStopAddress(triton::uint64 addr);
+
+          //! Sets the maximum number of instructions of a run (0 if unlimited).
+          void setMaxInstructions(triton::usize limit);
+
+          //! Sets the scoring callback. The default score is the number of new branches.
+          void setScoringCallback(const ScoringCallback& scoring);
+
+          //! Expands the best seed. Returns false if no seed is left.
+          bool step(void);
+
+          //! Expands the seeds until none is left or `maxRuns` runs are done (0 if unlimited). Returns the number of runs.
+          triton::usize explore(triton::usize maxRuns=0);
+
+          //! Returns the number of seeds waiting to be expanded.
+          triton::usize getPendingSeeds(void) const;
+
+          //! Returns the number of runs.
+          triton::usize getRuns(void) const;
+
+          //! Returns the number of queries.
+          triton::usize getQueries(void) const;
+
+          //! Returns the covered branches.
+          std::vector<Branch> getCoverage(void) const;
+
+          //! Returns the seeds which have covered new branches.
+          std::vector<Seed> getSeeds(void) const;
+
+          //! Saves the state of the search. The scores are not saved, they are computed again by loadState().
+          void saveState(std::ostream& stream) const;
+
+          //! Loads a state saved by saveState(). The current state is replaced.
+          void loadState(std::istream& stream);
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_GENERATIONALSEARCH_HPP */
@@ -37,9 +37,6 @@ namespace triton {
         //! The value of the operand.
         triton::uint64 value;
 
-        //! Copy an Immediate.
-        void copy(const Immediate& other);
-
       public:
         //! Constructor.
         Immediate();
@@ -47,12 +44,6 @@ namespace triton {
         //! Constructor.
         Immediate(triton::uint64 value, triton::uint32 size /* bytes*/);
 
-        //! Constructor by copy.
-        Immediate(const Immediate& other);
-
-        //! Destructor.
-        virtual ~Immediate();
-
         //! Returns the value of the operand.
         triton::uint64 getValue(void) const;
 
@@ -73,9 +64,6 @@ namespace triton {
 
         //! Sets the value of the operand.
         void setValue(triton::uint64 v);
-
-        //! Copy an Immediate.
-        void operator=(const Immediate& other);
     };
 
     //! Displays an Immediate.
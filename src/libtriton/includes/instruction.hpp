@@ -8,10 +8,8 @@
 #ifndef TRITON_INSTRUCTION_H
 #define TRITON_INSTRUCTION_H
 
-#include <list>
-#include <map>
 #include <ostream>
-#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -41,6 +39,10 @@ namespace triton {
 
     /*! \class Instruction
      *  \brief This class is used when to represent an instruction
+     *
+     *  \description
+     *  The containers of an instruction are flat vectors. reset() clears them but keeps their
+     *  capacity, so an instruction reused for each processing does not allocate once warmed up.
      */
     class Instruction {
 
@@ -52,7 +54,7 @@ namespace triton {
         triton::uint64 address;
 
         //! The disassembly of the instruction. This field is set at the disassembly level.
-        std::stringstream disassembly;
+        std::string disassembly;
 
         //! The opcodes of the instruction.
         triton::uint8 opcodes[32];
@@ -66,20 +68,20 @@ namespace triton {
         //! The prefix of the instruction. This field is set at the disassembly level.
         triton::uint32 prefix;
 
-        //! Implicit and explicit load access (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> loadAccess;
+        //! Implicit and explicit load access (read), sorted and unique. This field is set at the semantics level.
+        std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> loadAccess;
 
-        //! Implicit and explicit store access (write). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> storeAccess;
+        //! Implicit and explicit store access (write), sorted and unique. This field is set at the semantics level.
+        std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> storeAccess;
 
-        //! Implicit and explicit register inputs (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> readRegisters;
+        //! Implicit and explicit register inputs (read), sorted and unique. This field is set at the semantics level.
+        std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> readRegisters;
 
-        //! Implicit and explicit register outputs (write). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> writtenRegisters;
+        //! Implicit and explicit register outputs (write), sorted and unique. This field is set at the semantics level.
+        std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> writtenRegisters;
 
-        //! Implicit and explicit immediate inputs (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>> readImmediates;
+        //! Implicit and explicit immediate inputs (read), sorted and unique. This field is set at the semantics level.
+        std::vector<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>> readImmediates;
 
         //! True if this instruction is a branch. This field is set at the disassembly level.
         bool branch;
@@ -98,13 +100,13 @@ namespace triton {
 
       public:
         //! The memory access list
-        std::list<triton::arch::MemoryAccess> memoryAccess;
+        std::vector<triton::arch::MemoryAccess> memoryAccess;
 
         //! A registers state
         /*!
-          \brief a map of <regId, regClass>
+          \brief a list of registers sorted by id, one per id
         */
-        std::map<triton::uint32, triton::arch::Register> registerState;
+        std::vector<triton::arch::Register> registerState;
 
         //! A list of operands
         std::vector<triton::arch::OperandWrapper> operands;
@@ -143,7 +145,7 @@ namespace triton {
         void setAddress(triton::uint64 addr);
 
         //! Returns the disassembly of the instruction.
-        std::string getDisassembly(void) const;
+        const std::string& getDisassembly(void) const;
 
         //! Returns the opcodes of the instruction.
         const triton::uint8* getOpcodes(void) const;
@@ -155,19 +157,19 @@ namespace triton {
         triton::uint32 getPrefix(void) const;
 
         //! Returns the list of all implicit and explicit load access
-        const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getLoadAccess(void) const;
+        const std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getLoadAccess(void) const;
 
         //! Returns the list of all implicit and explicit store access
-        const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getStoreAccess(void) const;
+        const std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getStoreAccess(void) const;
 
         //! Returns the list of all implicit and explicit register (flags includes) inputs (read)
-        const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getReadRegisters(void) const;
+        const std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getReadRegisters(void) const;
 
         //! Returns the list of all implicit and explicit register (flags includes) outputs (write)
-        const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getWrittenRegisters(void) const;
+        const std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getWrittenRegisters(void) const;
 
         //! Returns the list of all implicit and explicit immediate inputs (read)
-        const std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& getReadImmediates(void) const;
+        const std::vector<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& getReadImmediates(void) const;
 
         //! Returns the register state which has been recorded.
         triton::arch::Register getRegisterState(triton::uint32 regId);
@@ -250,7 +252,7 @@ namespace triton {
         //! Sets flag to define if the condition is taken or not.
         void setConditionTaken(bool flag);
 
-        //! Resets all instruction information.
+        //! Resets all instruction information. The capacity of the containers is kept for the next processing.
         void reset(void);
 
         //! Resets partially instruction information. All except memory and register states.
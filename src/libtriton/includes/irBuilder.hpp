@@ -8,12 +8,17 @@
 #ifndef TRITON_IRBUILDER_H
 #define TRITON_IRBUILDER_H
 
+#include <map>
+#include <set>
+#include <string>
+
 #include "architecture.hpp"
 #include "astGarbageCollector.hpp"
 #include "instruction.hpp"
 #include "semanticsInterface.hpp"
 #include "symbolicEngine.hpp"
 #include "taintEngine.hpp"
+#include "x86ConcreteSemantics.hpp"
 
 
 
@@ -51,6 +56,24 @@ namespace triton {
         //! Taint Engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
+        //! True if the fast-forward mode is enabled.
+        bool fastForwardFlag;
+
+        //! The addresses which stop the fast-forward mode.
+        std::set<triton::uint64> fastForwardStops;
+
+        //! The number of instructions after which the fast-forward mode stops (0 if unlimited).
+        triton::usize fastForwardLimit;
+
+        //! The number of instructions processed in fast-forward mode.
+        triton::usize fastForwardCount;
+
+        //! Executes the instruction on the concrete state only. Returns false if the instruction must be processed symbolically.
+        bool fastForward(triton::arch::Instruction& inst);
+
+        //! Copies the taint of each multi-byte memory store to its byte references.
+        void spreadMemoryTaint(triton::arch::Instruction& inst);
+
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes);
 
@@ -58,6 +81,9 @@ namespace triton {
         //! x86 ISA builder.
         triton::arch::SemanticsInterface* x86Isa;
 
+        //! x86 concrete-only semantics.
+        triton::arch::x86::x86ConcreteSemantics* x86ConcreteIsa;
+
       public:
         //! Constructor.
         IrBuilder(triton::arch::Architecture* architecture,
@@ -71,6 +97,30 @@ namespace triton {
         //! Builds the semantics of the instruction. Returns true if the instruction is supported.
         bool buildSemantics(triton::arch::Instruction& inst);
 
+        //! Clears the semantics templates.
+        void clearSemanticsTemplates(void);
+
+        //! Returns the statistics of the semantics templates (entries, hits and misses).
+        std::map<std::string, triton::usize> getSemanticsTemplatesStats(void) const;
+
+        //! Enables or disables the fast-forward mode. Enabling the mode resets the number of instructions processed.
+        void enableFastForward(bool flag);
+
+        //! Returns true if the fast-forward mode is enabled.
+        bool isFastForwardEnabled(void) const;
+
+        //! Stops the fast-forward mode when the instruction at `addr` is reached.
+        void addFastForwardStop(triton::uint64 addr);
+
+        //! Removes all addresses which stop the fast-forward mode.
+        void clearFastForwardStops(void);
+
+        //! Stops the fast-forward mode after `limit` instructions (0 if unlimited).
+        void setFastForwardLimit(triton::usize limit);
+
+        //! Returns the number of instructions processed in fast-forward mode.
+        triton::usize getFastForwardCount(void) const;
+
         //! Everything which must be done before buiding the semantics
         void preIrInit(triton::arch::Instruction& inst);
 
@@ -62,11 +62,20 @@ namespace triton {
         //! LEA - If the operand has a scale, this attribute is filled.
         triton::arch::Immediate scale;
 
-        //! The AST of the memory access.
-        triton::ast::AbstractNode* ast;
+        //! The AST of the memory access. Built on demand if the address does not depend on a symbolized register.
+        mutable triton::ast::AbstractNode* ast;
 
-        //! Copy a MemoryAccess.
-        void copy(const MemoryAccess& other);
+        //! LEA - The concrete value of the segment register when the address has been initialized.
+        triton::uint64 leaSegment;
+
+        //! LEA - The concrete value of the base when the address has been initialized.
+        triton::uint64 leaBase;
+
+        //! LEA - The concrete value of the index register when the address has been initialized.
+        triton::uint64 leaIndex;
+
+        //! LEA - True if the AST of the memory access may be built on demand from the concrete values.
+        bool leaConcrete;
 
       private:
         //! LEA - Returns the base register value.
@@ -79,16 +88,22 @@ namespace triton {
         triton::uint64 getSegmentValue(void);
 
         //! LEA - Returns the scale immediate value.
-        triton::uint64 getScaleValue(void);
+        triton::uint64 getScaleValue(void) const;
 
         //! LEA - Returns the displacement immediate value.
-        triton::uint64 getDisplacementValue(void);
+        triton::uint64 getDisplacementValue(void) const;
 
         //! LEA - Returns the mask of the memory access based on the CPU architecture.
         triton::uint64 getAccessMask(void);
 
         //! LEA - Returns the size of the memory access.
-        triton::uint32 getAccessSize(void);
+        triton::uint32 getAccessSize(void) const;
+
+        //! LEA - Builds the AST of the memory access from the base and index nodes.
+        triton::ast::AbstractNode* buildLeaAst(triton::ast::AbstractNode* base, triton::ast::AbstractNode* index) const;
+
+        //! LEA - Returns the address computed from the concrete values.
+        triton::uint64 computeConcreteAddress(void) const;
 
       public:
         //! Constructor.
@@ -97,18 +112,15 @@ namespace triton {
         //! Constructor.
         MemoryAccess(triton::uint64 address, triton::uint32 size /* bytes */, triton::uint512 concreteValue=0);
 
-        //! Constructor by copy.
-        MemoryAccess(const MemoryAccess& other);
-
-        //! Destructor.
-        virtual ~MemoryAccess();
-
-        //! Initialize the address of the memory.
+        //! Initialize the address of the memory. The AST of the memory access is built only if the base or the index is symbolized.
         void initAddress(void);
 
-        //! Returns the AST of the memory access (LEA).
+        //! Returns the AST of the memory access (LEA). The AST is built on the first call if the address has been computed concretely.
         triton::ast::AbstractNode* getLeaAst(void) const;
 
+        //! Returns true if the AST of the memory access (LEA) has already been built.
+        bool isLeaAstBuilt(void) const;
+
         //! Returns the address of the memory.
         triton::uint64 getAddress(void) const;
 
@@ -189,9 +201,6 @@ namespace triton {
 
         //! LEA - Sets the scale operand.
         void setScale(triton::arch::Immediate& scale);
-
-        //! Copies a MemoryAccess.
-        void operator=(const MemoryAccess& other);
    };
 
     //! Displays an MemoryAccess.
@@ -57,9 +57,6 @@ namespace triton {
         //! Register constructor.
         OperandWrapper(const triton::arch::Register& reg);
 
-        //! Destructor.
-        virtual ~OperandWrapper();
-
         //! Returns the abstract type of the operand.
         triton::uint32 getType(void) const;
 
@@ -104,9 +101,6 @@ namespace triton {
 
         //! Returns the abstract concrete value.
         triton::uint512 getConcreteValue(void) const;
-
-        //! Copies a OperandWrapper.
-        void operator=(const OperandWrapper& other);
     };
 
     //! Displays a OperandWrapper according to the concrete type.
@@ -0,0 +1,135 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGEDMEMORY_HPP
+#define TRITON_PAGEDMEMORY_HPP
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The number of bits of a page offset.
+    const triton::uint32 PAGE_SHIFT = 12;
+
+    //! The size of a page (4 KiB).
+    const triton::uint64 PAGE_SIZE = (1ULL << PAGE_SHIFT);
+
+    /*! \class PagedMemory
+     *  \brief The sparse concrete memory of a CPU.
+     *
+     *  \description
+     *  The memory is split into 4 KiB pages allocated on the first write. Each page keeps a
+     *  bitmap of its mapped bytes, so a byte is mapped only once it has been written, as with a
+     *  per-byte map. Area accesses copy whole page chunks.
+     */
+    class PagedMemory {
+      private:
+        //! A page of memory.
+        struct Page {
+          //! The concrete values.
+          triton::uint8 data[PAGE_SIZE];
+
+          //! The bitmap of the mapped bytes.
+          triton::uint64 mapped[PAGE_SIZE / 64];
+
+          //! True if the page has been written or unmapped since the last clearDirtyPages().
+          bool dirty;
+        };
+
+        //! The pages as <page number, page>.
+        std::unordered_map<triton::uint64, Page*> pages;
+
+        //! The number of the last page looked up.
+        mutable triton::uint64 lastNumber;
+
+        //! The last page looked up (nullptr if none).
+        mutable Page* lastPage;
+
+        //! The numbers of the pages freed since the last clearDirtyPages().
+        std::unordered_set<triton::uint64> released;
+
+        //! Returns the page of an address, nullptr if the page is not allocated.
+        Page* findPage(triton::uint64 addr) const;
+
+        //! Returns the page of an address, allocates it if needed.
+        Page* getPage(triton::uint64 addr);
+
+        //! Frees a page.
+        void freePage(triton::uint64 number);
+
+      public:
+        //! Constructor.
+        PagedMemory();
+
+        //! Constructor by copy.
+        PagedMemory(const PagedMemory& other);
+
+        //! Destructor.
+        ~PagedMemory();
+
+        //! Copies a PagedMemory.
+        PagedMemory& operator=(const PagedMemory& other);
+
+        //! Frees all pages.
+        void clear(void);
+
+        //! Returns the number of allocated pages.
+        triton::usize getNumberOfPages(void) const;
+
+        //! Returns the concrete value of a memory cell (0 if the cell is not mapped).
+        triton::uint8 read(triton::uint64 addr) const;
+
+        //! Copies `size` bytes from the memory into `area`. Unmapped cells are read as 0.
+        void read(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const;
+
+        //! Sets the concrete value of a memory cell.
+        void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Copies `size` bytes from `area` into the memory.
+        void write(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
+        //! Returns true if the range `[baseAddr:size]` is mapped.
+        bool isMapped(triton::uint64 baseAddr, triton::usize size) const;
+
+        //! Returns true if a cell of the page of `addr` is mapped.
+        bool isPageMapped(triton::uint64 addr) const;
+
+        //! Removes the range `[baseAddr:size]`. Empty pages are freed.
+        void unmap(triton::uint64 baseAddr, triton::usize size);
+
+        //! Returns the sorted base addresses of the pages written, unmapped or freed since the last clearDirtyPages().
+        std::vector<triton::uint64> getDirtyPages(void) const;
+
+        //! Marks all pages as clean.
+        void clearDirtyPages(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMEMORY_HPP */
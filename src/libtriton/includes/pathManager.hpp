@@ -50,6 +50,12 @@ namespace triton {
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
 
+          //! Defines if cleared path constraints must be journaled (used by snapshots).
+          bool pathConstraintsJournaling;
+
+          //! The journal of cleared path constraints.
+          std::vector<std::vector<triton::engines::symbolic::PathConstraint>> pathConstraintsJournal;
+
         public:
           //! Constructor.
           PathManager();
@@ -0,0 +1,303 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PROFILER_H
+#define TRITON_PROFILER_H
+
+#include <chrono>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "instruction.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Profiling namespace
+    namespace profiling {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup profiling
+     *  @{
+     */
+
+      //! The instrumented stages of the processing.
+      enum stage_e {
+        STAGE_PROCESSING = 0,   //!< The processing of an instruction as a whole.
+        STAGE_DISASSEMBLY,      //!< The decoding of an instruction.
+        STAGE_FAST_FORWARD,     //!< The concrete-only execution.
+        STAGE_SEMANTICS,        //!< The semantics builder.
+        STAGE_SIMPLIFICATION,   //!< The simplification callbacks.
+        STAGE_AST_RECORDING,    //!< The recording of the new AST nodes.
+        STAGE_TAINT,            //!< The taint spreading.
+        STAGE_POST_IR,          //!< The post IR processing and the AST garbage collection.
+        STAGE_LAST_ITEM,        //!< Must be the last item.
+      };
+
+      //! The counters of a stage.
+      struct StageProfile {
+        //! The number of times the stage has been entered.
+        triton::usize calls;
+
+        //! The cycles spent in the stage, nested stages excluded.
+        triton::uint64 cycles;
+
+        //! The cycles spent in the stage, nested stages included.
+        triton::uint64 totalCycles;
+      };
+
+      //! The counters of an opcode.
+      struct OpcodeProfile {
+        //! The number of instructions processed.
+        triton::usize count;
+
+        //! The number of AST nodes recorded while processing the instructions.
+        triton::usize nodes;
+
+        //! The number of symbolic expressions created while processing the instructions.
+        triton::usize expressions;
+
+        //! The cycles spent processing the instructions.
+        triton::uint64 cycles;
+      };
+
+      //! A stage recorded for the trace-event export.
+      struct TraceEvent {
+        //! The stage.
+        stage_e stage;
+
+        //! The cycle counter when the stage has been entered.
+        triton::uint64 start;
+
+        //! The cycle counter when the stage has been left.
+        triton::uint64 end;
+
+        //! The address of the instruction (processing stage only).
+        triton::uint64 address;
+
+        //! The opcode of the instruction (processing stage only).
+        triton::uint32 type;
+      };
+
+      //! The maximum number of events recorded for the trace-event export.
+      const triton::usize TRACE_MAX_EVENTS = 0x100000;
+
+      /*! \class Profiler
+       *  \brief The hot-path instrumentation of a context.
+       *
+       *  \description
+       *  The stages of the processing are timed with the cycle counter of the CPU (a nanosecond clock
+       *  on other hosts). A stage entered within another one is accounted to the inner stage only, and
+       *  to the total of both. The hooks are compiled in the library only if it is built with
+       *  `TRITON_PROFILING`, otherwise all counters stay at zero.
+       */
+      class Profiler {
+        private:
+          //! The counters of the stages.
+          StageProfile stages[STAGE_LAST_ITEM];
+
+          //! The counters of the opcodes.
+          std::map<triton::uint32, OpcodeProfile> opcodes;
+
+          //! The stages currently entered, innermost last.
+          std::vector<stage_e> active;
+
+          //! The cycle counter at the last stage switch.
+          triton::uint64 last;
+
+          //! The number of AST nodes recorded.
+          triton::usize nodes;
+
+          //! The number of symbolic expressions created.
+          triton::usize expressions;
+
+          //! The number of symbolic variables created.
+          triton::usize variables;
+
+          //! True if the events are recorded for the trace-event export.
+          bool tracing;
+
+          //! The recorded events.
+          std::vector<TraceEvent> events;
+
+          //! The number of events dropped once TRACE_MAX_EVENTS has been reached.
+          triton::usize dropped;
+
+          //! The cycle counter at the last reset.
+          triton::uint64 originCycles;
+
+          //! The time at the last reset.
+          std::chrono::steady_clock::time_point originTime;
+
+          //! Records an event.
+          void record(stage_e stage, triton::uint64 start, triton::uint64 end, triton::uint64 address, triton::uint32 type);
+
+        public:
+          //! Constructor.
+          Profiler();
+
+          //! Returns true if the library has been built with the profiling hooks.
+          static bool isAvailable(void);
+
+          //! Returns the current value of the cycle counter.
+          static triton::uint64 cycles(void);
+
+          //! Returns the name of a stage.
+          static const char* getStageName(stage_e stage);
+
+          //! Enters a stage. Returns the current value of the cycle counter.
+          triton::uint64 enter(stage_e stage);
+
+          //! Leaves the innermost stage, entered at `start`.
+          void leave(stage_e stage, triton::uint64 start);
+
+          //! Leaves the processing stage of an instruction, entered at `start` when `nodes` and `expressions` were recorded.
+          void leave(const triton::arch::Instruction& inst, triton::uint64 start, triton::usize nodes, triton::usize expressions);
+
+          //! Counts a recorded AST node.
+          void recordNode(void);
+
+          //! Counts a new symbolic expression.
+          void recordExpression(void);
+
+          //! Counts a new symbolic variable.
+          void recordVariable(void);
+
+          //! Returns the counters of a stage.
+          const StageProfile& getStage(stage_e stage) const;
+
+          //! Returns the counters of the opcodes.
+          const std::map<triton::uint32, OpcodeProfile>& getOpcodes(void) const;
+
+          //! Returns the number of AST nodes recorded.
+          triton::usize getNodes(void) const;
+
+          //! Returns the number of symbolic expressions created.
+          triton::usize getExpressions(void) const;
+
+          //! Returns the number of symbolic variables created.
+          triton::usize getVariables(void) const;
+
+          //! Returns the counters as <name, value>. The stage counters are named `<stage>.calls`, `<stage>.cycles` and `<stage>.totalCycles`.
+          std::map<std::string, triton::uint64> getStats(void) const;
+
+          //! Enables or disables the recording of the events for the trace-event export.
+          void enableTrace(bool flag);
+
+          //! Returns true if the events are recorded.
+          bool isTraceEnabled(void) const;
+
+          //! Writes the recorded events in the Chrome trace-event JSON format.
+          void exportTrace(std::ostream& out) const;
+
+          //! Resets all counters and drops the recorded events.
+          void reset(void);
+      };
+
+      /*! \class StageScope
+       *  \brief Accounts the lifetime of the scope to a stage. */
+      class StageScope {
+        private:
+          //! The profiler.
+          Profiler& profiler;
+
+          //! The stage.
+          stage_e stage;
+
+          //! The cycle counter when the stage has been entered.
+          triton::uint64 start;
+
+        public:
+          //! Constructor. Enters the stage.
+          StageScope(Profiler& profiler, stage_e stage) : profiler(profiler), stage(stage) {
+            this->start = profiler.enter(stage);
+          }
+
+          //! Destructor. Leaves the stage.
+          ~StageScope() {
+            this->profiler.leave(this->stage, this->start);
+          }
+      };
+
+      /*! \class InstructionScope
+       *  \brief Accounts the lifetime of the scope to the processing of an instruction and its opcode. */
+      class InstructionScope {
+        private:
+          //! The profiler.
+          Profiler& profiler;
+
+          //! The instruction.
+          const triton::arch::Instruction& inst;
+
+          //! The cycle counter when the processing has been entered.
+          triton::uint64 start;
+
+          //! The number of AST nodes recorded when the processing has been entered.
+          triton::usize nodes;
+
+          //! The number of symbolic expressions created when the processing has been entered.
+          triton::usize expressions;
+
+        public:
+          //! Constructor. Enters the processing stage.
+          InstructionScope(Profiler& profiler, const triton::arch::Instruction& inst) : profiler(profiler), inst(inst) {
+            this->nodes       = profiler.getNodes();
+            this->expressions = profiler.getExpressions();
+            this->start       = profiler.enter(STAGE_PROCESSING);
+          }
+
+          //! Destructor. Leaves the processing stage.
+          ~InstructionScope() {
+            this->profiler.leave(this->inst, this->start, this->nodes, this->expressions);
+          }
+      };
+
+    /*! @} End of profiling namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+
+//! Names a profiling scope after its line.
+#define TRITON_PROFILE_NAME_CONCAT(prefix, line) prefix##line
+#define TRITON_PROFILE_NAME(line) TRITON_PROFILE_NAME_CONCAT(profileScope, line)
+
+#if defined(TRITON_PROFILING)
+  //! Accounts the rest of the enclosing block to a stage.
+  #define TRITON_PROFILE_STAGE(profiler, stage) triton::engines::profiling::StageScope TRITON_PROFILE_NAME(__LINE__)(profiler, stage)
+
+  //! Accounts the rest of the enclosing block to the processing of an instruction.
+  #define TRITON_PROFILE_INSTRUCTION(profiler, inst) triton::engines::profiling::InstructionScope TRITON_PROFILE_NAME(__LINE__)(profiler, inst)
+
+  //! Runs a profiler statement.
+  #define TRITON_PROFILE_COUNT(statement) statement
+#else
+  #define TRITON_PROFILE_STAGE(profiler, stage)
+  #define TRITON_PROFILE_INSTRUCTION(profiler, inst)
+  #define TRITON_PROFILE_COUNT(statement)
+#endif
+
+#endif /* TRITON_PROFILER_H */
@@ -87,6 +87,9 @@ namespace triton {
       //! Initializes the CALLBACK python namespace.
       void initCallbackNamespace(PyObject* callbackDict);
 
+      //! Initializes the CONCRETIZATION python namespace.
+      void initConcretizationNamespace(PyObject* concretizationDict);
+
       //! Initializes the CPUSIZE python namespace.
       void initCpuSizeNamespace(void);
 
@@ -14,6 +14,7 @@
 #include "bitsVector.hpp"
 #include "cpuSize.hpp"
 #include "operandInterface.hpp"
+#include "registerSpecification.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -35,13 +36,16 @@ namespace triton {
 
     /*! \class Register
      *  \brief This class is used when an instruction has a register operand.
+     *
+     *  \description
+     *  A register only holds its id, its parent id, its bits vector, its concrete value and a pointer to
+     *  its specification. The specification is resolved once, from the architecture of the context which
+     *  builds the register, and lives as long as the program. So a register is copied without any
+     *  allocation and its name does not depend on the current context.
      */
     class Register : public BitsVector, public OperandInterface {
 
       protected:
-        //! The name of the register.
-        std::string name;
-
         //! The id of the register.
         triton::uint32 id;
 
@@ -51,8 +55,8 @@ namespace triton {
         //! The concrete value (content of the register)
         triton::uint512 concreteValue;
 
-        //! Copies a Register.
-        void copy(const Register& other);
+        //! The specification of the register (nullptr if the register has been built without architecture).
+        const triton::arch::RegisterSpecification* specification;
 
         //! Setup everything.
         void setup(triton::uint32 regId, triton::uint512 concreteValue);
@@ -67,12 +71,6 @@ namespace triton {
         //! Constructor.
         Register(triton::uint32 regId, triton::uint512 concreteValue=0);
 
-        //! Constructor by copy.
-        Register(const Register& other);
-
-        //! Destructor.
-        virtual ~Register();
-
         //! Returns the parent id of the register.
         Register getParent(void) const;
 
@@ -109,9 +107,6 @@ namespace triton {
         //! Returns the concrete value.
         triton::uint512 getConcreteValue(void) const;
 
-        //! Copies a Register.
-        void operator=(const Register& other);
-
         //! Sets the id of the register.
         void setId(triton::uint32 regId);
 
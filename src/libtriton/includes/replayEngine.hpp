@@ -0,0 +1,87 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_REPLAYENGINE_H
+#define TRITON_REPLAYENGINE_H
+
+#include <functional>
+#include <string>
+
+#include "api.hpp"
+#include "instruction.hpp"
+#include "traceReader.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Replay namespace
+    namespace replay {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup replay
+     *  @{
+     */
+
+      /*! \class ReplayEngine
+       *  \brief Replays a binary trace file on a context.
+       *
+       *  \description
+       *  Each record of the trace is read into an instruction whose `registerState` and
+       *  `memoryAccess` lists hold the recorded values, then the instruction is processed. The
+       *  concrete state of the context is thus updated with the recorded values before the semantics
+       *  of each instruction is built. The architecture of the context is set from the trace if it
+       *  is not set yet.
+       */
+      class ReplayEngine {
+        public:
+          //! Called after each processed instruction.
+          typedef std::function<void(triton::API& ctx, triton::arch::Instruction& inst)> InstructionCallback;
+
+        private:
+          //! The context of the replay.
+          triton::API& ctx;
+
+          //! The instruction callback.
+          InstructionCallback callback;
+
+        public:
+          //! Constructor.
+          ReplayEngine(triton::API& ctx);
+
+          //! Sets the callback called after each processed instruction.
+          void setCallback(const InstructionCallback& callback);
+
+          //! Replays the trace file at `path`, up to `maxInstructions` instructions (0 if unlimited). Returns the number of instructions processed.
+          triton::usize replay(const std::string& path, triton::usize maxInstructions=0);
+
+          //! Replays the next instructions of a trace reader, up to `maxInstructions` instructions (0 if unlimited). Returns the number of instructions processed.
+          triton::usize replay(triton::format::trace::TraceReader& reader, triton::usize maxInstructions=0);
+      };
+
+    /*! @} End of replay namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REPLAYENGINE_H */
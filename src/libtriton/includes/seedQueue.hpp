@@ -0,0 +1,116 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SEEDQUEUE_HPP
+#define TRITON_SEEDQUEUE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! A seed, the concrete values of the symbolic input bytes.
+      typedef std::vector<triton::uint8> Seed;
+
+      /*! \class SeedQueue
+       *  \brief The work-stealing queue of the seeds to run.
+       *
+       *  \description
+       *  Each worker owns a deque: it pushes and pops its own seeds at the back, so it goes deep into
+       *  the paths it has just opened, and steals the oldest seeds at the front of the others when its
+       *  deque is empty. A seed is pending from its push until the worker which popped it calls done(),
+       *  and pop() returns false once no seed is pending anymore.
+       */
+      class SeedQueue {
+        private:
+          //! The deque of a worker.
+          struct Deque {
+            //! The lock of the deque.
+            std::mutex lock;
+
+            //! The seeds.
+            std::deque<Seed> seeds;
+          };
+
+          //! The deques of the workers.
+          std::vector<std::unique_ptr<Deque>> deques;
+
+          //! The lock of the idle workers.
+          std::mutex idleLock;
+
+          //! Wakes the idle workers up.
+          std::condition_variable idle;
+
+          //! The number of seeds available in the deques.
+          std::atomic<triton::usize> available;
+
+          //! The number of seeds pushed and not done yet.
+          std::atomic<triton::usize> pending;
+
+          //! True if the queue has been closed.
+          bool closed;
+
+          //! Takes a seed from the deque of `worker` or steals one. Returns false if all deques are empty.
+          bool take(triton::usize worker, Seed& seed);
+
+        public:
+          //! Constructor.
+          SeedQueue(triton::usize workers);
+
+          //! Pushes a seed into the deque of `worker`.
+          void push(triton::usize worker, const Seed& seed);
+
+          //! Pops a seed for `worker`, waits if needed. Returns false if the exploration is over.
+          bool pop(triton::usize worker, Seed& seed);
+
+          //! Marks a popped seed as done.
+          void done(void);
+
+          //! Closes the queue, pop() returns false from now on.
+          void close(void);
+
+          //! Returns the number of seeds waiting in the deques.
+          triton::usize size(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SEEDQUEUE_HPP */
@@ -0,0 +1,121 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SEGMENTREPLAYER_H
+#define TRITON_SEGMENTREPLAYER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "api.hpp"
+#include "replayEngine.hpp"
+#include "traceIndex.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Replay namespace
+    namespace replay {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup replay
+     *  @{
+     */
+
+      //! A segment of a trace, between two checkpoints.
+      struct TraceSegment {
+        //! The index of the segment, which is the index of its checkpoint.
+        triton::usize index;
+
+        //! The number of the first instruction of the segment.
+        triton::usize first;
+
+        //! The number of instructions of the segment.
+        triton::usize count;
+      };
+
+      /*! \class SegmentReplayer
+       *  \brief Replays the segments of an indexed trace in parallel.
+       *
+       *  \description
+       *  Each worker thread owns a context and a reader of the trace. For each segment, it restores
+       *  the checkpoint of the segment on a fresh state, calls the begin callback, replays the
+       *  instructions of the segment and calls the end callback. The callbacks are called
+       *  concurrently by the workers: they should store their results per segment index, to be
+       *  composed once run() returns.
+       */
+      class SegmentReplayer {
+        public:
+          //! Called at the beginning and at the end of each segment.
+          typedef std::function<void(triton::API& ctx, const TraceSegment& segment)> SegmentCallback;
+
+        private:
+          //! The path of the trace.
+          std::string tracePath;
+
+          //! The index of the trace.
+          const triton::format::trace::TraceIndex& index;
+
+          //! The callback called before each segment.
+          SegmentCallback begin;
+
+          //! The callback called after each segment.
+          SegmentCallback end;
+
+          //! The callback called after each instruction.
+          ReplayEngine::InstructionCallback callback;
+
+          //! The number of workers.
+          triton::usize workers;
+
+        public:
+          //! Constructor.
+          SegmentReplayer(const std::string& tracePath, const triton::format::trace::TraceIndex& index);
+
+          //! Sets the callback called before each segment, once its checkpoint is restored.
+          void setBeginCallback(const SegmentCallback& begin);
+
+          //! Sets the callback called after each segment.
+          void setEndCallback(const SegmentCallback& end);
+
+          //! Sets the callback called after each instruction.
+          void setInstructionCallback(const ReplayEngine::InstructionCallback& callback);
+
+          //! Sets the number of workers (0 for the number of hardware threads).
+          void setWorkers(triton::usize workers);
+
+          //! Returns the segments of the trace.
+          std::vector<TraceSegment> getSegments(void) const;
+
+          //! Replays all segments. Rethrows the first exception of a worker once all workers are done.
+          void run(void);
+      };
+
+    /*! @} End of replay namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SEGMENTREPLAYER_H */
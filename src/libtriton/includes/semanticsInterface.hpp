@@ -8,7 +8,11 @@
 #ifndef TRITON_SEMANTICSINTERFACE_HPP
 #define TRITON_SEMANTICSINTERFACE_HPP
 
+#include <map>
+#include <string>
+
 #include "instruction.hpp"
+#include "tritonTypes.hpp"
 
 
 
@@ -36,6 +40,12 @@ namespace triton {
 
         //! Builds the semantics of the instruction. Returns true if the instruction is supported.
         virtual bool buildSemantics(triton::arch::Instruction& inst) = 0;
+
+        //! Clears the semantics templates.
+        virtual void clearSemanticsTemplates(void) = 0;
+
+        //! Returns the statistics of the semantics templates (entries, hits and misses).
+        virtual std::map<std::string, triton::usize> getSemanticsTemplatesStats(void) const = 0;
     };
 
   /*! @} End of arch namespace */
@@ -0,0 +1,279 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SEMANTICSTEMPLATE_HPP
+#define TRITON_SEMANTICSTEMPLATE_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ast.hpp"
+#include "immediate.hpp"
+#include "instruction.hpp"
+#include "memoryAccess.hpp"
+#include "register.hpp"
+#include "symbolicExpression.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      class SymbolicEngine;
+
+      /*! \class SemanticsTemplate
+       *  \brief The semantics of an instruction with parameterized leaves.
+       *
+       *  \description
+       *  A template is recorded while the semantics handler of an instruction runs. It keeps the leaves
+       *  read by the handler (registers, memory and immediates), the nodes built on top of them and the
+       *  symbolic expressions created. Instantiating the template reads the leaves from the current state,
+       *  rebuilds the nodes and creates the same symbolic expressions, without running the handler.
+       */
+      class SemanticsTemplate {
+        friend class SemanticsRecorder;
+
+        public:
+          //! The calls of the symbolic engine recorded.
+          enum step_e {
+            LEAF_IMMEDIATE,     //!< buildSymbolicImmediate()
+            LEAF_MEMORY,        //!< buildSymbolicMemory()
+            LEAF_REGISTER,      //!< buildSymbolicRegister()
+            FLAG_EXPRESSION,    //!< createSymbolicFlagExpression()
+            MEMORY_EXPRESSION,  //!< createSymbolicMemoryExpression()
+            REGISTER_EXPRESSION,//!< createSymbolicRegisterExpression()
+            VOLATILE_EXPRESSION //!< createSymbolicVolatileExpression()
+          };
+
+          //! Where the register, memory or immediate of a step comes from.
+          enum source_e {
+            STANDALONE,         //!< Not an operand of the instruction.
+            OPERAND,            //!< An operand of the instruction.
+            OPERAND_BASE,       //!< The base register of a memory operand.
+            OPERAND_INDEX,      //!< The index register of a memory operand.
+            OPERAND_SEGMENT,    //!< The segment register of a memory operand.
+            OPERAND_DISP,       //!< The displacement of a memory operand.
+            OPERAND_SCALE       //!< The scale of a memory operand.
+          };
+
+        private:
+          //! The origin of a node.
+          enum origin_e {
+            BUILT,              //!< Built by the handler.
+            LEAF,               //!< Returned by a leaf step.
+            REFERENCE,          //!< A reference to an expression created by a previous step.
+            EXPRESSION          //!< The AST of an expression created by a previous step.
+          };
+
+          //! A call of the symbolic engine done by the handler.
+          struct Step {
+            //! The kind of call.
+            step_e kind;
+
+            //! Where the register, memory or immediate comes from.
+            source_e source;
+
+            //! The index of the instruction operand if the source is not STANDALONE.
+            triton::uint32 operand;
+
+            //! True if the leaf is defined as input of the instruction.
+            bool input;
+
+            //! The standalone register.
+            triton::arch::Register reg;
+
+            //! The standalone immediate.
+            triton::arch::Immediate imm;
+
+            //! The node of an expression.
+            triton::usize node;
+
+            //! The comment of an expression.
+            std::string comment;
+          };
+
+          //! A node of the semantics.
+          struct Node {
+            //! The origin of the node.
+            origin_e origin;
+
+            //! The kind of a built node.
+            triton::ast::kind_e kind;
+
+            //! The step of a leaf, a reference or an expression.
+            triton::usize step;
+
+            //! The values of the decimal childs of a built node.
+            std::vector<triton::uint512> params;
+
+            //! The other childs of a built node.
+            std::vector<triton::usize> childs;
+          };
+
+          //! The opcodes of the instruction.
+          std::vector<triton::uint8> opcodes;
+
+          //! The calls of the symbolic engine, in order.
+          std::vector<Step> steps;
+
+          //! The nodes, each node is after its childs.
+          std::vector<Node> nodes;
+
+          //! Returns the register of a step.
+          triton::arch::Register& getRegister(triton::arch::Instruction& inst, const Step& step, triton::arch::Register& standalone) const;
+
+          //! Returns the immediate of a step.
+          triton::arch::Immediate& getImmediate(triton::arch::Instruction& inst, const Step& step, triton::arch::Immediate& standalone) const;
+
+          //! Rebuilds a node.
+          triton::ast::AbstractNode* buildNode(const Node& node,
+                                               const std::vector<triton::ast::AbstractNode*>& nodes,
+                                               const std::vector<triton::ast::AbstractNode*>& leaves,
+                                               const std::vector<SymbolicExpression*>& expressions) const;
+
+        public:
+          //! Returns true if a built node of this kind may be rebuilt from its decimal and other childs.
+          static bool isRebuildable(triton::ast::kind_e kind, triton::usize params, triton::usize childs);
+
+          //! Returns true if the template has been recorded from the opcodes of the instruction.
+          bool match(const triton::arch::Instruction& inst) const;
+
+          //! Builds the semantics of the instruction from the template.
+          void instantiate(triton::arch::Instruction& inst, SymbolicEngine* engine) const;
+      };
+
+
+      /*! \class SemanticsRecorder
+       *  \brief Records a semantics template while the semantics handler of an instruction runs.
+       *
+       *  \description
+       *  The symbolic engine reports its calls to the recorder. Only the calls done by the handler are
+       *  recorded, not the nested ones. The template is invalid if the handler reads a memory which is not
+       *  an operand or uses a node which cannot be rebuilt (e.g. a reference to a previous instruction).
+       */
+      class SemanticsRecorder {
+        private:
+          //! The instruction.
+          triton::arch::Instruction* inst;
+
+          //! The template.
+          SemanticsTemplate result;
+
+          //! False if the template cannot be used.
+          bool valid;
+
+          //! The number of nested calls of the symbolic engine.
+          triton::uint32 depth;
+
+          //! The nodes already recorded as <node, index>.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> nodeIndexes;
+
+          //! The expressions created as <expression id, step>.
+          std::unordered_map<triton::usize, triton::usize> expressionSteps;
+
+          //! The ASTs of the expressions created as <ast, step>.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> expressionAsts;
+
+          //! Returns where an object of the instruction operands comes from.
+          SemanticsTemplate::source_e findSource(const void* object, triton::uint32& operand) const;
+
+          //! Records a node and its childs. Returns its index.
+          triton::usize addNode(triton::ast::AbstractNode* node);
+
+          //! Records a leaf step.
+          void addLeaf(SemanticsTemplate::Step& step, triton::ast::AbstractNode* node);
+
+          //! Records an expression step. Returns its index.
+          triton::usize addExpression(SemanticsTemplate::Step& step, triton::ast::AbstractNode* node, const std::string& comment);
+
+        public:
+          /*! \class Scope
+           *  \brief A call of the symbolic engine. It is recorded only if it is not nested in another call.
+           */
+          class Scope {
+            private:
+              //! The recorder, nullptr if nothing is recorded.
+              SemanticsRecorder* recorder;
+
+              //! True if the call is done by the handler.
+              bool outermost;
+
+              //! The step of an expression.
+              triton::usize step;
+
+            public:
+              //! Constructor.
+              Scope(SemanticsRecorder* recorder);
+
+              //! Destructor.
+              ~Scope();
+
+              //! Records a leaf built from an immediate.
+              void recordImmediate(const triton::arch::Immediate& imm, triton::ast::AbstractNode* node, bool input);
+
+              //! Records a leaf built from a memory.
+              void recordMemory(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node, bool input);
+
+              //! Records a leaf built from a register.
+              void recordRegister(const triton::arch::Register& reg, triton::ast::AbstractNode* node, bool input);
+
+              //! Records the creation of a flag expression.
+              void recordFlagExpression(triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment);
+
+              //! Records the creation of a memory expression.
+              void recordMemoryExpression(triton::ast::AbstractNode* node, const triton::arch::MemoryAccess& mem, const std::string& comment);
+
+              //! Records the creation of a register expression.
+              void recordRegisterExpression(triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment);
+
+              //! Records the creation of a volatile expression.
+              void recordVolatileExpression(triton::ast::AbstractNode* node, const std::string& comment);
+
+              //! Records the expression created. Returns the expression.
+              SymbolicExpression* setExpression(SymbolicExpression* expr);
+          };
+
+          //! Constructor.
+          SemanticsRecorder(triton::arch::Instruction& inst);
+
+          //! Returns true if the template can be used.
+          bool isValid(void) const;
+
+          //! Returns the template.
+          const SemanticsTemplate& getTemplate(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SEMANTICSTEMPLATE_HPP */
@@ -0,0 +1,97 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SNAPSHOTENGINE_H
+#define TRITON_SNAPSHOTENGINE_H
+
+#include "architecture.hpp"
+#include "astGarbageCollector.hpp"
+#include "symbolicEngine.hpp"
+#include "taintEngine.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Snapshot namespace
+    namespace snapshot {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup snapshot
+     *  @{
+     */
+
+      //! \class SnapshotEngine
+      /*! \brief The snapshot engine class. */
+      class SnapshotEngine {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! AST garbage collector API
+          triton::ast::AstGarbageCollector* astGarbageCollector;
+
+          //! The number of snapshots alive.
+          triton::usize numberOfSnapshots;
+
+        public:
+          //! Constructor.
+          SnapshotEngine(triton::arch::Architecture* architecture,
+                         triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                         triton::engines::taint::TaintEngine* taintEngine,
+                         triton::ast::AstGarbageCollector* astGarbageCollector);
+
+          //! Destructor.
+          virtual ~SnapshotEngine();
+
+          //! Takes a snapshot of the concrete, symbolic and taint states. Returns the snapshot id.
+          triton::usize takeSnapshot(void);
+
+          //! Restores the states at the snapshot `id`. The snapshot is kept but all snapshots taken after it are discarded.
+          void restoreSnapshot(triton::usize id);
+
+          //! Removes the snapshot `id` and all snapshots taken after it.
+          void removeSnapshot(triton::usize id);
+
+          //! Removes all snapshots.
+          void removeAllSnapshots(void);
+
+          //! Returns true if the snapshot `id` exists.
+          bool isSnapshotExists(triton::usize id) const;
+
+          //! Returns the number of snapshots alive.
+          triton::usize getNumberOfSnapshots(void) const;
+      };
+
+    /*! @} End of snapshot namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SNAPSHOTENGINE_H */
@@ -0,0 +1,78 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_HPP
+#define TRITON_SOLVERCACHE_HPP
+
+#include <map>
+#include <mutex>
+
+#include "solverModel.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! \class SolverCache
+       *  \brief The models shared by all workers of an exploration.
+       *
+       *  \description
+       *  The queries are keyed by the hash of their unrolled AST, so two workers following the same
+       *  path prefix build the same key. An empty model means that the query is unsatisfiable.
+       */
+      class SolverCache {
+        private:
+          //! The lock of the cache.
+          mutable std::mutex lock;
+
+          //! The models as <query hash, model>.
+          std::map<triton::uint512, std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+
+        public:
+          //! Returns true and sets `model` if the query has been solved.
+          bool find(const triton::uint512& key, std::map<triton::uint32, triton::engines::solver::SolverModel>& model) const;
+
+          //! Records the model of a query.
+          void insert(const triton::uint512& key, const std::map<triton::uint32, triton::engines::solver::SolverModel>& model);
+
+          //! Returns the number of queries recorded.
+          triton::usize size(void) const;
+
+          //! Clears the cache.
+          void clear(void);
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_HPP */
@@ -10,15 +10,20 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "architecture.hpp"
 #include "ast.hpp"
 #include "astDictionaries.hpp"
 #include "callbacks.hpp"
+#include "concretizationPolicy.hpp"
 #include "memoryAccess.hpp"
 #include "pathManager.hpp"
 #include "register.hpp"
+#include "semanticsTemplate.hpp"
 #include "symbolicEnums.hpp"
 #include "symbolicExpression.hpp"
 #include "symbolicOptimization.hpp"
@@ -51,10 +56,40 @@ namespace triton {
      *  @{
      */
 
+      /*! \struct SymbolicSnapshot
+          \brief The marks of the symbolic engine recorded by a snapshot. */
+      struct SymbolicSnapshot {
+        //! The symbolic register state.
+        std::vector<triton::usize> symbolicReg;
+
+        //! The next symbolic expression id.
+        triton::usize uniqueSymExprId;
+
+        //! The next symbolic variable id.
+        triton::usize uniqueSymVarId;
+
+        //! The number of path constraints.
+        triton::usize numberOfPathConstraints;
+
+        //! The size of the path constraints journal.
+        triton::usize pathConstraintsJournalSize;
+
+        //! The size of the memory reference journal.
+        triton::usize memoryReferenceJournalSize;
+
+        //! The size of the AST journal.
+        triton::usize astJournalSize;
+
+        //! The number of removed symbolic expressions.
+        triton::usize removedExpressionsSize;
+      };
+
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
         : public virtual triton::ast::AstDictionaries,
+          public virtual triton::engines::symbolic::ConcretizationPolicy,
           public virtual triton::engines::symbolic::SymbolicOptimization,
           public virtual triton::engines::symbolic::SymbolicSimplification,
           public virtual triton::engines::symbolic::PathManager {
@@ -107,6 +142,18 @@ namespace triton {
            */
           std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
 
+          //! The marks of each snapshot.
+          std::vector<SymbolicSnapshot> snapshots;
+
+          //! The undo journal of memory references as (address, previous symbolic reference id or UNSET).
+          std::vector<std::pair<triton::uint64, triton::usize>> memoryReferenceJournal;
+
+          //! The undo journal of the ASTs replaced by a symbolic variable as (symbolic reference id, previous AST).
+          std::vector<std::pair<triton::usize, triton::ast::AbstractNode*>> astJournal;
+
+          //! The symbolic expressions removed while a snapshot still refers to them. They are deleted when snapshots are discarded.
+          std::vector<SymbolicExpression*> removedExpressions;
+
         private:
           //! Architecture API
           triton::arch::Architecture* arch;
@@ -114,8 +161,20 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
-          //! Slices all expressions from a given node.
-          void sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs);
+          //! The recorder of the semantics being built (nullptr if none).
+          SemanticsRecorder* recorder;
+
+          //! Returns true if a node may be replaced by its concrete value (bitvector sort only).
+          bool isFoldableAstNode(triton::ast::AbstractNode* node) const;
+
+          //! Replaces all non-symbolized subtrees of a node by their concrete value. \sa triton::engines::symbolic::CONSTANT_FOLDING.
+          triton::ast::AbstractNode* foldConcreteSubtrees(triton::ast::AbstractNode* node);
+
+          //! Records the previous symbolic reference of a memory cell into the journal.
+          void journalMemoryReference(triton::uint64 addr);
+
+          //! Records the previous AST of a symbolic expression into the journal.
+          void journalAst(SymbolicExpression* expr);
 
         public:
           //! Constructor. If you use this class as backup or copy you should define the `isBackup` flag as true.
@@ -238,6 +297,9 @@ namespace triton {
           //! Returns the new symbolic volatile expression expression and links this expression to the instruction.
           SymbolicExpression* createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment="");
 
+          //! Reports the calls of the semantics handler to a recorder. nullptr detaches the recorder.
+          void setSemanticsRecorder(SemanticsRecorder* recorder);
+
           //! Returns an unique symbolic expression id.
           triton::usize getUniqueSymExprId(void);
 
@@ -256,12 +318,15 @@ namespace triton {
           //! Returns the full AST of a root node.
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
-          //! Slices all expressions from a given one.
-          std::map<triton::usize, SymbolicExpression*> sliceExpressions(SymbolicExpression* expr);
+          //! Slices all expressions from a given one. The `depth` bounds the number of dependency levels followed (UNSET means unbounded).
+          std::map<triton::usize, SymbolicExpression*> sliceExpressions(SymbolicExpression* expr, triton::usize depth=triton::engines::symbolic::UNSET);
 
           //! Returns the list of the tainted symbolic expressions.
           std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
+          //! Returns the list of the symbolic variables a node depends on.
+          std::list<SymbolicVariable*> getSymbolicVariablesFromAst(triton::ast::AbstractNode* node) const;
+
           //! Returns all symbolic expressions.
           const std::map<triton::usize, SymbolicExpression*>& getSymbolicExpressions(void) const;
 
@@ -289,6 +354,9 @@ namespace triton {
           //! Concretizes a specific symbolic register reference.
           void concretizeRegister(const triton::arch::Register& reg);
 
+          //! Concretizes the registers and memory written by an instruction according to the concretization policy.
+          void applyConcretizationPolicy(const triton::arch::Instruction& inst);
+
           //! Enables or disables the symbolic execution engine.
           void enable(bool flag);
 
@@ -309,6 +377,15 @@ namespace triton {
 
           //! Returns true if the register expression contains a symbolic variable.
           bool isRegisterSymbolized(const triton::arch::Register& reg) const;
+
+          //! Takes a snapshot of the symbolic state. From now on, all symbolic reference changes are journaled.
+          void takeSnapshot(void);
+
+          //! Restores the symbolic state at the snapshot `index` and discards all snapshots taken after it.
+          void restoreSnapshot(triton::usize index);
+
+          //! Discards all snapshots from `index`. The journals are released when no snapshot remains.
+          void discardSnapshots(triton::usize index);
       };
 
     /*! @} End of symbolic namespace */
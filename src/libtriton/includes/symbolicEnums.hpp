@@ -55,9 +55,19 @@ namespace triton {
       enum optimization_e {
         ALIGNED_MEMORY,        //!< Keep a map of aligned memory.
         AST_DICTIONARIES,      //!< Abstract Syntax Tree dictionaries.
+        CONSTANT_FOLDING,      //!< Replace non-symbolized subtrees by their concrete value.
         ONLY_ON_SYMBOLIZED,    //!< Perform symbolic execution only on symbolized expressions.
         ONLY_ON_TAINTED,       //!< Perform symbolic execution only on tainted instructions.
         PC_TRACKING_SYMBOLIC,  //!< Track path constraints only if they are symbolized.
+        SEMANTICS_TEMPLATES,   //!< Build the semantics of an instruction already executed from a template.
+      };
+
+      //! Enumerates all kinds of automatic concretization.
+      enum concretization_e {
+        ADDRESS_RANGE,         //!< Concretize symbolic stores which overlap a registered address range.
+        MAX_AGE,               //!< Concretize locations which are symbolized since more than N instructions.
+        MAX_DEPTH,             //!< Concretize expressions deeper than N.
+        MAX_NODES,             //!< Concretize expressions bigger than N unrolled nodes.
       };
 
     /*! @} End of symbolic namespace */
@@ -9,6 +9,7 @@
 #define TRITON_SYMBOLICEXPRESSION_H
 
 #include <string>
+#include <vector>
 
 #include "ast.hpp"
 #include "memoryAccess.hpp"
@@ -64,6 +65,12 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::Register originRegister;
 
+          //! The sorted ids of the symbolic expressions directly referenced by the AST (`REFERENCE_NODE`).
+          std::vector<triton::usize> dependencies;
+
+          //! Computes the direct dependencies of the AST.
+          void initDependencies(void);
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -104,6 +111,12 @@ namespace triton {
           //! Returns the origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           const triton::arch::Register& getOriginRegister(void) const;
 
+          //! Returns the sorted ids of the symbolic expressions directly referenced by this expression.
+          const std::vector<triton::usize>& getDependencies(void) const;
+
+          //! Returns the sorted ids of the symbolic variables this expression depends on.
+          const std::vector<triton::usize>& getSymbolicVariableIds(void) const;
+
           //! Sets a root node.
           void setAst(triton::ast::AbstractNode* node);
 
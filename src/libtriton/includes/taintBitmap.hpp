@@ -0,0 +1,140 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTBITMAP_HPP
+#define TRITON_TAINTBITMAP_HPP
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintBitmap
+       *  \brief The shadow memory of the tainted addresses.
+       *
+       *  \description
+       *  The addresses are split into 4 KiB pages allocated when one of their bytes is tainted. Each
+       *  page keeps one bit per byte, so a tainted page costs 512 bytes. Ranges are set, cleared and
+       *  tested one 64-bit word (64 bytes) at a time, and a page is freed when its last bit is cleared.
+       */
+      class TaintBitmap {
+        private:
+          //! The number of bits of a page offset.
+          static const triton::uint32 PAGE_SHIFT = 12;
+
+          //! The number of bytes of a page.
+          static const triton::uint64 PAGE_SIZE = (1ULL << PAGE_SHIFT);
+
+          //! The number of words of a page bitmap.
+          static const triton::uint32 PAGE_WORDS = (PAGE_SIZE / 64);
+
+          //! A page of the shadow memory.
+          struct Page {
+            //! The bitmap of the tainted bytes.
+            triton::uint64 bits[PAGE_WORDS];
+
+            //! The number of tainted bytes.
+            triton::uint32 count;
+          };
+
+          //! The pages as <page number, page>.
+          std::unordered_map<triton::uint64, Page*> pages;
+
+          //! The number of tainted bytes.
+          triton::usize count;
+
+          //! The number of the last page looked up.
+          mutable triton::uint64 lastNumber;
+
+          //! The last page looked up (nullptr if none).
+          mutable Page* lastPage;
+
+          //! Returns the page of an address, nullptr if the page is not allocated.
+          Page* findPage(triton::uint64 addr) const;
+
+          //! Returns the page of an address, allocates it if needed.
+          Page* getPage(triton::uint64 addr);
+
+          //! Frees a page.
+          void freePage(triton::uint64 number);
+
+        public:
+          //! Constructor.
+          TaintBitmap();
+
+          //! Constructor by copy.
+          TaintBitmap(const TaintBitmap& other);
+
+          //! Destructor.
+          ~TaintBitmap();
+
+          //! Copies a TaintBitmap.
+          TaintBitmap& operator=(const TaintBitmap& other);
+
+          //! Untaints everything and frees all pages.
+          void clear(void);
+
+          //! Returns true if no address is tainted.
+          bool empty(void) const;
+
+          //! Returns the number of tainted bytes.
+          triton::usize size(void) const;
+
+          //! Returns true if the address is tainted.
+          bool isSet(triton::uint64 addr) const;
+
+          //! Returns true if at least one address of the range `[baseAddr:size]` is tainted.
+          bool isAnySet(triton::uint64 baseAddr, triton::usize size) const;
+
+          //! Taints the range `[baseAddr:size]`.
+          void set(triton::uint64 baseAddr, triton::usize size);
+
+          //! Untaints the range `[baseAddr:size]`. Empty pages are freed.
+          void unset(triton::uint64 baseAddr, triton::usize size);
+
+          //! Returns the tainted areas as sorted and disjoint <base address, size>.
+          std::vector<std::pair<triton::uint64, triton::usize>> getAreas(void) const;
+
+          //! Returns the tainted addresses.
+          std::set<triton::uint64> getAddresses(void) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTBITMAP_HPP */
@@ -9,10 +9,15 @@
 #define TRITON_TAINTENGINE_H
 
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "memoryAccess.hpp"
 #include "register.hpp"
 #include "symbolicEngine.hpp"
+#include "taintBitmap.hpp"
+#include "taintLabels.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -57,12 +62,72 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The shadow memory of the tainted addresses.
+          triton::engines::taint::TaintBitmap taintedMemory;
 
           //! The set of tainted registers. Currently it is an over approximation of the taint.
           std::set<triton::arch::Register> taintedRegisters;
 
+          //! The mark of a snapshot.
+          struct Snapshot {
+            //! The size of the memory journal.
+            triton::usize memoryJournal;
+
+            //! The size of the label journal.
+            triton::usize labelJournal;
+
+            //! The tainted registers.
+            std::set<triton::arch::Register> taintedRegisters;
+
+            //! The label sets of the registers.
+            std::unordered_map<triton::uint32, triton::uint32> registerLabels;
+          };
+
+          //! The marks of each snapshot.
+          std::vector<Snapshot> snapshots;
+
+          //! The undo journal of the tainted memory as (address, previous taint).
+          std::vector<std::pair<triton::uint64, bool>> memoryJournal;
+
+          //! The label sets. Queries may create unions, hence mutable.
+          mutable triton::engines::taint::TaintLabels labels;
+
+          //! True once a label has been set. The label sets are spread only in this mode.
+          bool labelled;
+
+          //! The label set of each labelled address.
+          std::unordered_map<triton::uint64, triton::uint32> memoryLabels;
+
+          //! The label set of each labelled parent register, by register id.
+          std::unordered_map<triton::uint32, triton::uint32> registerLabels;
+
+          //! The undo journal of the memory labels as (address, previous label set).
+          std::vector<std::pair<triton::uint64, triton::uint32>> labelJournal;
+
+          //! Returns the union of the label sets of the range `[addr:size]`.
+          triton::uint32 getMemoryLabelSet(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Returns the label set of a register.
+          triton::uint32 getRegisterLabelSet(const triton::arch::Register& reg) const;
+
+          //! Sets the label set of the range `[addr:size]` and records the previous ones into the journal.
+          void setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 id);
+
+          //! Adds a label set to the range `[addr:size]`.
+          void uniteMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 id);
+
+          //! Sets the label set of a register.
+          void setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 id);
+
+          //! Adds a label set to a register.
+          void uniteRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 id);
+
+          //! Taints the range `[addr:size]` and records the previous state of its addresses into the journal.
+          void insertTaintedMemory(triton::uint64 addr, triton::usize size=1);
+
+          //! Untaints the range `[addr:size]` and records the previous state of its addresses into the journal.
+          void eraseTaintedMemory(triton::uint64 addr, triton::usize size=1);
+
           //! Copies a TaintEngine.
           void copy(const TaintEngine& other);
 
@@ -82,12 +147,30 @@ namespace triton {
           //! Enables or disables the taint engine.
           void enable(bool flag);
 
-          //! Returns the tainted addresses.
-          const std::set<triton::uint64>& getTaintedMemory(void) const;
+          //! Returns the tainted addresses. This copies the whole shadow memory, prefer getTaintedMemoryAreas().
+          std::set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Returns the tainted memory areas as sorted and disjoint <base address, size>.
+          std::vector<std::pair<triton::uint64, triton::usize>> getTaintedMemoryAreas(void) const;
+
+          //! Returns true if at least one address is tainted.
+          bool hasTaintedMemory(void) const;
 
           //! Returns the tainted registers.
           const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
 
+          //! Returns the labels of an address.
+          std::vector<triton::uint32> getMemoryLabels(triton::uint64 addr) const;
+
+          //! Returns the union of the labels of a memory.
+          std::vector<triton::uint32> getMemoryLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the labels of a register.
+          std::vector<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
+          //! Returns true if a label has been set, i.e. the label sets are spread.
+          bool isLabelled(void) const;
+
           //! Returns true if the taint engine is enabled.
           bool isEnabled(void) const;
 
@@ -112,6 +195,15 @@ namespace triton {
           //! Sets the flag (taint or untaint) to a register.
           bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
+          //! Taints an address and adds `label` to its labels. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelMemory(triton::uint64 addr, triton::uint32 label);
+
+          //! Taints a memory and adds `label` to its labels. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register and adds `label` to its labels. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelRegister(const triton::arch::Register& reg, triton::uint32 label);
+
           //! Taints an address. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
           bool taintMemory(triton::uint64 addr);
 
@@ -172,6 +264,15 @@ namespace triton {
           //! Taints RegisterRegister with assignment. Returns true if the regDst is tainted.
           bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
+          //! Takes a snapshot of the taint state. From now on, all memory taint changes are journaled.
+          void takeSnapshot(void);
+
+          //! Restores the taint state at the snapshot `index` and discards all snapshots taken after it.
+          void restoreSnapshot(triton::usize index);
+
+          //! Discards all snapshots from `index`. The journal is released when no snapshot remains.
+          void discardSnapshots(triton::usize index);
+
         private:
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
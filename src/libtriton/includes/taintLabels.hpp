@@ -0,0 +1,98 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_HPP
+#define TRITON_TAINTLABELS_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! Defines the empty label set.
+      const triton::uint32 NO_LABELS = 0;
+
+      /*! \class TaintLabels
+       *  \brief The table of the taint label sets.
+       *
+       *  \description
+       *  Each set of labels is stored once and identified by a 32-bit id, the id 0 being the empty
+       *  set. The shadow memory and registers only keep these ids, two ids are equal if and only if
+       *  their sets are equal, and the union of two ids is computed once then memoized.
+       */
+      class TaintLabels {
+        private:
+          //! Hashes a sorted list of labels.
+          struct LabelsHash {
+            std::size_t operator()(const std::vector<triton::uint32>& labels) const;
+          };
+
+          //! The label sets as sorted and unique labels, indexed by id.
+          std::vector<std::vector<triton::uint32>> sets;
+
+          //! The ids of the label sets.
+          std::unordered_map<std::vector<triton::uint32>, triton::uint32, LabelsHash> ids;
+
+          //! The memoized unions as <(smallest id << 32) | greatest id, id of the union>.
+          std::unordered_map<triton::uint64, triton::uint32> unions;
+
+          //! Returns the id of a sorted list of labels, creates it if needed.
+          triton::uint32 intern(const std::vector<triton::uint32>& labels);
+
+        public:
+          //! Constructor.
+          TaintLabels();
+
+          //! Removes all label sets but the empty one.
+          void clear(void);
+
+          //! Returns the number of label sets, the empty one included.
+          triton::usize size(void) const;
+
+          //! Returns the id of the set `{label}`.
+          triton::uint32 getLabelSet(triton::uint32 label);
+
+          //! Returns the labels of a set.
+          const std::vector<triton::uint32>& getLabels(triton::uint32 id) const;
+
+          //! Returns the id of the union of two sets.
+          triton::uint32 unite(triton::uint32 id1, triton::uint32 id2);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_HPP */
@@ -0,0 +1,123 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEFORMAT_H
+#define TRITON_TRACEFORMAT_H
+
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \description
+       *  A trace file starts with a header:
+       *
+       *  - the magic number `TRITONTR` (8 bytes)
+       *  - the version of the format (1 byte)
+       *  - the architecture of the trace (1 byte)
+       *  - the flags, `TRACE_COMPRESSED` if the blocks may be compressed (1 byte)
+       *  - a reserved byte
+       *
+       *  Then come the blocks. A block starts with its flags (1 byte, `TRACE_COMPRESSED` if its
+       *  payload is compressed) and three varints: its number of records, the size of its payload
+       *  once decompressed and the size of its stored payload. Each record of the payload is:
+       *
+       *  - the record flags (1 byte)
+       *  - the address, as a zigzag varint delta from the next address of the previous record
+       *  - the thread id as a varint, if `RECORD_THREAD` is set
+       *  - the opcode size (1 byte) and the opcodes, if `RECORD_OPCODES` is set. Otherwise, the
+       *    opcodes are the ones of the previous record at the same address
+       *  - the number of registers as a varint, then for each register its id as a varint and its
+       *    value. A register is only recorded if its value differs from its value in the previous
+       *    record
+       *  - the number of memory accesses as a varint, then for each access its address as a zigzag
+       *    varint delta from the previous access, its size (1 byte) and its value
+       *
+       *  A value is its number of significant bytes (1 byte) followed by these bytes in little-endian.
+       *  The deltas start over at each block, so a block can be decoded on its own.
+       */
+
+      //! The magic number of a trace file.
+      const char TRACE_MAGIC[] = "TRITONTR";
+
+      //! The version of the trace format.
+      const triton::uint8 TRACE_VERSION = 1;
+
+      //! The size of the trace file header.
+      const triton::usize TRACE_HEADER_SIZE = 12;
+
+      //! The flag of a compressed trace or block.
+      const triton::uint8 TRACE_COMPRESSED = 0x01;
+
+      //! The size of a block payload before it is flushed.
+      const triton::usize TRACE_BLOCK_SIZE = 0x10000;
+
+      //! The maximum size of a block payload accepted by the reader.
+      const triton::usize TRACE_MAX_BLOCK_SIZE = 0x1000000;
+
+      //! The flag of a record with a thread id.
+      const triton::uint8 RECORD_THREAD = 0x01;
+
+      //! The flag of a record with opcodes.
+      const triton::uint8 RECORD_OPCODES = 0x02;
+
+      //! Appends an unsigned varint.
+      void writeVarint(std::vector<triton::uint8>& buffer, triton::uint64 value);
+
+      //! Reads an unsigned varint at `offset` and moves `offset` past it. Throws if the buffer is too short.
+      triton::uint64 readVarint(const std::vector<triton::uint8>& buffer, triton::usize& offset);
+
+      //! Appends a signed varint (zigzag encoded).
+      void writeSignedVarint(std::vector<triton::uint8>& buffer, triton::sint64 value);
+
+      //! Reads a signed varint (zigzag encoded).
+      triton::sint64 readSignedVarint(const std::vector<triton::uint8>& buffer, triton::usize& offset);
+
+      //! Appends a value as its number of significant bytes and these bytes.
+      void writeValue(std::vector<triton::uint8>& buffer, triton::uint512 value);
+
+      //! Reads a value written by writeValue().
+      triton::uint512 readValue(const std::vector<triton::uint8>& buffer, triton::usize& offset);
+
+      //! Compresses a block payload (LZ77).
+      std::vector<triton::uint8> compressBlock(const std::vector<triton::uint8>& input);
+
+      //! Decompresses a block payload of `size` bytes. Throws if the payload is corrupted.
+      std::vector<triton::uint8> decompressBlock(const std::vector<triton::uint8>& input, triton::usize size);
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEFORMAT_H */
@@ -0,0 +1,140 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEINDEX_H
+#define TRITON_TRACEINDEX_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "api.hpp"
+#include "traceReader.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      //! A memory page of a checkpoint.
+      struct TracePage {
+        //! The base address of the page.
+        triton::uint64 base;
+
+        //! The mapped areas of the page as <address, values>. Empty if the page is unmapped.
+        std::vector<std::pair<triton::uint64, std::vector<triton::uint8>>> areas;
+      };
+
+      //! A checkpoint of a trace.
+      struct TraceCheckpoint {
+        //! The number of the first instruction after the checkpoint.
+        triton::usize instruction;
+
+        //! The file offset of the block of this instruction.
+        triton::uint64 offset;
+
+        //! The concrete values of the parent registers as <register id, value>.
+        std::vector<std::pair<triton::uint32, triton::uint512>> registers;
+
+        //! The memory pages changed since the previous checkpoint.
+        std::vector<TracePage> pages;
+      };
+
+      /*! \class TraceIndex
+       *  \brief The checkpoints of a trace.
+       *
+       *  \description
+       *  The index is built by replaying the trace once. On the first block boundary after each
+       *  `interval` instructions, it records the full concrete register state and the memory pages
+       *  changed since the previous checkpoint. The first checkpoint holds the whole state of the
+       *  context before the trace. An analysis may then start at any checkpoint: restore() rebuilds
+       *  the concrete state on a context and seek() moves a reader to the checkpoint block.
+       */
+      class TraceIndex {
+        private:
+          //! The architecture of the trace.
+          triton::uint32 architecture;
+
+          //! The number of instructions between two checkpoints.
+          triton::usize interval;
+
+          //! The number of instructions of the trace.
+          triton::usize count;
+
+          //! The checkpoints, sorted by instruction.
+          std::vector<TraceCheckpoint> checkpoints;
+
+          //! Records a checkpoint of the context.
+          void capture(triton::API& ctx, triton::usize instruction, triton::uint64 offset);
+
+        public:
+          //! Constructor.
+          TraceIndex();
+
+          //! Builds the index of a trace by replaying it on `ctx`, with a checkpoint every `interval` instructions at least.
+          void build(triton::API& ctx, const std::string& tracePath, triton::usize interval);
+
+          //! Saves the index into a file.
+          void save(const std::string& path) const;
+
+          //! Loads an index saved by save().
+          void load(const std::string& path);
+
+          //! Returns the architecture of the trace.
+          triton::uint32 getArchitecture(void) const;
+
+          //! Returns the number of instructions of the trace.
+          triton::usize getInstructionCount(void) const;
+
+          //! Returns the checkpoints.
+          const std::vector<TraceCheckpoint>& getCheckpoints(void) const;
+
+          //! Returns the index of the last checkpoint at or before the instruction number `instruction`.
+          triton::usize findCheckpoint(triton::usize instruction) const;
+
+          /*!
+           * \brief Rebuilds the concrete state of a checkpoint on a context.
+           *
+           * \description The dirty pages of the context which are absent from the checkpoint are unmapped,
+           * so the context may already hold the state of another checkpoint. Its other pages are kept:
+           * the context must be fresh or must not have cleared its dirty pages since it was fresh.
+           */
+          void restore(triton::API& ctx, triton::usize checkpoint) const;
+
+          //! Moves a reader of the trace to a checkpoint.
+          void seek(TraceReader& reader, triton::usize checkpoint) const;
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEINDEX_H */
@@ -0,0 +1,139 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEREADER_H
+#define TRITON_TRACEREADER_H
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "instruction.hpp"
+#include "traceFormat.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceReader
+       *  \brief Streams a binary trace file.
+       *
+       *  \description
+       *  The file is read one block at a time, so the memory used does not depend on the size of the
+       *  trace. The registers are built with the ids of the current architecture, which must be the
+       *  one of the trace.
+       */
+      class TraceReader {
+        private:
+          //! The path of the trace file.
+          std::string path;
+
+          //! The trace file.
+          FILE* fd;
+
+          //! The architecture of the trace.
+          triton::uint32 architecture;
+
+          //! True if the blocks may be compressed.
+          bool compressed;
+
+          //! The payload of the current block.
+          std::vector<triton::uint8> block;
+
+          //! The offset of the next record in the current block.
+          triton::usize offset;
+
+          //! The number of records left in the current block.
+          triton::usize blockCount;
+
+          //! The number of records read.
+          triton::usize count;
+
+          //! The next address of the previous record.
+          triton::uint64 nextAddress;
+
+          //! The address of the previous memory access.
+          triton::uint64 lastMemory;
+
+          //! The thread id of the previous record.
+          triton::uint32 threadId;
+
+          //! The opcodes read in the current block as <address, opcodes>.
+          std::unordered_map<triton::uint64, std::vector<triton::uint8>> opcodes;
+
+          //! Reads raw bytes from the file. Returns false at the end of the file.
+          bool readRaw(triton::uint8* data, triton::usize size);
+
+          //! Reads a varint from the file.
+          triton::uint64 readFileVarint(void);
+
+          //! Loads the next block. Returns false at the end of the file.
+          bool loadBlock(void);
+
+        public:
+          //! Constructor. Opens a trace file and reads its header.
+          TraceReader(const std::string& path);
+
+          //! Destructor.
+          ~TraceReader();
+
+          //! Returns the architecture of the trace.
+          triton::uint32 getArchitecture(void) const;
+
+          //! Returns true if the blocks of the trace may be compressed.
+          bool isCompressed(void) const;
+
+          //! Returns the number of instructions read.
+          triton::usize getCount(void) const;
+
+          //! Reads the next instruction into `inst`. Returns false at the end of the trace.
+          bool next(triton::arch::Instruction& inst);
+
+          //! Goes back to the first instruction.
+          void rewind(void);
+
+          //! Returns true if the next instruction is the first one of a block.
+          bool isBlockBoundary(void) const;
+
+          //! Returns the file offset of the next block. Only valid on a block boundary.
+          triton::uint64 tell(void) const;
+
+          //! Goes to the block at the file offset `offset`, whose first instruction is the instruction number `count`.
+          void seek(triton::uint64 offset, triton::usize count);
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREADER_H */
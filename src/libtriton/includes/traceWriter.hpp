@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEWRITER_H
+#define TRITON_TRACEWRITER_H
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "instruction.hpp"
+#include "traceFormat.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceWriter
+       *  \brief Writes a binary trace file.
+       *
+       *  \description
+       *  Each written instruction becomes a record with its address, its thread id, its opcodes and
+       *  the content of its `registerState` and `memoryAccess` lists. The records are gathered in
+       *  blocks of about 64 KiB, compressed when the trace is created with compression enabled.
+       */
+      class TraceWriter {
+        private:
+          //! The trace file.
+          FILE* fd;
+
+          //! True if the blocks are compressed.
+          bool compressed;
+
+          //! The payload of the current block.
+          std::vector<triton::uint8> block;
+
+          //! The number of records of the current block.
+          triton::usize blockCount;
+
+          //! The number of records written.
+          triton::usize count;
+
+          //! The next address of the previous record.
+          triton::uint64 nextAddress;
+
+          //! The address of the previous memory access.
+          triton::uint64 lastMemory;
+
+          //! The thread id of the previous record.
+          triton::uint32 threadId;
+
+          //! The registers of the previous record as <id, value>.
+          std::map<triton::uint32, triton::uint512> registers;
+
+          //! The opcodes already written in the current block as <address, opcodes>.
+          std::unordered_map<triton::uint64, std::vector<triton::uint8>> opcodes;
+
+          //! Writes raw bytes to the file.
+          void writeRaw(const triton::uint8* data, triton::usize size);
+
+          //! Clears the deltas at the start of a block.
+          void resetDeltas(void);
+
+        public:
+          //! Constructor. Creates the trace file of an architecture.
+          TraceWriter(const std::string& path, triton::uint32 arch, bool compressed=true);
+
+          //! Destructor. Closes the trace.
+          ~TraceWriter();
+
+          //! Writes an instruction.
+          void write(const triton::arch::Instruction& inst);
+
+          //! Writes the current block.
+          void flush(void);
+
+          //! Writes the current block and closes the file.
+          void close(void);
+
+          //! Returns the number of instructions written.
+          triton::usize getCount(void) const;
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEWRITER_H */
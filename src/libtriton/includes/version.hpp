@@ -0,0 +1,31 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_VERSION_H
+#define TRITON_VERSION_H
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The libTriton's version.
+  enum version_e {
+    MAJOR = 0,
+    MINOR = 4,
+    BUILD = 1343
+  };
+
+/*! @} End of triton namespace */
+};
+
+#endif // TRITON_VERSION_H
+
@@ -0,0 +1,142 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_X86CONCRETESEMANTICS_H
+#define TRITON_X86CONCRETESEMANTICS_H
+
+#include <vector>
+
+#include "architecture.hpp"
+#include "instruction.hpp"
+#include "memoryAccess.hpp"
+#include "operandWrapper.hpp"
+#include "register.hpp"
+#include "symbolicEngine.hpp"
+#include "taintEngine.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      //! The result of a concrete execution.
+      enum concrete_e {
+        CONCRETE_EXECUTED = 0,  //!< The instruction has been executed.
+        CONCRETE_UNSUPPORTED,   //!< The instruction is not supported. Nothing has been done.
+        CONCRETE_SYMBOLIC,      //!< The instruction touches a symbolized or tainted operand. Nothing has been done.
+      };
+
+      /*! \class x86ConcreteSemantics
+       *  \brief The concrete-only x86 semantics.
+       *
+       *  \description
+       *  Executes the most common integer instructions directly on the concrete state of the CPU,
+       *  without building any AST nor symbolic expression. The reads are done first and the writes
+       *  are kept pending, so nothing is changed if the instruction touches a symbolized or tainted
+       *  operand. The symbolic references of the registers and memory written are concretized.
+       */
+      class x86ConcreteSemantics {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! True if the current instruction has touched a symbolized or tainted operand.
+          bool symbolic;
+
+          //! The pending register writes.
+          std::vector<triton::arch::Register> registers;
+
+          //! The pending memory writes.
+          std::vector<triton::arch::MemoryAccess> memory;
+
+          //! The next program counter.
+          triton::uint64 pc;
+
+          //! Returns the concrete value of a register.
+          triton::uint64 readRegister(const triton::arch::Register& reg);
+
+          //! Returns the concrete value of a memory area.
+          triton::uint64 readMemory(triton::uint64 addr, triton::uint32 size);
+
+          //! Returns the concrete value of an operand.
+          triton::uint64 read(triton::arch::OperandWrapper& op);
+
+          //! Returns the concrete value of a flag.
+          bool readFlag(const triton::arch::Register& flag);
+
+          //! Writes a register.
+          void writeRegister(const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes a memory area.
+          void writeMemory(triton::uint64 addr, triton::uint32 size, triton::uint64 value);
+
+          //! Writes an operand.
+          void write(triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Writes a flag.
+          void writeFlag(const triton::arch::Register& flag, bool value);
+
+          //! Writes the parity, sign and zero flags of a result.
+          void writeResultFlags(triton::uint64 result, triton::uint32 bits);
+
+          //! Returns true if the condition of a jcc, cmovcc or setcc instruction is true.
+          bool condition(triton::uint32 type);
+
+          //! Returns true if the operands of the instruction may be executed concretely.
+          bool isSupported(triton::arch::Instruction& inst) const;
+
+          //! Applies the pending writes. Returns false if a written operand is symbolized or tainted.
+          bool commit(void);
+
+          //! Executes the instruction. Returns false if the instruction is not supported.
+          bool run(triton::arch::Instruction& inst);
+
+        public:
+          //! Constructor.
+          x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                               triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                               triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Executes the instruction on the concrete state.
+          concrete_e execute(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86CONCRETESEMANTICS_H */
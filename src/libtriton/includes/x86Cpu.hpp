@@ -10,12 +10,16 @@
 
 #include <map>
 #include <set>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "callbacks.hpp"
 #include "cpuInterface.hpp"
+#include "disassemblyCache.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
+#include "pagedMemory.hpp"
 #include "register.hpp"
 #include "registerSpecification.hpp"
 #include "tritonTypes.hpp"
@@ -52,14 +56,24 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The capstone handle, opened on the first disassembly (0 if not opened).
+          mutable triton::usize handle;
+
+          //! The decoded instructions.
+          mutable triton::arch::DisassemblyCache disassemblyCache;
+
+          //! The numbers of the pages already delivered by the GET_CONCRETE_MEMORY_PAGE callbacks or written.
+          mutable std::unordered_set<triton::uint64> providedPages;
+
+          //! Marks the pages of a write as provided, so a GET_CONCRETE_MEMORY_PAGE callback cannot overwrite them. Does nothing without such callbacks.
+          void markProvidedPages(triton::uint64 baseAddr, triton::usize size);
+
+          //! Processes the GET_CONCRETE_MEMORY_PAGE and GET_CONCRETE_MEMORY_AREA_VALUE callbacks of a read.
+          void processMemoryCallbacks(triton::uint64 baseAddr, triton::usize size) const;
+
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory, allocated by pages on the first write.
+          triton::arch::PagedMemory memory;
 
           //! Concrete value of eax
           triton::uint8 eax[DWORD_SIZE];
@@ -215,10 +229,15 @@ namespace triton {
           bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1);
           bool isRegister(triton::uint32 regId) const;
           bool isRegisterValid(triton::uint32 regId) const;
+          std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
           std::set<triton::arch::Register*> getAllRegisters(void) const;
           std::set<triton::arch::Register*> getParentRegisters(void) const;
+          std::vector<triton::uint64> getDirtyMemoryPages(void) const;
           std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
-          triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
+          triton::arch::Register& getProgramCounter(void);
+          triton::arch::Register& getRegister(triton::uint32 regId);
+          const triton::arch::RegisterSpecification& getRegisterSpecification(triton::uint32 regId) const;
+          triton::arch::Register& getStackPointer(void);
           triton::uint32 numberOfRegisters(void) const;
           triton::uint32 registerBitSize(void) const;
           triton::uint32 registerSize(void) const;
@@ -226,8 +245,11 @@ namespace triton {
           triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
           triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
           void clear(void);
+          void clearDirtyMemoryPages(void);
+          void clearDisassemblyCache(void);
           void disassembly(triton::arch::Instruction& inst) const;
           void init(void);
+          void invalidateDisassemblyCache(triton::uint64 baseAddr, triton::usize size);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
           void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem);
@@ -8,6 +8,10 @@
 #ifndef TRITON_X86SEMANTICS_H
 #define TRITON_X86SEMANTICS_H
 
+#include <map>
+#include <string>
+#include <unordered_map>
+
 #include "architecture.hpp"
 #include "instruction.hpp"
 #include "semanticsInterface.hpp"
@@ -52,6 +56,21 @@ namespace triton {
           //! Taint Engine API
           triton::engines::taint::TaintEngine* taintEngine;
 
+          //! The semantics templates as <address, template>. \sa triton::engines::symbolic::SEMANTICS_TEMPLATES.
+          std::unordered_map<triton::uint64, triton::engines::symbolic::SemanticsTemplate> templates;
+
+          //! The number of instructions built from a template.
+          triton::usize templateHits;
+
+          //! The number of instructions recorded as template.
+          triton::usize templateMisses;
+
+          //! Returns true if the semantics of the instruction may be built from a template.
+          bool isTemplateAllowed(const triton::arch::Instruction& inst) const;
+
+          //! Runs the semantics handler of the instruction. Returns true if the instruction is supported.
+          bool runHandler(triton::arch::Instruction& inst);
+
         public:
           //! Constructor.
           x86Semantics(triton::arch::Architecture* architecture,
@@ -64,6 +83,12 @@ namespace triton {
           //! Builds the semantics of the instruction. Returns true if the instruction is supported.
           bool buildSemantics(triton::arch::Instruction& inst);
 
+          //! Clears the semantics templates.
+          void clearSemanticsTemplates(void);
+
+          //! Returns the statistics of the semantics templates (entries, hits and misses).
+          std::map<std::string, triton::usize> getSemanticsTemplatesStats(void) const;
+
           //! Aligns the stack (add). Returns the new stack value.
           triton::uint64 alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta);
 
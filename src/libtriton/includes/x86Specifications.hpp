@@ -8,6 +8,8 @@
 #ifndef TRITON_X86SPECIFICATIONS_H
 #define TRITON_X86SPECIFICATIONS_H
 
+#include <vector>
+
 #include "register.hpp"
 #include "registerSpecification.hpp"
 
@@ -36,233 +38,26 @@ namespace triton {
      *  @{
      */
 
-      extern triton::arch::Register x86_reg_invalid;
-
-      extern triton::arch::Register x86_reg_rax;
-      extern triton::arch::Register x86_reg_eax;
-      extern triton::arch::Register x86_reg_ax;
-      extern triton::arch::Register x86_reg_ah;
-      extern triton::arch::Register x86_reg_al;
-
-      extern triton::arch::Register x86_reg_rbx;
-      extern triton::arch::Register x86_reg_ebx;
-      extern triton::arch::Register x86_reg_bx;
-      extern triton::arch::Register x86_reg_bh;
-      extern triton::arch::Register x86_reg_bl;
-
-      extern triton::arch::Register x86_reg_rcx;
-      extern triton::arch::Register x86_reg_ecx;
-      extern triton::arch::Register x86_reg_cx;
-      extern triton::arch::Register x86_reg_ch;
-      extern triton::arch::Register x86_reg_cl;
-
-      extern triton::arch::Register x86_reg_rdx;
-      extern triton::arch::Register x86_reg_edx;
-      extern triton::arch::Register x86_reg_dx;
-      extern triton::arch::Register x86_reg_dh;
-      extern triton::arch::Register x86_reg_dl;
-
-      extern triton::arch::Register x86_reg_rdi;
-      extern triton::arch::Register x86_reg_edi;
-      extern triton::arch::Register x86_reg_di;
-      extern triton::arch::Register x86_reg_dil;
-
-      extern triton::arch::Register x86_reg_rsi;
-      extern triton::arch::Register x86_reg_esi;
-      extern triton::arch::Register x86_reg_si;
-      extern triton::arch::Register x86_reg_sil;
-
-      extern triton::arch::Register x86_reg_rsp;
-      extern triton::arch::Register x86_reg_esp;
-      extern triton::arch::Register x86_reg_sp;
-      extern triton::arch::Register x86_reg_spl;
-      extern triton::arch::Register x86_reg_stack;
-
-      extern triton::arch::Register x86_reg_rbp;
-      extern triton::arch::Register x86_reg_ebp;
-      extern triton::arch::Register x86_reg_bp;
-      extern triton::arch::Register x86_reg_bpl;
-
-      extern triton::arch::Register x86_reg_rip;
-      extern triton::arch::Register x86_reg_eip;
-      extern triton::arch::Register x86_reg_ip;
-      extern triton::arch::Register x86_reg_pc;
-
-      extern triton::arch::Register x86_reg_eflags;
-
-      extern triton::arch::Register x86_reg_r8;
-      extern triton::arch::Register x86_reg_r8d;
-      extern triton::arch::Register x86_reg_r8w;
-      extern triton::arch::Register x86_reg_r8b;
-
-      extern triton::arch::Register x86_reg_r9;
-      extern triton::arch::Register x86_reg_r9d;
-      extern triton::arch::Register x86_reg_r9w;
-      extern triton::arch::Register x86_reg_r9b;
-
-      extern triton::arch::Register x86_reg_r10;
-      extern triton::arch::Register x86_reg_r10d;
-      extern triton::arch::Register x86_reg_r10w;
-      extern triton::arch::Register x86_reg_r10b;
-
-      extern triton::arch::Register x86_reg_r11;
-      extern triton::arch::Register x86_reg_r11d;
-      extern triton::arch::Register x86_reg_r11w;
-      extern triton::arch::Register x86_reg_r11b;
-
-      extern triton::arch::Register x86_reg_r12;
-      extern triton::arch::Register x86_reg_r12d;
-      extern triton::arch::Register x86_reg_r12w;
-      extern triton::arch::Register x86_reg_r12b;
-
-      extern triton::arch::Register x86_reg_r13;
-      extern triton::arch::Register x86_reg_r13d;
-      extern triton::arch::Register x86_reg_r13w;
-      extern triton::arch::Register x86_reg_r13b;
-
-      extern triton::arch::Register x86_reg_r14;
-      extern triton::arch::Register x86_reg_r14d;
-      extern triton::arch::Register x86_reg_r14w;
-      extern triton::arch::Register x86_reg_r14b;
-
-      extern triton::arch::Register x86_reg_r15;
-      extern triton::arch::Register x86_reg_r15d;
-      extern triton::arch::Register x86_reg_r15w;
-      extern triton::arch::Register x86_reg_r15b;
-
-      extern triton::arch::Register x86_reg_mm0;
-      extern triton::arch::Register x86_reg_mm1;
-      extern triton::arch::Register x86_reg_mm2;
-      extern triton::arch::Register x86_reg_mm3;
-      extern triton::arch::Register x86_reg_mm4;
-      extern triton::arch::Register x86_reg_mm5;
-      extern triton::arch::Register x86_reg_mm6;
-      extern triton::arch::Register x86_reg_mm7;
-
-      extern triton::arch::Register x86_reg_xmm0;
-      extern triton::arch::Register x86_reg_xmm1;
-      extern triton::arch::Register x86_reg_xmm2;
-      extern triton::arch::Register x86_reg_xmm3;
-      extern triton::arch::Register x86_reg_xmm4;
-      extern triton::arch::Register x86_reg_xmm5;
-      extern triton::arch::Register x86_reg_xmm6;
-      extern triton::arch::Register x86_reg_xmm7;
-      extern triton::arch::Register x86_reg_xmm8;
-      extern triton::arch::Register x86_reg_xmm9;
-      extern triton::arch::Register x86_reg_xmm10;
-      extern triton::arch::Register x86_reg_xmm11;
-      extern triton::arch::Register x86_reg_xmm12;
-      extern triton::arch::Register x86_reg_xmm13;
-      extern triton::arch::Register x86_reg_xmm14;
-      extern triton::arch::Register x86_reg_xmm15;
-
-      extern triton::arch::Register x86_reg_ymm0;
-      extern triton::arch::Register x86_reg_ymm1;
-      extern triton::arch::Register x86_reg_ymm2;
-      extern triton::arch::Register x86_reg_ymm3;
-      extern triton::arch::Register x86_reg_ymm4;
-      extern triton::arch::Register x86_reg_ymm5;
-      extern triton::arch::Register x86_reg_ymm6;
-      extern triton::arch::Register x86_reg_ymm7;
-      extern triton::arch::Register x86_reg_ymm8;
-      extern triton::arch::Register x86_reg_ymm9;
-      extern triton::arch::Register x86_reg_ymm10;
-      extern triton::arch::Register x86_reg_ymm11;
-      extern triton::arch::Register x86_reg_ymm12;
-      extern triton::arch::Register x86_reg_ymm13;
-      extern triton::arch::Register x86_reg_ymm14;
-      extern triton::arch::Register x86_reg_ymm15;
-
-      extern triton::arch::Register x86_reg_zmm0;
-      extern triton::arch::Register x86_reg_zmm1;
-      extern triton::arch::Register x86_reg_zmm2;
-      extern triton::arch::Register x86_reg_zmm3;
-      extern triton::arch::Register x86_reg_zmm4;
-      extern triton::arch::Register x86_reg_zmm5;
-      extern triton::arch::Register x86_reg_zmm6;
-      extern triton::arch::Register x86_reg_zmm7;
-      extern triton::arch::Register x86_reg_zmm8;
-      extern triton::arch::Register x86_reg_zmm9;
-      extern triton::arch::Register x86_reg_zmm10;
-      extern triton::arch::Register x86_reg_zmm11;
-      extern triton::arch::Register x86_reg_zmm12;
-      extern triton::arch::Register x86_reg_zmm13;
-      extern triton::arch::Register x86_reg_zmm14;
-      extern triton::arch::Register x86_reg_zmm15;
-      extern triton::arch::Register x86_reg_zmm16;
-      extern triton::arch::Register x86_reg_zmm17;
-      extern triton::arch::Register x86_reg_zmm18;
-      extern triton::arch::Register x86_reg_zmm19;
-      extern triton::arch::Register x86_reg_zmm20;
-      extern triton::arch::Register x86_reg_zmm21;
-      extern triton::arch::Register x86_reg_zmm22;
-      extern triton::arch::Register x86_reg_zmm23;
-      extern triton::arch::Register x86_reg_zmm24;
-      extern triton::arch::Register x86_reg_zmm25;
-      extern triton::arch::Register x86_reg_zmm26;
-      extern triton::arch::Register x86_reg_zmm27;
-      extern triton::arch::Register x86_reg_zmm28;
-      extern triton::arch::Register x86_reg_zmm29;
-      extern triton::arch::Register x86_reg_zmm30;
-      extern triton::arch::Register x86_reg_zmm31;
-
-      extern triton::arch::Register x86_reg_mxcsr;
-
-      extern triton::arch::Register x86_reg_cr0;
-      extern triton::arch::Register x86_reg_cr1;
-      extern triton::arch::Register x86_reg_cr2;
-      extern triton::arch::Register x86_reg_cr3;
-      extern triton::arch::Register x86_reg_cr4;
-      extern triton::arch::Register x86_reg_cr5;
-      extern triton::arch::Register x86_reg_cr6;
-      extern triton::arch::Register x86_reg_cr7;
-      extern triton::arch::Register x86_reg_cr8;
-      extern triton::arch::Register x86_reg_cr9;
-      extern triton::arch::Register x86_reg_cr10;
-      extern triton::arch::Register x86_reg_cr11;
-      extern triton::arch::Register x86_reg_cr12;
-      extern triton::arch::Register x86_reg_cr13;
-      extern triton::arch::Register x86_reg_cr14;
-      extern triton::arch::Register x86_reg_cr15;
+      //! \class x86Specifications
+      /*! \brief The x86Specifications class defines specifications about the x86 and x86_64 CPU */
+      class x86Specifications {
+        private:
+          //! Builds the specifications of all registers according to the arch (32 or 64-bits) from the register table, indexed by register ID.
+          static std::vector<triton::arch::RegisterSpecification> buildX86RegisterSpecifications(triton::uint32 arch);
 
-      extern triton::arch::Register x86_reg_af;
-      extern triton::arch::Register x86_reg_cf;
-      extern triton::arch::Register x86_reg_df;
-      extern triton::arch::Register x86_reg_if;
-      extern triton::arch::Register x86_reg_of;
-      extern triton::arch::Register x86_reg_pf;
-      extern triton::arch::Register x86_reg_sf;
-      extern triton::arch::Register x86_reg_tf;
-      extern triton::arch::Register x86_reg_zf;
+        protected:
+          //! The registers of the CPU, indexed by register ID. A register which does not exist on the arch is invalid.
+          std::vector<triton::arch::Register> x86Registers;
 
-      extern triton::arch::Register x86_reg_ie;
-      extern triton::arch::Register x86_reg_de;
-      extern triton::arch::Register x86_reg_ze;
-      extern triton::arch::Register x86_reg_oe;
-      extern triton::arch::Register x86_reg_ue;
-      extern triton::arch::Register x86_reg_pe;
-      extern triton::arch::Register x86_reg_daz;
-      extern triton::arch::Register x86_reg_im;
-      extern triton::arch::Register x86_reg_dm;
-      extern triton::arch::Register x86_reg_zm;
-      extern triton::arch::Register x86_reg_om;
-      extern triton::arch::Register x86_reg_um;
-      extern triton::arch::Register x86_reg_pm;
-      extern triton::arch::Register x86_reg_rl;
-      extern triton::arch::Register x86_reg_rh;
-      extern triton::arch::Register x86_reg_fz;
+          //! The program counter of the CPU.
+          triton::arch::Register x86ProgramCounter;
 
-      extern triton::arch::Register x86_reg_cs;
-      extern triton::arch::Register x86_reg_ds;
-      extern triton::arch::Register x86_reg_es;
-      extern triton::arch::Register x86_reg_fs;
-      extern triton::arch::Register x86_reg_gs;
-      extern triton::arch::Register x86_reg_ss;
+          //! The stack pointer of the CPU.
+          triton::arch::Register x86StackPointer;
 
+          //! Builds the registers of the CPU. Must be called under the scope of the context which owns the CPU.
+          void initX86Registers(triton::uint32 pcId, triton::uint32 stackId);
 
-      //! \class x86Specifications
-      /*! \brief The x86Specifications class defines specifications about the x86 and x86_64 CPU */
-      class x86Specifications {
         public:
           //! Constructor.
           x86Specifications();
@@ -270,20 +65,30 @@ namespace triton {
           //! Destructor.
           virtual ~x86Specifications();
 
-          //! Returns all specifications about a register from its ID according to the arch (32 or 64-bits).
-          triton::arch::RegisterSpecification getX86RegisterSpecification(triton::uint32 arch, triton::uint32 regId) const;
+          //! Returns all specifications about a register from its ID according to the arch (32 or 64-bits). Served from a table built once per arch.
+          const triton::arch::RegisterSpecification& getX86RegisterSpecification(triton::uint32 arch, triton::uint32 regId) const;
 
-          //! Converts a capstone's register id to a triton's register id.
+          //! Converts a capstone's register id to a triton's register id. Served from a table indexed by capstone's id.
           triton::uint32 capstoneRegisterToTritonRegister(triton::uint32 id) const;
 
-          //! Converts a capstone's instruction id to a triton's instruction id.
+          //! Converts a capstone's instruction id to a triton's instruction id. Served from a table indexed by capstone's id.
           triton::uint32 capstoneInstructionToTritonInstruction(triton::uint32 id) const;
 
-          //! Converts a capstone's prefix id to a triton's prefix id.
+          //! Converts a capstone's prefix id to a triton's prefix id. Served from a table indexed by capstone's id.
           triton::uint32 capstonePrefixToTritonPrefix(triton::uint32 id) const;
       };
 
 
+      //! Returns the register of the current context's CPU from its ID. The register is invalid if there is no architecture.
+      triton::arch::Register& getX86Register(triton::uint32 regId);
+
+      //! Returns the program counter of the current context's CPU.
+      triton::arch::Register& getX86ProgramCounter(void);
+
+      //! Returns the stack pointer of the current context's CPU.
+      triton::arch::Register& getX86StackPointer(void);
+
+
       //! The list of registers.
       enum registers_e {
         ID_REG_INVALID = 0, //!< invalid = 0
@@ -521,9 +326,6 @@ namespace triton {
         ID_REG_LAST_ITEM //!< must be the last item
       };
 
-      //! Global set of registers.
-      extern triton::arch::Register* x86_regs[ID_REG_LAST_ITEM];
-
       /*! \brief The list of prefixes.
        *
        *  \description
@@ -1852,395 +1654,395 @@ namespace triton {
 };
 
 
-//! Temporary INVALID register.
-#define TRITON_X86_REG_INVALID  triton::arch::x86::x86_reg_invalid
-//! Temporary RAX register.
-#define TRITON_X86_REG_RAX      triton::arch::x86::x86_reg_rax
-//! Temporary EAX register.
-#define TRITON_X86_REG_EAX      triton::arch::x86::x86_reg_eax
-//! Temporary AX register.
-#define TRITON_X86_REG_AX       triton::arch::x86::x86_reg_ax
-//! Temporary AH register.
-#define TRITON_X86_REG_AH       triton::arch::x86::x86_reg_ah
-//! Temporary AL register.
-#define TRITON_X86_REG_AL       triton::arch::x86::x86_reg_al
-//! Temporary RBX register.
-#define TRITON_X86_REG_RBX      triton::arch::x86::x86_reg_rbx
-//! Temporary EBX register.
-#define TRITON_X86_REG_EBX      triton::arch::x86::x86_reg_ebx
-//! Temporary BX register.
-#define TRITON_X86_REG_BX       triton::arch::x86::x86_reg_bx
-//! Temporary BH register.
-#define TRITON_X86_REG_BH       triton::arch::x86::x86_reg_bh
-//! Temporary BL register.
-#define TRITON_X86_REG_BL       triton::arch::x86::x86_reg_bl
-//! Temporary RCX register.
-#define TRITON_X86_REG_RCX      triton::arch::x86::x86_reg_rcx
-//! Temporary ECX register.
-#define TRITON_X86_REG_ECX      triton::arch::x86::x86_reg_ecx
-//! Temporary CX register.
-#define TRITON_X86_REG_CX       triton::arch::x86::x86_reg_cx
-//! Temporary CH register.
-#define TRITON_X86_REG_CH       triton::arch::x86::x86_reg_ch
-//! Temporary CL register.
-#define TRITON_X86_REG_CL       triton::arch::x86::x86_reg_cl
-//! Temporary RDX register.
-#define TRITON_X86_REG_RDX      triton::arch::x86::x86_reg_rdx
-//! Temporary EDX register.
-#define TRITON_X86_REG_EDX      triton::arch::x86::x86_reg_edx
-//! Temporary DX register.
-#define TRITON_X86_REG_DX       triton::arch::x86::x86_reg_dx
-//! Temporary DH register.
-#define TRITON_X86_REG_DH       triton::arch::x86::x86_reg_dh
-//! Temporary DL register.
-#define TRITON_X86_REG_DL       triton::arch::x86::x86_reg_dl
-//! Temporary RDI register.
-#define TRITON_X86_REG_RDI      triton::arch::x86::x86_reg_rdi
-//! Temporary EDI register.
-#define TRITON_X86_REG_EDI      triton::arch::x86::x86_reg_edi
-//! Temporary DI register.
-#define TRITON_X86_REG_DI       triton::arch::x86::x86_reg_di
-//! Temporary DIL register.
-#define TRITON_X86_REG_DIL      triton::arch::x86::x86_reg_dil
-//! Temporary RSI register.
-#define TRITON_X86_REG_RSI      triton::arch::x86::x86_reg_rsi
-//! Temporary ESI register.
-#define TRITON_X86_REG_ESI      triton::arch::x86::x86_reg_esi
-//! Temporary SI register.
-#define TRITON_X86_REG_SI       triton::arch::x86::x86_reg_si
-//! Temporary SIL register.
-#define TRITON_X86_REG_SIL      triton::arch::x86::x86_reg_sil
-//! Temporary RSP register.
-#define TRITON_X86_REG_RSP      triton::arch::x86::x86_reg_rsp
-//! Temporary ESP register.
-#define TRITON_X86_REG_ESP      triton::arch::x86::x86_reg_esp
-//! Temporary SP register.
-#define TRITON_X86_REG_SP       triton::arch::x86::x86_reg_sp
-//! Temporary SPL register.
-#define TRITON_X86_REG_SPL      triton::arch::x86::x86_reg_spl
-//! Temporary STACK register.
-#define TRITON_X86_REG_STACK    triton::arch::x86::x86_reg_stack
-//! Temporary RBP register.
-#define TRITON_X86_REG_RBP      triton::arch::x86::x86_reg_rbp
-//! Temporary EBP register.
-#define TRITON_X86_REG_EBP      triton::arch::x86::x86_reg_ebp
-//! Temporary BP register.
-#define TRITON_X86_REG_BP       triton::arch::x86::x86_reg_bp
-//! Temporary BPL register.
-#define TRITON_X86_REG_BPL      triton::arch::x86::x86_reg_bpl
-//! Temporary RIP register.
-#define TRITON_X86_REG_RIP      triton::arch::x86::x86_reg_rip
-//! Temporary EIP register.
-#define TRITON_X86_REG_EIP      triton::arch::x86::x86_reg_eip
-//! Temporary IP register.
-#define TRITON_X86_REG_IP       triton::arch::x86::x86_reg_ip
-//! Temporary PC register.
-#define TRITON_X86_REG_PC       triton::arch::x86::x86_reg_pc
-//! Temporary EFLAGS register.
-#define TRITON_X86_REG_EFLAGS   triton::arch::x86::x86_reg_eflags
-//! Temporary R8 register.
-#define TRITON_X86_REG_R8       triton::arch::x86::x86_reg_r8
-//! Temporary R8D register.
-#define TRITON_X86_REG_R8D      triton::arch::x86::x86_reg_r8d
-//! Temporary R8W register.
-#define TRITON_X86_REG_R8W      triton::arch::x86::x86_reg_r8w
-//! Temporary R8B register.
-#define TRITON_X86_REG_R8B      triton::arch::x86::x86_reg_r8b
-//! Temporary R9 register.
-#define TRITON_X86_REG_R9       triton::arch::x86::x86_reg_r9
-//! Temporary R9D register.
-#define TRITON_X86_REG_R9D      triton::arch::x86::x86_reg_r9d
-//! Temporary R9W register.
-#define TRITON_X86_REG_R9W      triton::arch::x86::x86_reg_r9w
-//! Temporary R9B register.
-#define TRITON_X86_REG_R9B      triton::arch::x86::x86_reg_r9b
-//! Temporary R10 register.
-#define TRITON_X86_REG_R10      triton::arch::x86::x86_reg_r10
-//! Temporary R10D register.
-#define TRITON_X86_REG_R10D     triton::arch::x86::x86_reg_r10d
-//! Temporary R10W register.
-#define TRITON_X86_REG_R10W     triton::arch::x86::x86_reg_r10w
-//! Temporary R10B register.
-#define TRITON_X86_REG_R10B     triton::arch::x86::x86_reg_r10b
-//! Temporary R11 register.
-#define TRITON_X86_REG_R11      triton::arch::x86::x86_reg_r11
-//! Temporary R11D register.
-#define TRITON_X86_REG_R11D     triton::arch::x86::x86_reg_r11d
-//! Temporary R11W register.
-#define TRITON_X86_REG_R11W     triton::arch::x86::x86_reg_r11w
-//! Temporary R11B register.
-#define TRITON_X86_REG_R11B     triton::arch::x86::x86_reg_r11b
-//! Temporary R12 register.
-#define TRITON_X86_REG_R12      triton::arch::x86::x86_reg_r12
-//! Temporary R12D register.
-#define TRITON_X86_REG_R12D     triton::arch::x86::x86_reg_r12d
-//! Temporary R12W register.
-#define TRITON_X86_REG_R12W     triton::arch::x86::x86_reg_r12w
-//! Temporary R12B register.
-#define TRITON_X86_REG_R12B     triton::arch::x86::x86_reg_r12b
-//! Temporary R13 register.
-#define TRITON_X86_REG_R13      triton::arch::x86::x86_reg_r13
-//! Temporary R13D register.
-#define TRITON_X86_REG_R13D     triton::arch::x86::x86_reg_r13d
-//! Temporary R13W register.
-#define TRITON_X86_REG_R13W     triton::arch::x86::x86_reg_r13w
-//! Temporary R13B register.
-#define TRITON_X86_REG_R13B     triton::arch::x86::x86_reg_r13b
-//! Temporary R14 register.
-#define TRITON_X86_REG_R14      triton::arch::x86::x86_reg_r14
-//! Temporary R14D register.
-#define TRITON_X86_REG_R14D     triton::arch::x86::x86_reg_r14d
-//! Temporary R14W register.
-#define TRITON_X86_REG_R14W     triton::arch::x86::x86_reg_r14w
-//! Temporary R14B register.
-#define TRITON_X86_REG_R14B     triton::arch::x86::x86_reg_r14b
-//! Temporary R15 register.
-#define TRITON_X86_REG_R15      triton::arch::x86::x86_reg_r15
-//! Temporary R15D register.
-#define TRITON_X86_REG_R15D     triton::arch::x86::x86_reg_r15d
-//! Temporary R15W register.
-#define TRITON_X86_REG_R15W     triton::arch::x86::x86_reg_r15w
-//! Temporary R15B register.
-#define TRITON_X86_REG_R15B     triton::arch::x86::x86_reg_r15b
-//! Temporary MM0 register.
-#define TRITON_X86_REG_MM0      triton::arch::x86::x86_reg_mm0
-//! Temporary MM1 register.
-#define TRITON_X86_REG_MM1      triton::arch::x86::x86_reg_mm1
-//! Temporary MM2 register.
-#define TRITON_X86_REG_MM2      triton::arch::x86::x86_reg_mm2
-//! Temporary MM3 register.
-#define TRITON_X86_REG_MM3      triton::arch::x86::x86_reg_mm3
-//! Temporary MM4 register.
-#define TRITON_X86_REG_MM4      triton::arch::x86::x86_reg_mm4
-//! Temporary MM5 register.
-#define TRITON_X86_REG_MM5      triton::arch::x86::x86_reg_mm5
-//! Temporary MM6 register.
-#define TRITON_X86_REG_MM6      triton::arch::x86::x86_reg_mm6
-//! Temporary MM7 register.
-#define TRITON_X86_REG_MM7      triton::arch::x86::x86_reg_mm7
-//! Temporary XMM0 register.
-#define TRITON_X86_REG_XMM0     triton::arch::x86::x86_reg_xmm0
-//! Temporary XMM1 register.
-#define TRITON_X86_REG_XMM1     triton::arch::x86::x86_reg_xmm1
-//! Temporary XMM2 register.
-#define TRITON_X86_REG_XMM2     triton::arch::x86::x86_reg_xmm2
-//! Temporary XMM3 register.
-#define TRITON_X86_REG_XMM3     triton::arch::x86::x86_reg_xmm3
-//! Temporary XMM4 register.
-#define TRITON_X86_REG_XMM4     triton::arch::x86::x86_reg_xmm4
-//! Temporary XMM5 register.
-#define TRITON_X86_REG_XMM5     triton::arch::x86::x86_reg_xmm5
-//! Temporary XMM6 register.
-#define TRITON_X86_REG_XMM6     triton::arch::x86::x86_reg_xmm6
-//! Temporary XMM7 register.
-#define TRITON_X86_REG_XMM7     triton::arch::x86::x86_reg_xmm7
-//! Temporary XMM8 register.
-#define TRITON_X86_REG_XMM8     triton::arch::x86::x86_reg_xmm8
-//! Temporary XMM9 register.
-#define TRITON_X86_REG_XMM9     triton::arch::x86::x86_reg_xmm9
-//! Temporary XMM10 register.
-#define TRITON_X86_REG_XMM10    triton::arch::x86::x86_reg_xmm10
-//! Temporary XMM11 register.
-#define TRITON_X86_REG_XMM11    triton::arch::x86::x86_reg_xmm11
-//! Temporary XMM12 register.
-#define TRITON_X86_REG_XMM12    triton::arch::x86::x86_reg_xmm12
-//! Temporary XMM13 register.
-#define TRITON_X86_REG_XMM13    triton::arch::x86::x86_reg_xmm13
-//! Temporary XMM14 register.
-#define TRITON_X86_REG_XMM14    triton::arch::x86::x86_reg_xmm14
-//! Temporary XMM15 register.
-#define TRITON_X86_REG_XMM15    triton::arch::x86::x86_reg_xmm15
-//! Temporary YMM0 register.
-#define TRITON_X86_REG_YMM0     triton::arch::x86::x86_reg_ymm0
-//! Temporary YMM1 register.
-#define TRITON_X86_REG_YMM1     triton::arch::x86::x86_reg_ymm1
-//! Temporary YMM2 register.
-#define TRITON_X86_REG_YMM2     triton::arch::x86::x86_reg_ymm2
-//! Temporary YMM3 register.
-#define TRITON_X86_REG_YMM3     triton::arch::x86::x86_reg_ymm3
-//! Temporary YMM4 register.
-#define TRITON_X86_REG_YMM4     triton::arch::x86::x86_reg_ymm4
-//! Temporary YMM5 register.
-#define TRITON_X86_REG_YMM5     triton::arch::x86::x86_reg_ymm5
-//! Temporary YMM6 register.
-#define TRITON_X86_REG_YMM6     triton::arch::x86::x86_reg_ymm6
-//! Temporary YMM7 register.
-#define TRITON_X86_REG_YMM7     triton::arch::x86::x86_reg_ymm7
-//! Temporary YMM8 register.
-#define TRITON_X86_REG_YMM8     triton::arch::x86::x86_reg_ymm8
-//! Temporary YMM9 register.
-#define TRITON_X86_REG_YMM9     triton::arch::x86::x86_reg_ymm9
-//! Temporary YMM10 register.
-#define TRITON_X86_REG_YMM10    triton::arch::x86::x86_reg_ymm10
-//! Temporary YMM11 register.
-#define TRITON_X86_REG_YMM11    triton::arch::x86::x86_reg_ymm11
-//! Temporary YMM12 register.
-#define TRITON_X86_REG_YMM12    triton::arch::x86::x86_reg_ymm12
-//! Temporary YMM13 register.
-#define TRITON_X86_REG_YMM13    triton::arch::x86::x86_reg_ymm13
-//! Temporary YMM14 register.
-#define TRITON_X86_REG_YMM14    triton::arch::x86::x86_reg_ymm14
-//! Temporary YMM15 register.
-#define TRITON_X86_REG_YMM15    triton::arch::x86::x86_reg_ymm15
-//! Temporary ZMM0 register.
-#define TRITON_X86_REG_ZMM0     triton::arch::x86::x86_reg_zmm0
-//! Temporary ZMM1 register.
-#define TRITON_X86_REG_ZMM1     triton::arch::x86::x86_reg_zmm1
-//! Temporary ZMM2 register.
-#define TRITON_X86_REG_ZMM2     triton::arch::x86::x86_reg_zmm2
-//! Temporary ZMM3 register.
-#define TRITON_X86_REG_ZMM3     triton::arch::x86::x86_reg_zmm3
-//! Temporary ZMM4 register.
-#define TRITON_X86_REG_ZMM4     triton::arch::x86::x86_reg_zmm4
-//! Temporary ZMM5 register.
-#define TRITON_X86_REG_ZMM5     triton::arch::x86::x86_reg_zmm5
-//! Temporary ZMM6 register.
-#define TRITON_X86_REG_ZMM6     triton::arch::x86::x86_reg_zmm6
-//! Temporary ZMM7 register.
-#define TRITON_X86_REG_ZMM7     triton::arch::x86::x86_reg_zmm7
-//! Temporary ZMM8 register.
-#define TRITON_X86_REG_ZMM8     triton::arch::x86::x86_reg_zmm8
-//! Temporary ZMM9 register.
-#define TRITON_X86_REG_ZMM9     triton::arch::x86::x86_reg_zmm9
-//! Temporary ZMM10 register.
-#define TRITON_X86_REG_ZMM10    triton::arch::x86::x86_reg_zmm10
-//! Temporary ZMM11 register.
-#define TRITON_X86_REG_ZMM11    triton::arch::x86::x86_reg_zmm11
-//! Temporary ZMM12 register.
-#define TRITON_X86_REG_ZMM12    triton::arch::x86::x86_reg_zmm12
-//! Temporary ZMM13 register.
-#define TRITON_X86_REG_ZMM13    triton::arch::x86::x86_reg_zmm13
-//! Temporary ZMM14 register.
-#define TRITON_X86_REG_ZMM14    triton::arch::x86::x86_reg_zmm14
-//! Temporary ZMM15 register.
-#define TRITON_X86_REG_ZMM15    triton::arch::x86::x86_reg_zmm15
-//! Temporary ZMM16 register.
-#define TRITON_X86_REG_ZMM16    triton::arch::x86::x86_reg_zmm16
-//! Temporary ZMM17 register.
-#define TRITON_X86_REG_ZMM17    triton::arch::x86::x86_reg_zmm17
-//! Temporary ZMM18 register.
-#define TRITON_X86_REG_ZMM18    triton::arch::x86::x86_reg_zmm18
-//! Temporary ZMM19 register.
-#define TRITON_X86_REG_ZMM19    triton::arch::x86::x86_reg_zmm19
-//! Temporary ZMM20 register.
-#define TRITON_X86_REG_ZMM20    triton::arch::x86::x86_reg_zmm20
-//! Temporary ZMM21 register.
-#define TRITON_X86_REG_ZMM21    triton::arch::x86::x86_reg_zmm21
-//! Temporary ZMM22 register.
-#define TRITON_X86_REG_ZMM22    triton::arch::x86::x86_reg_zmm22
-//! Temporary ZMM23 register.
-#define TRITON_X86_REG_ZMM23    triton::arch::x86::x86_reg_zmm23
-//! Temporary ZMM24 register.
-#define TRITON_X86_REG_ZMM24    triton::arch::x86::x86_reg_zmm24
-//! Temporary ZMM25 register.
-#define TRITON_X86_REG_ZMM25    triton::arch::x86::x86_reg_zmm25
-//! Temporary ZMM26 register.
-#define TRITON_X86_REG_ZMM26    triton::arch::x86::x86_reg_zmm26
-//! Temporary ZMM27 register.
-#define TRITON_X86_REG_ZMM27    triton::arch::x86::x86_reg_zmm27
-//! Temporary ZMM28 register.
-#define TRITON_X86_REG_ZMM28    triton::arch::x86::x86_reg_zmm28
-//! Temporary ZMM29 register.
-#define TRITON_X86_REG_ZMM29    triton::arch::x86::x86_reg_zmm29
-//! Temporary ZMM30 register.
-#define TRITON_X86_REG_ZMM30    triton::arch::x86::x86_reg_zmm30
-//! Temporary ZMM31 register.
-#define TRITON_X86_REG_ZMM31    triton::arch::x86::x86_reg_zmm31
-//! Temporary MXCSR register.
-#define TRITON_X86_REG_MXCSR    triton::arch::x86::x86_reg_mxcsr
-//! Temporary CR0 register.
-#define TRITON_X86_REG_CR0     triton::arch::x86::x86_reg_cr0
-//! Temporary CR1 register.
-#define TRITON_X86_REG_CR1     triton::arch::x86::x86_reg_cr1
-//! Temporary CR2 register.
-#define TRITON_X86_REG_CR2     triton::arch::x86::x86_reg_cr2
-//! Temporary CR3 register.
-#define TRITON_X86_REG_CR3     triton::arch::x86::x86_reg_cr3
-//! Temporary CR4 register.
-#define TRITON_X86_REG_CR4     triton::arch::x86::x86_reg_cr4
-//! Temporary CR5 register.
-#define TRITON_X86_REG_CR5     triton::arch::x86::x86_reg_cr5
-//! Temporary CR6 register.
-#define TRITON_X86_REG_CR6     triton::arch::x86::x86_reg_cr6
-//! Temporary CR7 register.
-#define TRITON_X86_REG_CR7     triton::arch::x86::x86_reg_cr7
-//! Temporary CR8 register.
-#define TRITON_X86_REG_CR8     triton::arch::x86::x86_reg_cr8
-//! Temporary CR9 register.
-#define TRITON_X86_REG_CR9     triton::arch::x86::x86_reg_cr9
-//! Temporary CR10 register.
-#define TRITON_X86_REG_CR10    triton::arch::x86::x86_reg_cr10
-//! Temporary CR11 register.
-#define TRITON_X86_REG_CR11    triton::arch::x86::x86_reg_cr11
-//! Temporary CR12 register.
-#define TRITON_X86_REG_CR12    triton::arch::x86::x86_reg_cr12
-//! Temporary CR13 register.
-#define TRITON_X86_REG_CR13    triton::arch::x86::x86_reg_cr13
-//! Temporary CR14 register.
-#define TRITON_X86_REG_CR14    triton::arch::x86::x86_reg_cr14
-//! Temporary CR15 register.
-#define TRITON_X86_REG_CR15    triton::arch::x86::x86_reg_cr15
-//! Temporary IE register.
-#define TRITON_X86_REG_IE       triton::arch::x86::x86_reg_ie
-//! Temporary DE register.
-#define TRITON_X86_REG_DE       triton::arch::x86::x86_reg_de
-//! Temporary ZE register.
-#define TRITON_X86_REG_ZE       triton::arch::x86::x86_reg_ze
-//! Temporary OE register.
-#define TRITON_X86_REG_OE       triton::arch::x86::x86_reg_oe
-//! Temporary UE register.
-#define TRITON_X86_REG_UE       triton::arch::x86::x86_reg_ue
-//! Temporary PE register.
-#define TRITON_X86_REG_PE       triton::arch::x86::x86_reg_pe
-//! Temporary DAZ register.
-#define TRITON_X86_REG_DAZ      triton::arch::x86::x86_reg_daz
-//! Temporary IM register.
-#define TRITON_X86_REG_IM       triton::arch::x86::x86_reg_im
-//! Temporary DM register.
-#define TRITON_X86_REG_DM       triton::arch::x86::x86_reg_dm
-//! Temporary ZM register.
-#define TRITON_X86_REG_ZM       triton::arch::x86::x86_reg_zm
-//! Temporary OM register.
-#define TRITON_X86_REG_OM       triton::arch::x86::x86_reg_om
-//! Temporary UM register.
-#define TRITON_X86_REG_UM       triton::arch::x86::x86_reg_um
-//! Temporary PM register.
-#define TRITON_X86_REG_PM       triton::arch::x86::x86_reg_pm
-//! Temporary RL register.
-#define TRITON_X86_REG_RL       triton::arch::x86::x86_reg_rl
-//! Temporary RH register.
-#define TRITON_X86_REG_RH       triton::arch::x86::x86_reg_rh
-//! Temporary FZ register.
-#define TRITON_X86_REG_FZ       triton::arch::x86::x86_reg_fz
-//! Temporary AF register.
-#define TRITON_X86_REG_AF       triton::arch::x86::x86_reg_af
-//! Temporary CF register.
-#define TRITON_X86_REG_CF       triton::arch::x86::x86_reg_cf
-//! Temporary DF register.
-#define TRITON_X86_REG_DF       triton::arch::x86::x86_reg_df
-//! Temporary IF register.
-#define TRITON_X86_REG_IF       triton::arch::x86::x86_reg_if
-//! Temporary OF register.
-#define TRITON_X86_REG_OF       triton::arch::x86::x86_reg_of
-//! Temporary PF register.
-#define TRITON_X86_REG_PF       triton::arch::x86::x86_reg_pf
-//! Temporary SF register.
-#define TRITON_X86_REG_SF       triton::arch::x86::x86_reg_sf
-//! Temporary TF register.
-#define TRITON_X86_REG_TF       triton::arch::x86::x86_reg_tf
-//! Temporary ZF register.
-#define TRITON_X86_REG_ZF       triton::arch::x86::x86_reg_zf
-//! Temporary CS register.
-#define TRITON_X86_REG_CS       triton::arch::x86::x86_reg_cs
-//! Temporary DS register.
-#define TRITON_X86_REG_DS       triton::arch::x86::x86_reg_ds
-//! Temporary ES register.
-#define TRITON_X86_REG_ES       triton::arch::x86::x86_reg_es
-//! Temporary FS register.
-#define TRITON_X86_REG_FS       triton::arch::x86::x86_reg_fs
-//! Temporary GS register.
-#define TRITON_X86_REG_GS       triton::arch::x86::x86_reg_gs
-//! Temporary SS register.
-#define TRITON_X86_REG_SS       triton::arch::x86::x86_reg_ss
+//! The INVALID register of the current context.
+#define TRITON_X86_REG_INVALID  triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_INVALID)
+//! The RAX register of the current context.
+#define TRITON_X86_REG_RAX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RAX)
+//! The EAX register of the current context.
+#define TRITON_X86_REG_EAX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EAX)
+//! The AX register of the current context.
+#define TRITON_X86_REG_AX       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_AX)
+//! The AH register of the current context.
+#define TRITON_X86_REG_AH       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_AH)
+//! The AL register of the current context.
+#define TRITON_X86_REG_AL       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_AL)
+//! The RBX register of the current context.
+#define TRITON_X86_REG_RBX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RBX)
+//! The EBX register of the current context.
+#define TRITON_X86_REG_EBX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EBX)
+//! The BX register of the current context.
+#define TRITON_X86_REG_BX       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_BX)
+//! The BH register of the current context.
+#define TRITON_X86_REG_BH       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_BH)
+//! The BL register of the current context.
+#define TRITON_X86_REG_BL       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_BL)
+//! The RCX register of the current context.
+#define TRITON_X86_REG_RCX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RCX)
+//! The ECX register of the current context.
+#define TRITON_X86_REG_ECX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ECX)
+//! The CX register of the current context.
+#define TRITON_X86_REG_CX       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CX)
+//! The CH register of the current context.
+#define TRITON_X86_REG_CH       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CH)
+//! The CL register of the current context.
+#define TRITON_X86_REG_CL       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CL)
+//! The RDX register of the current context.
+#define TRITON_X86_REG_RDX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RDX)
+//! The EDX register of the current context.
+#define TRITON_X86_REG_EDX      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EDX)
+//! The DX register of the current context.
+#define TRITON_X86_REG_DX       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DX)
+//! The DH register of the current context.
+#define TRITON_X86_REG_DH       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DH)
+//! The DL register of the current context.
+#define TRITON_X86_REG_DL       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DL)
+//! The RDI register of the current context.
+#define TRITON_X86_REG_RDI      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RDI)
+//! The EDI register of the current context.
+#define TRITON_X86_REG_EDI      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EDI)
+//! The DI register of the current context.
+#define TRITON_X86_REG_DI       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DI)
+//! The DIL register of the current context.
+#define TRITON_X86_REG_DIL      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DIL)
+//! The RSI register of the current context.
+#define TRITON_X86_REG_RSI      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RSI)
+//! The ESI register of the current context.
+#define TRITON_X86_REG_ESI      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ESI)
+//! The SI register of the current context.
+#define TRITON_X86_REG_SI       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_SI)
+//! The SIL register of the current context.
+#define TRITON_X86_REG_SIL      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_SIL)
+//! The RSP register of the current context.
+#define TRITON_X86_REG_RSP      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RSP)
+//! The ESP register of the current context.
+#define TRITON_X86_REG_ESP      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ESP)
+//! The SP register of the current context.
+#define TRITON_X86_REG_SP       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_SP)
+//! The SPL register of the current context.
+#define TRITON_X86_REG_SPL      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_SPL)
+//! The STACK register of the current context.
+#define TRITON_X86_REG_STACK    triton::arch::x86::getX86StackPointer()
+//! The RBP register of the current context.
+#define TRITON_X86_REG_RBP      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RBP)
+//! The EBP register of the current context.
+#define TRITON_X86_REG_EBP      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EBP)
+//! The BP register of the current context.
+#define TRITON_X86_REG_BP       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_BP)
+//! The BPL register of the current context.
+#define TRITON_X86_REG_BPL      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_BPL)
+//! The RIP register of the current context.
+#define TRITON_X86_REG_RIP      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RIP)
+//! The EIP register of the current context.
+#define TRITON_X86_REG_EIP      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EIP)
+//! The IP register of the current context.
+#define TRITON_X86_REG_IP       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_IP)
+//! The PC register of the current context.
+#define TRITON_X86_REG_PC       triton::arch::x86::getX86ProgramCounter()
+//! The EFLAGS register of the current context.
+#define TRITON_X86_REG_EFLAGS   triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_EFLAGS)
+//! The R8 register of the current context.
+#define TRITON_X86_REG_R8       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R8)
+//! The R8D register of the current context.
+#define TRITON_X86_REG_R8D      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R8D)
+//! The R8W register of the current context.
+#define TRITON_X86_REG_R8W      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R8W)
+//! The R8B register of the current context.
+#define TRITON_X86_REG_R8B      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R8B)
+//! The R9 register of the current context.
+#define TRITON_X86_REG_R9       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R9)
+//! The R9D register of the current context.
+#define TRITON_X86_REG_R9D      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R9D)
+//! The R9W register of the current context.
+#define TRITON_X86_REG_R9W      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R9W)
+//! The R9B register of the current context.
+#define TRITON_X86_REG_R9B      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R9B)
+//! The R10 register of the current context.
+#define TRITON_X86_REG_R10      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R10)
+//! The R10D register of the current context.
+#define TRITON_X86_REG_R10D     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R10D)
+//! The R10W register of the current context.
+#define TRITON_X86_REG_R10W     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R10W)
+//! The R10B register of the current context.
+#define TRITON_X86_REG_R10B     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R10B)
+//! The R11 register of the current context.
+#define TRITON_X86_REG_R11      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R11)
+//! The R11D register of the current context.
+#define TRITON_X86_REG_R11D     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R11D)
+//! The R11W register of the current context.
+#define TRITON_X86_REG_R11W     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R11W)
+//! The R11B register of the current context.
+#define TRITON_X86_REG_R11B     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R11B)
+//! The R12 register of the current context.
+#define TRITON_X86_REG_R12      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R12)
+//! The R12D register of the current context.
+#define TRITON_X86_REG_R12D     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R12D)
+//! The R12W register of the current context.
+#define TRITON_X86_REG_R12W     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R12W)
+//! The R12B register of the current context.
+#define TRITON_X86_REG_R12B     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R12B)
+//! The R13 register of the current context.
+#define TRITON_X86_REG_R13      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R13)
+//! The R13D register of the current context.
+#define TRITON_X86_REG_R13D     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R13D)
+//! The R13W register of the current context.
+#define TRITON_X86_REG_R13W     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R13W)
+//! The R13B register of the current context.
+#define TRITON_X86_REG_R13B     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R13B)
+//! The R14 register of the current context.
+#define TRITON_X86_REG_R14      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R14)
+//! The R14D register of the current context.
+#define TRITON_X86_REG_R14D     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R14D)
+//! The R14W register of the current context.
+#define TRITON_X86_REG_R14W     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R14W)
+//! The R14B register of the current context.
+#define TRITON_X86_REG_R14B     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R14B)
+//! The R15 register of the current context.
+#define TRITON_X86_REG_R15      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R15)
+//! The R15D register of the current context.
+#define TRITON_X86_REG_R15D     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R15D)
+//! The R15W register of the current context.
+#define TRITON_X86_REG_R15W     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R15W)
+//! The R15B register of the current context.
+#define TRITON_X86_REG_R15B     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_R15B)
+//! The MM0 register of the current context.
+#define TRITON_X86_REG_MM0      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM0)
+//! The MM1 register of the current context.
+#define TRITON_X86_REG_MM1      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM1)
+//! The MM2 register of the current context.
+#define TRITON_X86_REG_MM2      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM2)
+//! The MM3 register of the current context.
+#define TRITON_X86_REG_MM3      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM3)
+//! The MM4 register of the current context.
+#define TRITON_X86_REG_MM4      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM4)
+//! The MM5 register of the current context.
+#define TRITON_X86_REG_MM5      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM5)
+//! The MM6 register of the current context.
+#define TRITON_X86_REG_MM6      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM6)
+//! The MM7 register of the current context.
+#define TRITON_X86_REG_MM7      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MM7)
+//! The XMM0 register of the current context.
+#define TRITON_X86_REG_XMM0     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM0)
+//! The XMM1 register of the current context.
+#define TRITON_X86_REG_XMM1     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM1)
+//! The XMM2 register of the current context.
+#define TRITON_X86_REG_XMM2     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM2)
+//! The XMM3 register of the current context.
+#define TRITON_X86_REG_XMM3     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM3)
+//! The XMM4 register of the current context.
+#define TRITON_X86_REG_XMM4     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM4)
+//! The XMM5 register of the current context.
+#define TRITON_X86_REG_XMM5     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM5)
+//! The XMM6 register of the current context.
+#define TRITON_X86_REG_XMM6     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM6)
+//! The XMM7 register of the current context.
+#define TRITON_X86_REG_XMM7     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM7)
+//! The XMM8 register of the current context.
+#define TRITON_X86_REG_XMM8     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM8)
+//! The XMM9 register of the current context.
+#define TRITON_X86_REG_XMM9     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM9)
+//! The XMM10 register of the current context.
+#define TRITON_X86_REG_XMM10    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM10)
+//! The XMM11 register of the current context.
+#define TRITON_X86_REG_XMM11    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM11)
+//! The XMM12 register of the current context.
+#define TRITON_X86_REG_XMM12    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM12)
+//! The XMM13 register of the current context.
+#define TRITON_X86_REG_XMM13    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM13)
+//! The XMM14 register of the current context.
+#define TRITON_X86_REG_XMM14    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM14)
+//! The XMM15 register of the current context.
+#define TRITON_X86_REG_XMM15    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_XMM15)
+//! The YMM0 register of the current context.
+#define TRITON_X86_REG_YMM0     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM0)
+//! The YMM1 register of the current context.
+#define TRITON_X86_REG_YMM1     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM1)
+//! The YMM2 register of the current context.
+#define TRITON_X86_REG_YMM2     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM2)
+//! The YMM3 register of the current context.
+#define TRITON_X86_REG_YMM3     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM3)
+//! The YMM4 register of the current context.
+#define TRITON_X86_REG_YMM4     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM4)
+//! The YMM5 register of the current context.
+#define TRITON_X86_REG_YMM5     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM5)
+//! The YMM6 register of the current context.
+#define TRITON_X86_REG_YMM6     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM6)
+//! The YMM7 register of the current context.
+#define TRITON_X86_REG_YMM7     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM7)
+//! The YMM8 register of the current context.
+#define TRITON_X86_REG_YMM8     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM8)
+//! The YMM9 register of the current context.
+#define TRITON_X86_REG_YMM9     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM9)
+//! The YMM10 register of the current context.
+#define TRITON_X86_REG_YMM10    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM10)
+//! The YMM11 register of the current context.
+#define TRITON_X86_REG_YMM11    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM11)
+//! The YMM12 register of the current context.
+#define TRITON_X86_REG_YMM12    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM12)
+//! The YMM13 register of the current context.
+#define TRITON_X86_REG_YMM13    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM13)
+//! The YMM14 register of the current context.
+#define TRITON_X86_REG_YMM14    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM14)
+//! The YMM15 register of the current context.
+#define TRITON_X86_REG_YMM15    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_YMM15)
+//! The ZMM0 register of the current context.
+#define TRITON_X86_REG_ZMM0     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM0)
+//! The ZMM1 register of the current context.
+#define TRITON_X86_REG_ZMM1     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM1)
+//! The ZMM2 register of the current context.
+#define TRITON_X86_REG_ZMM2     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM2)
+//! The ZMM3 register of the current context.
+#define TRITON_X86_REG_ZMM3     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM3)
+//! The ZMM4 register of the current context.
+#define TRITON_X86_REG_ZMM4     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM4)
+//! The ZMM5 register of the current context.
+#define TRITON_X86_REG_ZMM5     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM5)
+//! The ZMM6 register of the current context.
+#define TRITON_X86_REG_ZMM6     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM6)
+//! The ZMM7 register of the current context.
+#define TRITON_X86_REG_ZMM7     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM7)
+//! The ZMM8 register of the current context.
+#define TRITON_X86_REG_ZMM8     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM8)
+//! The ZMM9 register of the current context.
+#define TRITON_X86_REG_ZMM9     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM9)
+//! The ZMM10 register of the current context.
+#define TRITON_X86_REG_ZMM10    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM10)
+//! The ZMM11 register of the current context.
+#define TRITON_X86_REG_ZMM11    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM11)
+//! The ZMM12 register of the current context.
+#define TRITON_X86_REG_ZMM12    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM12)
+//! The ZMM13 register of the current context.
+#define TRITON_X86_REG_ZMM13    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM13)
+//! The ZMM14 register of the current context.
+#define TRITON_X86_REG_ZMM14    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM14)
+//! The ZMM15 register of the current context.
+#define TRITON_X86_REG_ZMM15    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM15)
+//! The ZMM16 register of the current context.
+#define TRITON_X86_REG_ZMM16    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM16)
+//! The ZMM17 register of the current context.
+#define TRITON_X86_REG_ZMM17    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM17)
+//! The ZMM18 register of the current context.
+#define TRITON_X86_REG_ZMM18    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM18)
+//! The ZMM19 register of the current context.
+#define TRITON_X86_REG_ZMM19    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM19)
+//! The ZMM20 register of the current context.
+#define TRITON_X86_REG_ZMM20    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM20)
+//! The ZMM21 register of the current context.
+#define TRITON_X86_REG_ZMM21    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM21)
+//! The ZMM22 register of the current context.
+#define TRITON_X86_REG_ZMM22    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM22)
+//! The ZMM23 register of the current context.
+#define TRITON_X86_REG_ZMM23    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM23)
+//! The ZMM24 register of the current context.
+#define TRITON_X86_REG_ZMM24    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM24)
+//! The ZMM25 register of the current context.
+#define TRITON_X86_REG_ZMM25    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM25)
+//! The ZMM26 register of the current context.
+#define TRITON_X86_REG_ZMM26    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM26)
+//! The ZMM27 register of the current context.
+#define TRITON_X86_REG_ZMM27    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM27)
+//! The ZMM28 register of the current context.
+#define TRITON_X86_REG_ZMM28    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM28)
+//! The ZMM29 register of the current context.
+#define TRITON_X86_REG_ZMM29    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM29)
+//! The ZMM30 register of the current context.
+#define TRITON_X86_REG_ZMM30    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM30)
+//! The ZMM31 register of the current context.
+#define TRITON_X86_REG_ZMM31    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZMM31)
+//! The MXCSR register of the current context.
+#define TRITON_X86_REG_MXCSR    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_MXCSR)
+//! The CR0 register of the current context.
+#define TRITON_X86_REG_CR0     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR0)
+//! The CR1 register of the current context.
+#define TRITON_X86_REG_CR1     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR1)
+//! The CR2 register of the current context.
+#define TRITON_X86_REG_CR2     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR2)
+//! The CR3 register of the current context.
+#define TRITON_X86_REG_CR3     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR3)
+//! The CR4 register of the current context.
+#define TRITON_X86_REG_CR4     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR4)
+//! The CR5 register of the current context.
+#define TRITON_X86_REG_CR5     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR5)
+//! The CR6 register of the current context.
+#define TRITON_X86_REG_CR6     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR6)
+//! The CR7 register of the current context.
+#define TRITON_X86_REG_CR7     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR7)
+//! The CR8 register of the current context.
+#define TRITON_X86_REG_CR8     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR8)
+//! The CR9 register of the current context.
+#define TRITON_X86_REG_CR9     triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR9)
+//! The CR10 register of the current context.
+#define TRITON_X86_REG_CR10    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR10)
+//! The CR11 register of the current context.
+#define TRITON_X86_REG_CR11    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR11)
+//! The CR12 register of the current context.
+#define TRITON_X86_REG_CR12    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR12)
+//! The CR13 register of the current context.
+#define TRITON_X86_REG_CR13    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR13)
+//! The CR14 register of the current context.
+#define TRITON_X86_REG_CR14    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR14)
+//! The CR15 register of the current context.
+#define TRITON_X86_REG_CR15    triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CR15)
+//! The IE register of the current context.
+#define TRITON_X86_REG_IE       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_IE)
+//! The DE register of the current context.
+#define TRITON_X86_REG_DE       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DE)
+//! The ZE register of the current context.
+#define TRITON_X86_REG_ZE       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZE)
+//! The OE register of the current context.
+#define TRITON_X86_REG_OE       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_OE)
+//! The UE register of the current context.
+#define TRITON_X86_REG_UE       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_UE)
+//! The PE register of the current context.
+#define TRITON_X86_REG_PE       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_PE)
+//! The DAZ register of the current context.
+#define TRITON_X86_REG_DAZ      triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DAZ)
+//! The IM register of the current context.
+#define TRITON_X86_REG_IM       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_IM)
+//! The DM register of the current context.
+#define TRITON_X86_REG_DM       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DM)
+//! The ZM register of the current context.
+#define TRITON_X86_REG_ZM       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZM)
+//! The OM register of the current context.
+#define TRITON_X86_REG_OM       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_OM)
+//! The UM register of the current context.
+#define TRITON_X86_REG_UM       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_UM)
+//! The PM register of the current context.
+#define TRITON_X86_REG_PM       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_PM)
+//! The RL register of the current context.
+#define TRITON_X86_REG_RL       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RL)
+//! The RH register of the current context.
+#define TRITON_X86_REG_RH       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_RH)
+//! The FZ register of the current context.
+#define TRITON_X86_REG_FZ       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_FZ)
+//! The AF register of the current context.
+#define TRITON_X86_REG_AF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_AF)
+//! The CF register of the current context.
+#define TRITON_X86_REG_CF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CF)
+//! The DF register of the current context.
+#define TRITON_X86_REG_DF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DF)
+//! The IF register of the current context.
+#define TRITON_X86_REG_IF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_IF)
+//! The OF register of the current context.
+#define TRITON_X86_REG_OF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_OF)
+//! The PF register of the current context.
+#define TRITON_X86_REG_PF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_PF)
+//! The SF register of the current context.
+#define TRITON_X86_REG_SF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_SF)
+//! The TF register of the current context.
+#define TRITON_X86_REG_TF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_TF)
+//! The ZF register of the current context.
+#define TRITON_X86_REG_ZF       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ZF)
+//! The CS register of the current context.
+#define TRITON_X86_REG_CS       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_CS)
+//! The DS register of the current context.
+#define TRITON_X86_REG_DS       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_DS)
+//! The ES register of the current context.
+#define TRITON_X86_REG_ES       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_ES)
+//! The FS register of the current context.
+#define TRITON_X86_REG_FS       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_FS)
+//! The GS register of the current context.
+#define TRITON_X86_REG_GS       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_GS)
+//! The SS register of the current context.
+#define TRITON_X86_REG_SS       triton::arch::x86::getX86Register(triton::arch::x86::ID_REG_SS)
 
 #endif /* TRITON_X86SPECIFICATIONS_H */
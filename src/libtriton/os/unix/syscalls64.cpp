@@ -0,0 +1,474 @@
+
+/*! \file */
+#if defined(__unix__) || defined(__APPLE__)
+#include <syscalls.hpp>
+
+
+
+namespace triton {
+  namespace os {
+    namespace unix {
+
+      const char* syscallmap64[] = {
+        "READ", // __NR_read
+        "WRITE", // __NR_write
+        "OPEN", // __NR_open
+        "CLOSE", // __NR_close
+        "STAT", // __NR_stat
+        "FSTAT", // __NR_fstat
+        "LSTAT", // __NR_lstat
+        "POLL", // __NR_poll
+        "LSEEK", // __NR_lseek
+        "MMAP", // __NR_mmap
+        "MPROTECT", // __NR_mprotect
+        "MUNMAP", // __NR_munmap
+        "BRK", // __NR_brk
+        "RT_SIGACTION", // __NR_rt_sigaction
+        "RT_SIGPROCMASK", // __NR_rt_sigprocmask
+        "RT_SIGRETURN", // __NR_rt_sigreturn
+        "IOCTL", // __NR_ioctl
+        "PREAD64", // __NR_pread64
+        "PWRITE64", // __NR_pwrite64
+        "READV", // __NR_readv
+        "WRITEV", // __NR_writev
+        "ACCESS", // __NR_access
+        "PIPE", // __NR_pipe
+        "SELECT", // __NR_select
+        "SCHED_YIELD", // __NR_sched_yield
+        "MREMAP", // __NR_mremap
+        "MSYNC", // __NR_msync
+        "MINCORE", // __NR_mincore
+        "MADVISE", // __NR_madvise
+        "SHMGET", // __NR_shmget
+        "SHMAT", // __NR_shmat
+        "SHMCTL", // __NR_shmctl
+        "DUP", // __NR_dup
+        "DUP2", // __NR_dup2
+        "PAUSE", // __NR_pause
+        "NANOSLEEP", // __NR_nanosleep
+        "GETITIMER", // __NR_getitimer
+        "ALARM", // __NR_alarm
+        "SETITIMER", // __NR_setitimer
+        "GETPID", // __NR_getpid
+        "SENDFILE", // __NR_sendfile
+        "SOCKET", // __NR_socket
+        "CONNECT", // __NR_connect
+        "ACCEPT", // __NR_accept
+        "SENDTO", // __NR_sendto
+        "RECVFROM", // __NR_recvfrom
+        "SENDMSG", // __NR_sendmsg
+        "RECVMSG", // __NR_recvmsg
+        "SHUTDOWN", // __NR_shutdown
+        "BIND", // __NR_bind
+        "LISTEN", // __NR_listen
+        "GETSOCKNAME", // __NR_getsockname
+        "GETPEERNAME", // __NR_getpeername
+        "SOCKETPAIR", // __NR_socketpair
+        "SETSOCKOPT", // __NR_setsockopt
+        "GETSOCKOPT", // __NR_getsockopt
+        "CLONE", // __NR_clone
+        "FORK", // __NR_fork
+        "VFORK", // __NR_vfork
+        "EXECVE", // __NR_execve
+        "EXIT", // __NR_exit
+        "WAIT4", // __NR_wait4
+        "KILL", // __NR_kill
+        "UNAME", // __NR_uname
+        "SEMGET", // __NR_semget
+        "SEMOP", // __NR_semop
+        "SEMCTL", // __NR_semctl
+        "SHMDT", // __NR_shmdt
+        "MSGGET", // __NR_msgget
+        "MSGSND", // __NR_msgsnd
+        "MSGRCV", // __NR_msgrcv
+        "MSGCTL", // __NR_msgctl
+        "FCNTL", // __NR_fcntl
+        "FLOCK", // __NR_flock
+        "FSYNC", // __NR_fsync
+        "FDATASYNC", // __NR_fdatasync
+        "TRUNCATE", // __NR_truncate
+        "FTRUNCATE", // __NR_ftruncate
+        "GETDENTS", // __NR_getdents
+        "GETCWD", // __NR_getcwd
+        "CHDIR", // __NR_chdir
+        "FCHDIR", // __NR_fchdir
+        "RENAME", // __NR_rename
+        "MKDIR", // __NR_mkdir
+        "RMDIR", // __NR_rmdir
+        "CREAT", // __NR_creat
+        "LINK", // __NR_link
+        "UNLINK", // __NR_unlink
+        "SYMLINK", // __NR_symlink
+        "READLINK", // __NR_readlink
+        "CHMOD", // __NR_chmod
+        "FCHMOD", // __NR_fchmod
+        "CHOWN", // __NR_chown
+        "FCHOWN", // __NR_fchown
+        "LCHOWN", // __NR_lchown
+        "UMASK", // __NR_umask
+        "GETTIMEOFDAY", // __NR_gettimeofday
+        "GETRLIMIT", // __NR_getrlimit
+        "GETRUSAGE", // __NR_getrusage
+        "SYSINFO", // __NR_sysinfo
+        "TIMES", // __NR_times
+        "PTRACE", // __NR_ptrace
+        "GETUID", // __NR_getuid
+        "SYSLOG", // __NR_syslog
+        "GETGID", // __NR_getgid
+        "SETUID", // __NR_setuid
+        "SETGID", // __NR_setgid
+        "GETEUID", // __NR_geteuid
+        "GETEGID", // __NR_getegid
+        "SETPGID", // __NR_setpgid
+        "GETPPID", // __NR_getppid
+        "GETPGRP", // __NR_getpgrp
+        "SETSID", // __NR_setsid
+        "SETREUID", // __NR_setreuid
+        "SETREGID", // __NR_setregid
+        "GETGROUPS", // __NR_getgroups
+        "SETGROUPS", // __NR_setgroups
+        "SETRESUID", // __NR_setresuid
+        "GETRESUID", // __NR_getresuid
+        "SETRESGID", // __NR_setresgid
+        "GETRESGID", // __NR_getresgid
+        "GETPGID", // __NR_getpgid
+        "SETFSUID", // __NR_setfsuid
+        "SETFSGID", // __NR_setfsgid
+        "GETSID", // __NR_getsid
+        "CAPGET", // __NR_capget
+        "CAPSET", // __NR_capset
+        "RT_SIGPENDING", // __NR_rt_sigpending
+        "RT_SIGTIMEDWAIT", // __NR_rt_sigtimedwait
+        "RT_SIGQUEUEINFO", // __NR_rt_sigqueueinfo
+        "RT_SIGSUSPEND", // __NR_rt_sigsuspend
+        "SIGALTSTACK", // __NR_sigaltstack
+        "UTIME", // __NR_utime
+        "MKNOD", // __NR_mknod
+        "USELIB", // __NR_uselib
+        "PERSONALITY", // __NR_personality
+        "USTAT", // __NR_ustat
+        "STATFS", // __NR_statfs
+        "FSTATFS", // __NR_fstatfs
+        "SYSFS", // __NR_sysfs
+        "GETPRIORITY", // __NR_getpriority
+        "SETPRIORITY", // __NR_setpriority
+        "SCHED_SETPARAM", // __NR_sched_setparam
+        "SCHED_GETPARAM", // __NR_sched_getparam
+        "SCHED_SETSCHEDULER", // __NR_sched_setscheduler
+        "SCHED_GETSCHEDULER", // __NR_sched_getscheduler
+        "SCHED_GET_PRIORITY_MAX", // __NR_sched_get_priority_max
+        "SCHED_GET_PRIORITY_MIN", // __NR_sched_get_priority_min
+        "SCHED_RR_GET_INTERVAL", // __NR_sched_rr_get_interval
+        "MLOCK", // __NR_mlock
+        "MUNLOCK", // __NR_munlock
+        "MLOCKALL", // __NR_mlockall
+        "MUNLOCKALL", // __NR_munlockall
+        "VHANGUP", // __NR_vhangup
+        "MODIFY_LDT", // __NR_modify_ldt
+        "PIVOT_ROOT", // __NR_pivot_root
+        "_SYSCTL", // __NR__sysctl
+        "PRCTL", // __NR_prctl
+        "ARCH_PRCTL", // __NR_arch_prctl
+        "ADJTIMEX", // __NR_adjtimex
+        "SETRLIMIT", // __NR_setrlimit
+        "CHROOT", // __NR_chroot
+        "SYNC", // __NR_sync
+        "ACCT", // __NR_acct
+        "SETTIMEOFDAY", // __NR_settimeofday
+        "MOUNT", // __NR_mount
+        "UMOUNT2", // __NR_umount2
+        "SWAPON", // __NR_swapon
+        "SWAPOFF", // __NR_swapoff
+        "REBOOT", // __NR_reboot
+        "SETHOSTNAME", // __NR_sethostname
+        "SETDOMAINNAME", // __NR_setdomainname
+        "IOPL", // __NR_iopl
+        "IOPERM", // __NR_ioperm
+        "CREATE_MODULE", // __NR_create_module
+        "INIT_MODULE", // __NR_init_module
+        "DELETE_MODULE", // __NR_delete_module
+        "GET_KERNEL_SYMS", // __NR_get_kernel_syms
+        "QUERY_MODULE", // __NR_query_module
+        "QUOTACTL", // __NR_quotactl
+        "NFSSERVCTL", // __NR_nfsservctl
+        "GETPMSG", // __NR_getpmsg
+        "PUTPMSG", // __NR_putpmsg
+        "AFS_SYSCALL", // __NR_afs_syscall
+        "TUXCALL", // __NR_tuxcall
+        "SECURITY", // __NR_security
+        "GETTID", // __NR_gettid
+        "READAHEAD", // __NR_readahead
+        "SETXATTR", // __NR_setxattr
+        "LSETXATTR", // __NR_lsetxattr
+        "FSETXATTR", // __NR_fsetxattr
+        "GETXATTR", // __NR_getxattr
+        "LGETXATTR", // __NR_lgetxattr
+        "FGETXATTR", // __NR_fgetxattr
+        "LISTXATTR", // __NR_listxattr
+        "LLISTXATTR", // __NR_llistxattr
+        "FLISTXATTR", // __NR_flistxattr
+        "REMOVEXATTR", // __NR_removexattr
+        "LREMOVEXATTR", // __NR_lremovexattr
+        "FREMOVEXATTR", // __NR_fremovexattr
+        "TKILL", // __NR_tkill
+        "TIME", // __NR_time
+        "FUTEX", // __NR_futex
+        "SCHED_SETAFFINITY", // __NR_sched_setaffinity
+        "SCHED_GETAFFINITY", // __NR_sched_getaffinity
+        "SET_THREAD_AREA", // __NR_set_thread_area
+        "IO_SETUP", // __NR_io_setup
+        "IO_DESTROY", // __NR_io_destroy
+        "IO_GETEVENTS", // __NR_io_getevents
+        "IO_SUBMIT", // __NR_io_submit
+        "IO_CANCEL", // __NR_io_cancel
+        "GET_THREAD_AREA", // __NR_get_thread_area
+        "LOOKUP_DCOOKIE", // __NR_lookup_dcookie
+        "EPOLL_CREATE", // __NR_epoll_create
+        "EPOLL_CTL_OLD", // __NR_epoll_ctl_old
+        "EPOLL_WAIT_OLD", // __NR_epoll_wait_old
+        "REMAP_FILE_PAGES", // __NR_remap_file_pages
+        "GETDENTS64", // __NR_getdents64
+        "SET_TID_ADDRESS", // __NR_set_tid_address
+        "RESTART_SYSCALL", // __NR_restart_syscall
+        "SEMTIMEDOP", // __NR_semtimedop
+        "FADVISE64", // __NR_fadvise64
+        "TIMER_CREATE", // __NR_timer_create
+        "TIMER_SETTIME", // __NR_timer_settime
+        "TIMER_GETTIME", // __NR_timer_gettime
+        "TIMER_GETOVERRUN", // __NR_timer_getoverrun
+        "TIMER_DELETE", // __NR_timer_delete
+        "CLOCK_SETTIME", // __NR_clock_settime
+        "CLOCK_GETTIME", // __NR_clock_gettime
+        "CLOCK_GETRES", // __NR_clock_getres
+        "CLOCK_NANOSLEEP", // __NR_clock_nanosleep
+        "EXIT_GROUP", // __NR_exit_group
+        "EPOLL_WAIT", // __NR_epoll_wait
+        "EPOLL_CTL", // __NR_epoll_ctl
+        "TGKILL", // __NR_tgkill
+        "UTIMES", // __NR_utimes
+        "VSERVER", // __NR_vserver
+        "MBIND", // __NR_mbind
+        "SET_MEMPOLICY", // __NR_set_mempolicy
+        "GET_MEMPOLICY", // __NR_get_mempolicy
+        "MQ_OPEN", // __NR_mq_open
+        "MQ_UNLINK", // __NR_mq_unlink
+        "MQ_TIMEDSEND", // __NR_mq_timedsend
+        "MQ_TIMEDRECEIVE", // __NR_mq_timedreceive
+        "MQ_NOTIFY", // __NR_mq_notify
+        "MQ_GETSETATTR", // __NR_mq_getsetattr
+        "KEXEC_LOAD", // __NR_kexec_load
+        "WAITID", // __NR_waitid
+        "ADD_KEY", // __NR_add_key
+        "REQUEST_KEY", // __NR_request_key
+        "KEYCTL", // __NR_keyctl
+        "IOPRIO_SET", // __NR_ioprio_set
+        "IOPRIO_GET", // __NR_ioprio_get
+        "INOTIFY_INIT", // __NR_inotify_init
+        "INOTIFY_ADD_WATCH", // __NR_inotify_add_watch
+        "INOTIFY_RM_WATCH", // __NR_inotify_rm_watch
+        "MIGRATE_PAGES", // __NR_migrate_pages
+        "OPENAT", // __NR_openat
+        "MKDIRAT", // __NR_mkdirat
+        "MKNODAT", // __NR_mknodat
+        "FCHOWNAT", // __NR_fchownat
+        "FUTIMESAT", // __NR_futimesat
+        "NEWFSTATAT", // __NR_newfstatat
+        "UNLINKAT", // __NR_unlinkat
+        "RENAMEAT", // __NR_renameat
+        "LINKAT", // __NR_linkat
+        "SYMLINKAT", // __NR_symlinkat
+        "READLINKAT", // __NR_readlinkat
+        "FCHMODAT", // __NR_fchmodat
+        "FACCESSAT", // __NR_faccessat
+        "PSELECT6", // __NR_pselect6
+        "PPOLL", // __NR_ppoll
+        "UNSHARE", // __NR_unshare
+        "SET_ROBUST_LIST", // __NR_set_robust_list
+        "GET_ROBUST_LIST", // __NR_get_robust_list
+        "SPLICE", // __NR_splice
+        "TEE", // __NR_tee
+        "SYNC_FILE_RANGE", // __NR_sync_file_range
+        "VMSPLICE", // __NR_vmsplice
+        "MOVE_PAGES", // __NR_move_pages
+        "UTIMENSAT", // __NR_utimensat
+        "EPOLL_PWAIT", // __NR_epoll_pwait
+        "SIGNALFD", // __NR_signalfd
+        "TIMERFD_CREATE", // __NR_timerfd_create
+        "EVENTFD", // __NR_eventfd
+        "FALLOCATE", // __NR_fallocate
+        "TIMERFD_SETTIME", // __NR_timerfd_settime
+        "TIMERFD_GETTIME", // __NR_timerfd_gettime
+        "ACCEPT4", // __NR_accept4
+        "SIGNALFD4", // __NR_signalfd4
+        "EVENTFD2", // __NR_eventfd2
+        "EPOLL_CREATE1", // __NR_epoll_create1
+        "DUP3", // __NR_dup3
+        "PIPE2", // __NR_pipe2
+        "INOTIFY_INIT1", // __NR_inotify_init1
+        "PREADV", // __NR_preadv
+        "PWRITEV", // __NR_pwritev
+        "RT_TGSIGQUEUEINFO", // __NR_rt_tgsigqueueinfo
+        "PERF_EVENT_OPEN", // __NR_perf_event_open
+        "RECVMMSG", // __NR_recvmmsg
+        "FANOTIFY_INIT", // __NR_fanotify_init
+        "FANOTIFY_MARK", // __NR_fanotify_mark
+        "PRLIMIT64", // __NR_prlimit64
+        "NAME_TO_HANDLE_AT", // __NR_name_to_handle_at
+        "OPEN_BY_HANDLE_AT", // __NR_open_by_handle_at
+        "CLOCK_ADJTIME", // __NR_clock_adjtime
+        "SYNCFS", // __NR_syncfs
+        "SENDMMSG", // __NR_sendmmsg
+        "SETNS", // __NR_setns
+        "GETCPU", // __NR_getcpu
+        "PROCESS_VM_READV", // __NR_process_vm_readv
+        "PROCESS_VM_WRITEV", // __NR_process_vm_writev
+        "KCMP", // __NR_kcmp
+        "FINIT_MODULE", // __NR_finit_module
+        "SCHED_SETATTR", // __NR_sched_setattr
+        "SCHED_GETATTR", // __NR_sched_getattr
+        "RENAMEAT2", // __NR_renameat2
+        "SECCOMP", // __NR_seccomp
+        "GETRANDOM", // __NR_getrandom
+        "MEMFD_CREATE", // __NR_memfd_create
+        "KEXEC_FILE_LOAD", // __NR_kexec_file_load
+        "BPF", // __NR_bpf
+        "EXECVEAT", // __NR_execveat
+        "USERFAULTFD", // __NR_userfaultfd
+        "MEMBARRIER", // __NR_membarrier
+        "MLOCK2", // __NR_mlock2
+        "COPY_FILE_RANGE", // __NR_copy_file_range
+        "PREADV2", // __NR_preadv2
+        "PWRITEV2", // __NR_pwritev2
+        "PKEY_MPROTECT", // __NR_pkey_mprotect
+        "PKEY_ALLOC", // __NR_pkey_alloc
+        "PKEY_FREE", // __NR_pkey_free
+        "STATX", // __NR_statx
+        "IO_PGETEVENTS", // __NR_io_pgetevents
+        "RSEQ", // __NR_rseq
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "UNDEF", // undefined
+        "PIDFD_SEND_SIGNAL", // __NR_pidfd_send_signal
+        "IO_URING_SETUP", // __NR_io_uring_setup
+        "IO_URING_ENTER", // __NR_io_uring_enter
+        "IO_URING_REGISTER", // __NR_io_uring_register
+        "OPEN_TREE", // __NR_open_tree
+        "MOVE_MOUNT", // __NR_move_mount
+        "FSOPEN", // __NR_fsopen
+        "FSCONFIG", // __NR_fsconfig
+        "FSMOUNT", // __NR_fsmount
+        "FSPICK", // __NR_fspick
+        "PIDFD_OPEN", // __NR_pidfd_open
+        "CLONE3", // __NR_clone3
+        "CLOSE_RANGE", // __NR_close_range
+        "OPENAT2", // __NR_openat2
+        "PIDFD_GETFD", // __NR_pidfd_getfd
+        "FACCESSAT2", // __NR_faccessat2
+        "PROCESS_MADVISE", // __NR_process_madvise
+        "EPOLL_PWAIT2", // __NR_epoll_pwait2
+        "MOUNT_SETATTR", // __NR_mount_setattr
+        "QUOTACTL_FD", // __NR_quotactl_fd
+        "LANDLOCK_CREATE_RULESET", // __NR_landlock_create_ruleset
+        "LANDLOCK_ADD_RULE", // __NR_landlock_add_rule
+        "LANDLOCK_RESTRICT_SELF", // __NR_landlock_restrict_self
+        "MEMFD_SECRET", // __NR_memfd_secret
+        "PROCESS_MRELEASE", // __NR_process_mrelease
+        "FUTEX_WAITV", // __NR_futex_waitv
+        "SET_MEMPOLICY_HOME_NODE", // __NR_set_mempolicy_home_node
+      };
+
+      const unsigned int NB_SYSCALL64 = 451;
+
+
+    }; /* unix namespace */
+  }; /* os namespace */
+}; /* triton namespace */
+
+#endif
+
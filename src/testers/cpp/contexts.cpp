@@ -0,0 +1,180 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <string>
+#include <thread>
+
+#include <api.hpp>
+#include <x86Specifications.hpp>
+
+#include "units.hpp"
+
+
+
+namespace units {
+
+  /* The state of a context after its thread */
+  struct ContextResult {
+    bool            failed;
+    std::string     error;
+    triton::usize   variables;
+    triton::uint64  concrete;
+    triton::uint64  evaluation;
+    bool            recorded;
+    bool            samePc;
+    bool            sameStack;
+    triton::uint64  pc;
+    triton::uint64  stack;
+    std::string     name;
+  };
+
+
+  /*
+   * Symbolizes a register, runs `opcodes` on it `rounds` times without installing any scope, then evaluates its AST.
+   * After each round, the program counter and the stack pointer must be the ones of the context's architecture.
+   */
+  static void addRounds(triton::API& ctx, triton::arch::architectures_e arch, triton::uint32 regId, triton::uint32 pcId, triton::uint32 stackId, const std::string& opcodes, triton::uint64 init, triton::usize rounds, ContextResult& result) {
+    result.failed    = false;
+    result.samePc    = true;
+    result.sameStack = true;
+    try {
+      triton::arch::Register reg;
+
+      ctx.setArchitecture(arch);
+
+      /* A register is built from the specifications of the current context */
+      {
+        triton::API::Scope scope(ctx);
+        reg = triton::arch::Register(regId, init);
+        ctx.setConcreteRegisterValue(triton::arch::Register(stackId, 0x7fff0000));
+      }
+
+      ctx.setConcreteRegisterValue(reg);
+      ctx.convertRegisterToSymbolicVariable(reg);
+
+      for (triton::usize i = 0; i < rounds; i++) {
+        triton::arch::Instruction inst;
+        inst.setOpcodes(reinterpret_cast<const triton::uint8*>(opcodes.data()), static_cast<triton::uint32>(opcodes.size()));
+        inst.setAddress(0x1000);
+        ctx.processing(inst);
+
+        /* The registers behind the macros are the ones of the current context */
+        triton::API::Scope scope(ctx);
+        if (TRITON_X86_REG_PC.getId() != pcId)
+          result.samePc = false;
+        if (TRITON_X86_REG_STACK.getId() != stackId)
+          result.sameStack = false;
+      }
+
+      {
+        triton::API::Scope scope(ctx);
+        result.pc    = ctx.getConcreteRegisterValue(TRITON_X86_REG_PC).convert_to<triton::uint64>();
+        result.stack = ctx.getConcreteRegisterValue(TRITON_X86_REG_STACK).convert_to<triton::uint64>();
+      }
+
+      triton::ast::AbstractNode* node = ctx.getFullAstFromId(ctx.getSymbolicRegisterId(reg));
+      result.variables  = ctx.getSymbolicVariables().size();
+      result.concrete   = ctx.getConcreteRegisterValue(reg).convert_to<triton::uint64>();
+      result.evaluation = node->evaluate().convert_to<triton::uint64>();
+      result.recorded   = ctx.getAllocatedAstNodes().count(node) == 1;
+
+      /* The name of a register does not depend on the current context */
+      result.name = reg.getName();
+    }
+    catch (const std::exception& e) {
+      result.failed = true;
+      result.error  = e.what();
+    }
+  }
+
+
+  triton::sint32 contexts(void) {
+    const triton::usize rounds = 500;
+    triton::sint32 count = 0;
+    ContextResult r32, r64;
+    triton::API ctx32, ctx64;
+
+    /* add eax, 3 and add rax, 5 in two contexts at the same time */
+    std::thread t32([&]() {
+      addRounds(ctx32, triton::arch::ARCH_X86, triton::arch::x86::ID_REG_EAX, triton::arch::x86::ID_REG_EIP, triton::arch::x86::ID_REG_ESP, "\x83\xc0\x03", 1, rounds, r32);
+    });
+    std::thread t64([&]() {
+      addRounds(ctx64, triton::arch::ARCH_X86_64, triton::arch::x86::ID_REG_RAX, triton::arch::x86::ID_REG_RIP, triton::arch::x86::ID_REG_RSP, "\x48\x83\xc0\x05", 0x100000000, rounds, r64);
+    });
+
+    t32.join();
+    t64.join();
+
+    if (!check(count, "x86 context: " + r32.error, !r32.failed))
+      return -1;
+
+    if (!check(count, "x86-64 context: " + r64.error, !r64.failed))
+      return -1;
+
+    if (!check(count, "x86 context variables", r32.variables, 1))
+      return -1;
+
+    if (!check(count, "x86-64 context variables", r64.variables, 1))
+      return -1;
+
+    if (!check(count, "x86 eax concrete value", r32.concrete, 1 + 3 * rounds))
+      return -1;
+
+    if (!check(count, "x86-64 rax concrete value", r64.concrete, 0x100000000 + 5 * rounds))
+      return -1;
+
+    /* The references of the full AST resolve in the context which built them */
+    if (!check(count, "x86 eax AST evaluation", r32.evaluation, r32.concrete))
+      return -1;
+
+    if (!check(count, "x86-64 rax AST evaluation", r64.evaluation, r64.concrete))
+      return -1;
+
+    if (!check(count, "x86 eax AST recorded by its context", r32.recorded))
+      return -1;
+
+    if (!check(count, "x86-64 rax AST recorded by its context", r64.recorded))
+      return -1;
+
+    if (!check(count, "x86 eax named outside its context: " + r32.name, r32.name == "eax"))
+      return -1;
+
+    if (!check(count, "x86-64 rax named outside its context: " + r64.name, r64.name == "rax"))
+      return -1;
+
+    /* The program counter and the stack pointer never switched to the other context's ones */
+    if (!check(count, "x86 eip is the program counter", r32.samePc))
+      return -1;
+
+    if (!check(count, "x86-64 rip is the program counter", r64.samePc))
+      return -1;
+
+    if (!check(count, "x86 esp is the stack pointer", r32.sameStack))
+      return -1;
+
+    if (!check(count, "x86-64 rsp is the stack pointer", r64.sameStack))
+      return -1;
+
+    if (!check(count, "x86 eip concrete value", r32.pc, 0x1003))
+      return -1;
+
+    if (!check(count, "x86-64 rip concrete value", r64.pc, 0x1004))
+      return -1;
+
+    if (!check(count, "x86 esp concrete value", r32.stack, 0x7fff0000))
+      return -1;
+
+    if (!check(count, "x86-64 rsp concrete value", r64.stack, 0x7fff0000))
+      return -1;
+
+    /* Nothing has leaked into the default context */
+    if (!check(count, "default context untouched", !triton::api.isArchitectureValid()))
+      return -1;
+
+    return count;
+  }
+
+};
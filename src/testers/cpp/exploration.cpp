@@ -0,0 +1,298 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <elf.hpp>
+#include <explorer.hpp>
+#include <generationalSearch.hpp>
+#include <seedQueue.hpp>
+#include <solverCache.hpp>
+#include <x86Specifications.hpp>
+
+#include "units.hpp"
+
+
+
+namespace units {
+
+  using namespace triton::engines::exploration;
+
+
+  /* The check() function of crackme_xor, from its entry to its ret */
+  static const triton::uint64 CHECK_ENTRY = 0x400556;
+  static const triton::uint64 CHECK_RET   = 0x4005b2;
+
+  /* Its serial comparison, je 0x4005a2 */
+  static const triton::uint64 CHECK_JE    = 0x400599;
+
+
+  /* The five serial bytes read by check() */
+  static const std::vector<triton::uint64> CHECK_INPUTS = {0x1000, 0x1001, 0x1002, 0x1003, 0x1004};
+
+
+  /* Loads crackme_xor and points the argument of check() to the inputs */
+  static void setupCrackmeXor(const triton::format::elf::Elf& binary, triton::API& ctx) {
+    ctx.setArchitecture(triton::arch::ARCH_X86_64);
+    for (const auto& phdr : binary.getProgramHeaders())
+      ctx.setConcreteMemoryAreaValue(phdr.getVaddr(), binary.getRaw() + phdr.getOffset(), phdr.getFilesz());
+    ctx.setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RDI, CHECK_INPUTS[0]));
+    ctx.setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RSP, 0x7fff0000));
+    ctx.setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RBP, 0x7fff0000));
+  }
+
+
+  /* Explores check() with `workers` workers and returns the sorted covered branches */
+  static std::vector<Branch> exploreCrackmeXor(const triton::format::elf::Elf& binary, triton::usize workers, std::vector<Seed>& seeds) {
+    Explorer explorer([&binary](triton::API& ctx) {
+      setupCrackmeXor(binary, ctx);
+    }, CHECK_INPUTS, CHECK_ENTRY);
+
+    explorer.addStopAddress(CHECK_RET);
+    explorer.setWorkers(workers);
+    explorer.explore();
+
+    std::vector<Branch> branches = explorer.getCoverage();
+    std::sort(branches.begin(), branches.end());
+    seeds = explorer.getSeeds();
+
+    return branches;
+  }
+
+
+  triton::sint32 seedQueue(void) {
+    triton::sint32 count = 0;
+    Seed seed;
+
+    /* The owner pops the newest seed, a thief steals the oldest one */
+    {
+      SeedQueue queue(2);
+      queue.push(0, Seed(1, 1));
+      queue.push(0, Seed(1, 2));
+      queue.push(0, Seed(1, 3));
+
+      if (!check(count, "queue.size()", queue.size(), 3))
+        return -1;
+
+      queue.pop(1, seed);
+      if (!check(count, "queue.pop(1) steals the oldest seed", seed[0], 1))
+        return -1;
+
+      queue.pop(0, seed);
+      if (!check(count, "queue.pop(0) pops the newest seed", seed[0], 3))
+        return -1;
+
+      queue.done();
+      queue.done();
+      queue.pop(1, seed);
+      queue.done();
+
+      if (!check(count, "queue.pop() once no seed is pending", !queue.pop(0, seed)))
+        return -1;
+
+      if (!check(count, "queue.size() once empty", queue.size(), 0))
+        return -1;
+    }
+
+    /* Each seed of depth d pushes two seeds of depth d+1, the workers steal from each other */
+    {
+      const triton::uint8 depth   = 12;
+      const triton::usize total   = (1 << (depth + 1)) - 1;
+      const triton::usize workers = 4;
+      std::atomic<triton::usize> popped(0);
+      std::atomic<bool> overflow(false);
+      std::vector<std::thread> threads;
+      SeedQueue queue(workers);
+
+      queue.push(0, Seed(1, 0));
+      for (triton::usize worker = 0; worker < workers; worker++) {
+        threads.push_back(std::thread([&, worker]() {
+          Seed current;
+          while (queue.pop(worker, current)) {
+            popped++;
+            if (current[0] < depth) {
+              queue.push(worker, Seed(1, current[0] + 1));
+              queue.push(worker, Seed(1, current[0] + 1));
+            }
+            if (queue.size() > total)
+              overflow = true;
+            queue.done();
+          }
+        }));
+      }
+
+      for (auto& thread : threads)
+        thread.join();
+
+      if (!check(count, "seeds popped by all workers", popped, total))
+        return -1;
+
+      if (!check(count, "queue.size() never exceeds the seeds pushed", !overflow))
+        return -1;
+
+      if (!check(count, "queue.size() after the workers", queue.size(), 0))
+        return -1;
+    }
+
+    return count;
+  }
+
+
+  triton::sint32 solverCache(void) {
+    triton::sint32 count = 0;
+    std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+    std::map<triton::uint32, triton::engines::solver::SolverModel> found;
+    SolverCache cache;
+
+    model[0] = triton::engines::solver::SolverModel("SymVar_0", 0x41);
+
+    if (!check(count, "cache.find() on an empty cache", !cache.find(1, found)))
+      return -1;
+
+    cache.insert(1, model);
+    cache.insert(2, std::map<triton::uint32, triton::engines::solver::SolverModel>());
+
+    if (!check(count, "cache.find(1)", cache.find(1, found) && found.size() == 1))
+      return -1;
+
+    if (!check(count, "cache.find(1) value", found[0].getValue().convert_to<triton::uint64>(), 0x41))
+      return -1;
+
+    /* An unsatisfiable query is cached as an empty model */
+    if (!check(count, "cache.find(2)", cache.find(2, found) && found.empty()))
+      return -1;
+
+    if (!check(count, "cache.size()", cache.size(), 2))
+      return -1;
+
+    cache.clear();
+    if (!check(count, "cache.size() after clear()", cache.size(), 0))
+      return -1;
+
+    return count;
+  }
+
+
+  triton::sint32 explorer(void) {
+    triton::sint32 count = 0;
+    triton::format::elf::Elf binary(samples + "/crackmes/crackme_xor");
+    std::vector<Seed> seeds1, seeds4;
+
+    std::vector<Branch> single   = exploreCrackmeXor(binary, 1, seeds1);
+    std::vector<Branch> parallel = exploreCrackmeXor(binary, 4, seeds4);
+
+    /* Both sides of the serial comparison are reached by solving the first one */
+    bool taken    = std::find(single.begin(), single.end(), Branch(CHECK_JE, 0x4005a2)) != single.end();
+    bool notTaken = std::find(single.begin(), single.end(), Branch(CHECK_JE, 0x40059b)) != single.end();
+
+    if (!check(count, "je 0x4005a2 covered by one worker", taken))
+      return -1;
+
+    if (!check(count, "jne 0x40059b covered by one worker", notTaken))
+      return -1;
+
+    if (!check(count, "branches covered by 4 workers", parallel.size(), single.size()))
+      return -1;
+
+    if (!check(count, "branches covered by 4 workers and by one worker", parallel == single))
+      return -1;
+
+    /* The first serial byte: ((x - 1) ^ 0x55) == 0x31 */
+    bool solved = false;
+    for (const auto& seed : seeds4)
+      solved |= (seed[0] == 'e');
+
+    if (!check(count, "seed solving the first serial byte", solved))
+      return -1;
+
+    return count;
+  }
+
+
+
+  triton::sint32 generationalSearch(void) {
+    triton::sint32 count = 0;
+    triton::format::elf::Elf binary(samples + "/crackmes/crackme_xor");
+    std::vector<SearchNode> scored;
+    std::set<Seed> unique;
+    triton::API ctx;
+
+    GenerationalSearch search(ctx, [&binary](triton::API& ctx) {
+      setupCrackmeXor(binary, ctx);
+    }, CHECK_INPUTS, CHECK_ENTRY);
+
+    search.addStopAddress(CHECK_RET);
+    search.setScoringCallback([&scored](const SearchNode& node) {
+      scored.push_back(node);
+      return static_cast<double>(node.newBranches);
+    });
+    search.explore();
+
+    /* Each child is scored right after its run, the initial seed is not scored */
+    if (!check(count, "search.getRuns()", search.getRuns(), scored.size() + 1))
+      return -1;
+
+    /* A child is never expanded twice */
+    for (const auto& node : scored)
+      unique.insert(node.seed);
+
+    if (!check(count, "distinct seeds scored", unique.size(), scored.size()))
+      return -1;
+
+    if (!check(count, "search.getPendingSeeds()", search.getPendingSeeds(), 0))
+      return -1;
+
+    /*
+     * The generation g solves the serial byte g-1 and keeps the bytes solved by its
+     * ancestors, whose branches are before its bound.
+     */
+    const std::string serial = "elite";
+    std::map<triton::usize, std::pair<triton::usize, triton::usize>> bounds;
+    bool prefixes = true;
+
+    for (const auto& node : scored) {
+      if (node.generation > serial.size() || std::string(node.seed.begin(), node.seed.begin() + node.generation) != serial.substr(0, node.generation))
+        prefixes = false;
+      auto it = bounds.find(node.generation);
+      if (it == bounds.end())
+        bounds[node.generation] = std::make_pair(node.bound, node.bound);
+      else
+        it->second = std::make_pair(std::min(it->second.first, node.bound), std::max(it->second.second, node.bound));
+    }
+
+    if (!check(count, "serial bytes solved by each generation", prefixes))
+      return -1;
+
+    if (!check(count, "generations", bounds.size(), serial.size()))
+      return -1;
+
+    bool increasing = true;
+    for (const auto& generation : bounds) {
+      auto previous = bounds.find(generation.first - 1);
+      if (previous != bounds.end() && previous->second.second >= generation.second.first)
+        increasing = false;
+    }
+
+    if (!check(count, "bounds of each generation after the bounds of its parents", increasing))
+      return -1;
+
+    bool solved = false;
+    for (const auto& seed : search.getSeeds())
+      solved |= (std::string(seed.begin(), seed.end()) == serial);
+
+    if (!check(count, "seed solving the serial", solved))
+      return -1;
+
+    return count;
+  }
+
+};
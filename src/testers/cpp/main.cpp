@@ -0,0 +1,85 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+/*
+** The C++ unit testing of the engines which are not reachable from the
+** Python bindings. Each test returns its number of checks, or -1 on the
+** first failure.
+**
+** Usage: triton_units_testing [--samples <src/samples>]
+*/
+
+#include <cstring>
+#include <iostream>
+
+#include "units.hpp"
+
+
+
+namespace units {
+
+  std::string samples = "src/samples";
+
+
+  bool check(triton::sint32& count, const std::string& name, triton::uint64 output, triton::uint64 expected) {
+    if (output != expected) {
+      std::cout << "[KO] " << name << std::endl;
+      std::cout << "\tOutput   : " << output << std::endl;
+      std::cout << "\tExpected : " << expected << std::endl;
+      return false;
+    }
+    count++;
+    return true;
+  }
+
+
+  bool check(triton::sint32& count, const std::string& name, bool condition) {
+    if (!condition) {
+      std::cout << "[KO] " << name << std::endl;
+      return false;
+    }
+    count++;
+    return true;
+  }
+
+};
+
+
+static const struct {
+  const char* name;
+  triton::sint32 (*function)(void);
+} units_testing[] = {
+  {"Testing two threaded contexts",    units::contexts},
+  {"Testing the trace round trip",     units::trace},
+  {"Testing the seed queue",           units::seedQueue},
+  {"Testing the solver cache",         units::solverCache},
+  {"Testing the parallel explorer",    units::explorer},
+  {"Testing the generational search",  units::generationalSearch},
+  {nullptr,                            nullptr},
+};
+
+
+int main(int ac, const char** av) {
+  triton::sint32 count = 0;
+
+  for (int index = 1; index < ac; index++) {
+    if (!std::strcmp(av[index], "--samples") && index + 1 < ac)
+      units::samples = av[++index];
+  }
+
+  for (triton::uint32 index = 0; units_testing[index].name != nullptr; index++) {
+    triton::sint32 ret = units_testing[index].function();
+    if (ret < 0) {
+      std::cout << std::endl << "Error into '" << units_testing[index].name << "'" << std::endl;
+      return -1;
+    }
+    count += ret;
+    std::cout << "[OK] " << units_testing[index].name << std::endl;
+  }
+
+  std::cout << std::endl << "[GOOD]\t" << count << " tests were been executed successfully :-)" << std::endl;
+  return 0;
+}
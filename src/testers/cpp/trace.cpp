@@ -0,0 +1,283 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <replayEngine.hpp>
+#include <traceIndex.hpp>
+#include <traceReader.hpp>
+#include <traceWriter.hpp>
+#include <x86Specifications.hpp>
+
+#include "units.hpp"
+
+
+
+namespace units {
+
+  using namespace triton::format::trace;
+
+
+  /* The trace files are written in the working directory */
+  static const std::string TRACE_PATH   = "triton_units_trace.bin";
+  static const std::string CORRUPT_PATH = "triton_units_trace_corrupt.bin";
+
+  /* The records are loads and stores in [MEMORY_BASE:MEMORY_BASE+MEMORY_SIZE] */
+  static const triton::uint64 MEMORY_BASE = 0x2000;
+  static const triton::usize  MEMORY_SIZE = 0x400;
+
+
+  /* Builds `triples` times the records of mov rax, [rbx] / add rax, rcx / mov [rbx+8], rax with their inputs */
+  static std::vector<triton::arch::Instruction> buildRecords(triton::API& ctx, triton::usize triples) {
+    std::vector<triton::arch::Instruction> records;
+    triton::API::Scope scope(ctx);
+
+    for (triton::usize j = 0; j < triples; j++) {
+      triton::uint64 rbx   = MEMORY_BASE + (j % (MEMORY_SIZE / 16)) * 16;
+      triton::uint64 rcx   = 0xfedcba9876543210ULL ^ (j * 0x9e3779b97f4a7c15ULL);
+      triton::uint64 value = 0x0123456789abcdefULL * (j + 1);
+      triton::uint32 tid   = static_cast<triton::uint32>((j / 500) % 3);
+      triton::arch::Instruction load, add, store;
+
+      load.setOpcodes(reinterpret_cast<const triton::uint8*>("\x48\x8b\x03"), 3);
+      load.setAddress(0x400000);
+      load.setThreadId(tid);
+      load.updateContext(triton::arch::Register(triton::arch::x86::ID_REG_RBX, rbx));
+      load.updateContext(triton::arch::MemoryAccess(rbx, QWORD_SIZE, value));
+
+      add.setOpcodes(reinterpret_cast<const triton::uint8*>("\x48\x01\xc8"), 3);
+      add.setAddress(0x400003);
+      add.setThreadId(tid);
+      add.updateContext(triton::arch::Register(triton::arch::x86::ID_REG_RCX, rcx));
+
+      store.setOpcodes(reinterpret_cast<const triton::uint8*>("\x48\x89\x43\x08"), 4);
+      store.setAddress(0x400006);
+      store.setThreadId(tid);
+      store.updateContext(triton::arch::Register(triton::arch::x86::ID_REG_RBX, rbx));
+
+      records.push_back(load);
+      records.push_back(add);
+      records.push_back(store);
+    }
+
+    return records;
+  }
+
+
+  /* Returns true if two records hold the same address, thread, opcodes and inputs */
+  static bool isSameRecord(const triton::arch::Instruction& a, const triton::arch::Instruction& b) {
+    if (a.getAddress() != b.getAddress() || a.getThreadId() != b.getThreadId() || a.getSize() != b.getSize())
+      return false;
+
+    if (std::memcmp(a.getOpcodes(), b.getOpcodes(), a.getSize()) != 0)
+      return false;
+
+    if (a.registerState.size() != b.registerState.size() || a.memoryAccess.size() != b.memoryAccess.size())
+      return false;
+
+    for (triton::usize index = 0; index < a.registerState.size(); index++) {
+      if (a.registerState[index].getId() != b.registerState[index].getId() ||
+          a.registerState[index].getConcreteValue() != b.registerState[index].getConcreteValue())
+        return false;
+    }
+
+    for (triton::usize index = 0; index < a.memoryAccess.size(); index++) {
+      if (a.memoryAccess[index].getAddress() != b.memoryAccess[index].getAddress() ||
+          a.memoryAccess[index].getSize() != b.memoryAccess[index].getSize() ||
+          a.memoryAccess[index].getConcreteValue() != b.memoryAccess[index].getConcreteValue())
+        return false;
+    }
+
+    return true;
+  }
+
+
+  /* Returns true if two contexts hold the same registers and the same memory records area */
+  static bool isSameState(const triton::API& a, const triton::API& b) {
+    for (const auto* reg : a.getParentRegisters()) {
+      if (a.getConcreteRegisterValue(*reg, false) != b.getConcreteRegisterValue(*reg, false))
+        return false;
+    }
+    return a.getConcreteMemoryAreaValue(MEMORY_BASE, MEMORY_SIZE, false) == b.getConcreteMemoryAreaValue(MEMORY_BASE, MEMORY_SIZE, false);
+  }
+
+
+  static std::vector<char> readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+
+  static void writeFile(const std::string& path, const std::vector<char>& data) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(data.data(), data.size());
+  }
+
+
+  /* Returns true if reading the whole trace at `path` throws a trace exception */
+  static bool isRejected(const std::string& path) {
+    try {
+      triton::API ctx;
+      ctx.setArchitecture(triton::arch::ARCH_X86_64);
+      triton::API::Scope scope(ctx);
+      TraceReader reader(path);
+      triton::arch::Instruction inst;
+      while (reader.next(inst));
+    }
+    catch (const triton::exceptions::Trace&) {
+      return true;
+    }
+    return false;
+  }
+
+
+  triton::sint32 trace(void) {
+    const triton::usize triples = 3000;
+    triton::sint32 count = 0;
+    triton::API reference;
+
+    reference.setArchitecture(triton::arch::ARCH_X86_64);
+    std::vector<triton::arch::Instruction> records = buildRecords(reference, triples);
+
+    /* The reference state, processing the records directly */
+    for (auto inst : records)
+      reference.processing(inst);
+
+    /* The last store writes the last load plus the last rcx */
+    triton::uint64 last   = 0x0123456789abcdefULL * triples + (0xfedcba9876543210ULL ^ ((triples - 1) * 0x9e3779b97f4a7c15ULL));
+    triton::uint64 lastAt = MEMORY_BASE + ((triples - 1) % (MEMORY_SIZE / 16)) * 16 + 8;
+
+    triton::arch::Register rax;
+    {
+      triton::API::Scope scope(reference);
+      rax = triton::arch::Register(triton::arch::x86::ID_REG_RAX);
+    }
+
+    if (!check(count, "reference rax", reference.getConcreteRegisterValue(rax).convert_to<triton::uint64>(), last))
+      return -1;
+
+    if (!check(count, "reference last store", reference.getConcreteMemoryValue(triton::arch::MemoryAccess(lastAt, QWORD_SIZE)).convert_to<triton::uint64>(), last))
+      return -1;
+
+    for (bool compressed : {true, false}) {
+      const std::string mode = compressed ? " (compressed)" : " (raw)";
+
+      /* write */
+      {
+        TraceWriter writer(TRACE_PATH, triton::arch::ARCH_X86_64, compressed);
+        for (const auto& inst : records)
+          writer.write(inst);
+        writer.close();
+
+        if (!check(count, "writer.getCount()" + mode, writer.getCount(), records.size()))
+          return -1;
+      }
+
+      /* read, each register differs from the previous record so the records come back whole */
+      {
+        triton::API ctx;
+        ctx.setArchitecture(triton::arch::ARCH_X86_64);
+        triton::API::Scope scope(ctx);
+        TraceReader reader(TRACE_PATH);
+        triton::arch::Instruction inst;
+        triton::usize index = 0;
+        bool same = true;
+
+        if (!check(count, "reader.getArchitecture()" + mode, reader.getArchitecture(), triton::arch::ARCH_X86_64))
+          return -1;
+
+        while (reader.next(inst)) {
+          if (index >= records.size() || !isSameRecord(inst, records[index]))
+            same = false;
+          index++;
+        }
+
+        if (!check(count, "reader.getCount()" + mode, reader.getCount(), records.size()))
+          return -1;
+
+        if (!check(count, "records read back bit-exact" + mode, same))
+          return -1;
+      }
+
+      /* replay */
+      {
+        triton::API ctx;
+        triton::engines::replay::ReplayEngine engine(ctx);
+
+        if (!check(count, "engine.replay()" + mode, engine.replay(TRACE_PATH), records.size()))
+          return -1;
+
+        if (!check(count, "registers and memory after the replay" + mode, isSameState(reference, ctx)))
+          return -1;
+      }
+    }
+
+    /* restore a checkpoint on a context which holds the state of a later one */
+    {
+      triton::API built, ctx;
+      TraceIndex index;
+
+      index.build(built, TRACE_PATH, 1000);
+
+      if (!check(count, "index checkpoints", index.getCheckpoints().size() > 1))
+        return -1;
+
+      index.restore(ctx, index.getCheckpoints().size() - 1);
+      if (!check(count, "records area mapped at the last checkpoint", ctx.isMemoryMapped(MEMORY_BASE, MEMORY_SIZE)))
+        return -1;
+
+      /* The trace starts on an empty memory */
+      index.restore(ctx, 0);
+      if (!check(count, "records area unmapped at the first checkpoint", !ctx.isMemoryMapped(MEMORY_BASE)))
+        return -1;
+    }
+
+    /* corrupt */
+    std::vector<char> data = readFile(TRACE_PATH);
+    std::vector<char> corrupt;
+
+    corrupt.assign(data.begin(), data.begin() + TRACE_HEADER_SIZE / 2);
+    writeFile(CORRUPT_PATH, corrupt);
+    if (!check(count, "truncated header rejected", isRejected(CORRUPT_PATH)))
+      return -1;
+
+    corrupt = data;
+    corrupt[0] ^= 0xff;
+    writeFile(CORRUPT_PATH, corrupt);
+    if (!check(count, "invalid magic rejected", isRejected(CORRUPT_PATH)))
+      return -1;
+
+    corrupt = data;
+    corrupt[8] = static_cast<char>(TRACE_VERSION + 1);
+    writeFile(CORRUPT_PATH, corrupt);
+    if (!check(count, "unsupported version rejected", isRejected(CORRUPT_PATH)))
+      return -1;
+
+    corrupt = data;
+    corrupt[TRACE_HEADER_SIZE] = static_cast<char>(0xff);
+    writeFile(CORRUPT_PATH, corrupt);
+    if (!check(count, "corrupted block header rejected", isRejected(CORRUPT_PATH)))
+      return -1;
+
+    corrupt.assign(data.begin(), data.end() - 16);
+    writeFile(CORRUPT_PATH, corrupt);
+    if (!check(count, "truncated block rejected", isRejected(CORRUPT_PATH)))
+      return -1;
+
+    std::remove(TRACE_PATH.c_str());
+    std::remove(CORRUPT_PATH.c_str());
+
+    return count;
+  }
+
+};
@@ -0,0 +1,48 @@
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_UNITS_HPP
+#define TRITON_UNITS_HPP
+
+#include <string>
+
+#include <tritonTypes.hpp>
+
+
+
+//! The C++ unit testing namespace
+namespace units {
+
+  //! The path of the src/samples directory.
+  extern std::string samples;
+
+  //! Counts a passed check, or prints the failed one and returns false.
+  bool check(triton::sint32& count, const std::string& name, triton::uint64 output, triton::uint64 expected);
+
+  //! Counts a passed check, or prints the failed one and returns false.
+  bool check(triton::sint32& count, const std::string& name, bool condition);
+
+  //! Testing two contexts driven from two threads. Returns the number of checks, or -1 on failure.
+  triton::sint32 contexts(void);
+
+  //! Testing the trace write, read and replay round trip. Returns the number of checks, or -1 on failure.
+  triton::sint32 trace(void);
+
+  //! Testing the seed queue. Returns the number of checks, or -1 on failure.
+  triton::sint32 seedQueue(void);
+
+  //! Testing the solver cache. Returns the number of checks, or -1 on failure.
+  triton::sint32 solverCache(void);
+
+  //! Testing the parallel exploration. Returns the number of checks, or -1 on failure.
+  triton::sint32 explorer(void);
+
+  //! Testing the generational search. Returns the number of checks, or -1 on failure.
+  triton::sint32 generationalSearch(void);
+
+};
+
+#endif /* TRITON_UNITS_HPP */